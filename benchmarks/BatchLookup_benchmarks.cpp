@@ -0,0 +1,96 @@
+/*
+ * ---------------------------------------------------
+ * BatchLookup_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 23:20:46
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int KEY_COUNT = 1 << 20;
+constexpr int BATCH_SIZE = 1024;
+constexpr int BATCH_COUNT = 2048;
+
+std::vector<int> randomKeys(int count, utils::uint32 seed)
+{
+    std::vector<int> keys((std::size_t)count);
+    for (int& key : keys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        key = (int)(seed % (utils::uint32)(KEY_COUNT * 2));
+    }
+    return keys;
+}
+
+// half of the probed keys are in the map
+template<typename Map>
+void compare(const char* name, const Map& map, const std::vector<int>& probes)
+{
+    char label[64];
+    bool results[BATCH_SIZE];
+    utils::uint64 found = 0;
+
+    Timer loopTimer;
+    for (int b = 0; b < BATCH_COUNT; b++)
+    {
+        const int* keys = probes.data() + (std::size_t)(b % 64) * BATCH_SIZE;
+        for (int i = 0; i < BATCH_SIZE; i++)
+            results[i] = map.contain(keys[i]);
+        found += results[b % BATCH_SIZE] ? 1 : 0;
+    }
+    double loopSeconds = loopTimer.seconds();
+    std::snprintf(label, sizeof(label), "%s contain loop", name);
+    report(label, (double)BATCH_COUNT * BATCH_SIZE, loopSeconds);
+
+    Timer batchTimer;
+    for (int b = 0; b < BATCH_COUNT; b++)
+    {
+        const int* keys = probes.data() + (std::size_t)(b % 64) * BATCH_SIZE;
+        map.containMany(keys, BATCH_SIZE, results);
+        found += results[b % BATCH_SIZE] ? 1 : 0;
+    }
+    double batchSeconds = batchTimer.seconds();
+    std::snprintf(label, sizeof(label), "%s containMany", name);
+    report(label, (double)BATCH_COUNT * BATCH_SIZE, batchSeconds);
+
+    if (found == 0)
+        std::printf("  (no hit)\n");
+}
+
+}
+
+BENCHMARK(BatchLookup_contain)
+{
+    std::vector<int> inserted = randomKeys(KEY_COUNT, 0x9E3779B9);
+    utils::Dictionary<int, int> dictionary;
+    utils::HashMap<int, int> hashMap;
+    for (int key : inserted)
+    {
+        if (hashMap.contain(key))
+            continue;
+        hashMap.insert(key, key);
+        dictionary.insert(key, key);
+    }
+    std::vector<int> probes = randomKeys(64 * BATCH_SIZE, 0x2545F491);
+
+    compare("Dictionary", dictionary, probes);
+    compare("HashMap   ", hashMap, probes);
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * ---------------------------------------------------
+ * Benchmark.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 15:24:11
+ * ---------------------------------------------------
+ */
+
+#ifndef BENCHMARK_HPP
+# define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace utils_benchmarks
+{
+
+struct Benchmark
+{
+    const char* name;
+    void (*function)();
+
+    static std::vector<Benchmark>& all()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    struct Registrar
+    {
+        Registrar(const char* name, void (*function)()) { all().push_back(Benchmark{name, function}); }
+    };
+};
+
+class Timer
+{
+public:
+    Timer() : m_start(std::chrono::steady_clock::now()) {}
+
+    inline double seconds() const { return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count(); }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+inline void report(const char* label, double operations, double seconds)
+{
+    std::printf("  %-40s %10.2f Mops/s\n", label, operations / seconds / 1e6);
+}
+
+}
+
+#define BENCHMARK(name)                                                                           \
+    static void benchmark_##name();                                                               \
+    static utils_benchmarks::Benchmark::Registrar registrar_##name(#name, &benchmark_##name);    \
+    static void benchmark_##name()
+
+#endif // BENCHMARK_HPP
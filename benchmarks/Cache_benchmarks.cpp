@@ -0,0 +1,77 @@
+/*
+ * ---------------------------------------------------
+ * Cache_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 20:52:18
+ * ---------------------------------------------------
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/LfuCache.hpp"
+#include "UtilsCPP/LruCache.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int ACCESS_COUNT = 1 << 22;
+constexpr int KEY_COUNT = 1 << 20;
+
+// skewed key sequence, key k is accessed with a probability proportional to 1 / (k + 1)
+std::vector<int> zipfKeys()
+{
+    std::vector<int> keys(ACCESS_COUNT);
+    utils::uint64 state = 0x9E3779B97F4A7C15ULL;
+    for (int& key : keys)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double u = (double)(state >> 11) / (double)(1ULL << 53);
+        key = (int)std::pow((double)KEY_COUNT, u) - 1;
+    }
+    return keys;
+}
+
+// get, and put on a miss like a cache in front of a slow storage
+template<typename Cache>
+void accesses(const char* label, Cache& cache, const std::vector<int>& keys)
+{
+    Timer timer;
+    for (int key : keys)
+    {
+        if (cache.get(key) == nullptr)
+            cache.put(key, key);
+    }
+    double seconds = timer.seconds();
+    report(label, (double)keys.size(), seconds);
+    std::printf("  %-40s %10.2f %%\n", "  hit ratio", 100.0 * (double)cache.stats().hits / (double)keys.size());
+}
+
+}
+
+BENCHMARK(Cache_access)
+{
+    std::vector<int> keys = zipfKeys();
+    for (utils::uint64 capacity : { 1 << 10, 1 << 16 })
+    {
+        char label[64];
+        utils::LruCache<int, int> lru(capacity);
+        std::snprintf(label, sizeof(label), "LruCache %8d entries", (int)capacity);
+        accesses(label, lru, keys);
+
+        utils::LfuCache<int, int> lfu(capacity);
+        std::snprintf(label, sizeof(label), "LfuCache %8d entries", (int)capacity);
+        accesses(label, lfu, keys);
+    }
+}
+
+}
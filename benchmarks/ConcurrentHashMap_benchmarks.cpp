@@ -0,0 +1,57 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentHashMap_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:31:15
+ * ---------------------------------------------------
+ */
+
+#include <mutex>
+
+#include "Benchmark.hpp"
+#include "Workload.hpp"
+#include "UtilsCPP/ConcurrentHashMap.hpp"
+#include "UtilsCPP/HashMap.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int KEY_RANGE = 1 << 18;
+
+}
+
+// 98% lookups, 1% insert, 1% remove, half of the key range is filled up front
+BENCHMARK(ConcurrentHashMap_readMostly)
+{
+    for (unsigned int threadCount : threadCounts())
+    {
+        utils::ConcurrentHashMap<int, int> map;
+        for (int key = 0; key < KEY_RANGE; key += 2)
+            map.insert(key, key);
+        runMix(threadCount, KEY_RANGE, 98,
+            [&](int key) { int val; map.tryGet(key, val); },
+            [&](int key) { map.insert(key, key); },
+            [&](int key) { map.remove(key); });
+    }
+}
+
+BENCHMARK(MutexHashMap_readMostly)
+{
+    for (unsigned int threadCount : threadCounts())
+    {
+        utils::HashMap<int, int> map;
+        std::mutex mutex;
+        for (int key = 0; key < KEY_RANGE; key += 2)
+            map.insert(key, key);
+        runMix(threadCount, KEY_RANGE, 98,
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); map.contain(key); },
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); if (map.contain(key) == false) map.insert(key, key); },
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); map.remove(key); });
+    }
+}
+
+}
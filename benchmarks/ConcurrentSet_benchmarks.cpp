@@ -0,0 +1,57 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentSet_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 15:33:05
+ * ---------------------------------------------------
+ */
+
+#include <mutex>
+
+#include "Benchmark.hpp"
+#include "Workload.hpp"
+#include "UtilsCPP/ConcurrentSet.hpp"
+#include "UtilsCPP/Set.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int KEY_RANGE = 1 << 16;
+
+}
+
+// 90% contain, 5% insert, 5% remove on random keys, half of the key range is filled up front
+BENCHMARK(ConcurrentSet_mix)
+{
+    for (unsigned int threadCount : threadCounts())
+    {
+        utils::ConcurrentSet<int> set;
+        for (int key = 0; key < KEY_RANGE; key += 2)
+            set.insert(key);
+        runMix(threadCount, KEY_RANGE, 90,
+            [&](int key) { set.contain(key); },
+            [&](int key) { set.insert(key); },
+            [&](int key) { set.remove(key); });
+    }
+}
+
+BENCHMARK(MutexSet_mix)
+{
+    for (unsigned int threadCount : threadCounts())
+    {
+        utils::Set<int> set;
+        std::mutex mutex;
+        for (int key = 0; key < KEY_RANGE; key += 2)
+            set.insert((key * 7919) % KEY_RANGE); // shuffled, Set is not self-balancing
+        runMix(threadCount, KEY_RANGE, 90,
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); set.contain(key); },
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); if (set.contain(key) == false) set.insert(key); },
+            [&](int key) { std::lock_guard<std::mutex> lock(mutex); set.remove(set.find(key)); });
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * ---------------------------------------------------
+ * Filter_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 00:40:13
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/CuckooFilter.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/FilteredDictionary.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int KEY_COUNT = 1 << 18;
+constexpr int LOOKUP_COUNT = 1 << 21;
+
+// even keys spread over the int range, the missing ones are odd
+int keyAt(utils::uint32 i)
+{
+    return (int)(((i * 2654435761U) >> 1) & ~1U);
+}
+
+// 90% of the lookups miss
+template<typename Map>
+void lookups(const char* label, const Map& map, const std::vector<int>& probes)
+{
+    utils::uint64 found = 0;
+    Timer timer;
+    for (int i = 0; i < LOOKUP_COUNT; i++)
+        found += map.contain(probes[(std::size_t)i % probes.size()]) ? 1 : 0;
+    double seconds = timer.seconds();
+    report(label, LOOKUP_COUNT, seconds);
+    if (found == 0)
+        std::printf("  (no hit)\n");
+}
+
+}
+
+BENCHMARK(Filter_missingKeys)
+{
+    utils::Dictionary<int, int> dictionary;
+    utils::FilteredDictionary<int, int> bloomDictionary;
+    utils::FilteredDictionary<int, int, utils::CuckooFilter<int>> cuckooDictionary;
+    for (int i = 0; i < KEY_COUNT; i++)
+    {
+        int key = keyAt((utils::uint32)i);
+        dictionary.insert(key, i);
+        bloomDictionary.insert(key, i);
+        cuckooDictionary.insert(key, i);
+    }
+
+    std::vector<int> probes(1 << 16);
+    utils::uint32 seed = 0x2545F491;
+    for (std::size_t i = 0; i < probes.size(); i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = seed % 10 == 0 ? keyAt(seed % KEY_COUNT) : (int)((seed >> 1) | 1);
+    }
+
+    lookups("Dictionary contain", dictionary, probes);
+    lookups("FilteredDictionary<BloomFilter> contain", bloomDictionary, probes);
+    lookups("FilteredDictionary<CuckooFilter> contain", cuckooDictionary, probes);
+    std::printf("  BloomFilter %lu bytes, CuckooFilter %lu bytes\n",
+        (unsigned long)bloomDictionary.filter().memoryUsage(), (unsigned long)cuckooDictionary.filter().memoryUsage());
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+ * ---------------------------------------------------
+ * HashMap_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 17:31:44
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int LOOKUP_COUNT = 1 << 22;
+
+template<typename Map>
+void lookups(const char* label, Map& map, int keyCount)
+{
+    utils::uint32 state = 0x9E3779B9;
+    utils::uint64 found = 0;
+    Timer timer;
+    for (int i = 0; i < LOOKUP_COUNT; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        found += map.contain((int)(state % (utils::uint32)(keyCount * 2))) ? 1 : 0;
+    }
+    double seconds = timer.seconds();
+    report(label, LOOKUP_COUNT, seconds);
+    if (found == 0)
+        std::printf("  (no hit)\n");
+}
+
+}
+
+BENCHMARK(HashMap_lookup)
+{
+    for (int keyCount : { 1 << 10, 1 << 16, 1 << 20 })
+    {
+        utils::HashMap<int, int> hashMap;
+        utils::Dictionary<int, int> dictionary;
+        for (int i = 0; i < keyCount; i++)
+        {
+            int key = (int)(((utils::uint64)i * 2654435761u) % (utils::uint64)(keyCount * 2));
+            if (hashMap.contain(key))
+                continue;
+            hashMap.insert(key, i);
+            dictionary.insert(key, i);
+        }
+        char label[64];
+        std::snprintf(label, sizeof(label), "HashMap    %8d keys", keyCount);
+        lookups(label, hashMap, keyCount);
+        std::snprintf(label, sizeof(label), "Dictionary %8d keys", keyCount);
+        lookups(label, dictionary, keyCount);
+    }
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * ---------------------------------------------------
+ * Hash_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 18:20:12
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define HAS_CYCLE_COUNTER
+#endif
+
+namespace utils_benchmarks
+{
+
+BENCHMARK(Hash_bytes)
+{
+    std::vector<utils::byte> buffer((1 << 16) + 16);
+    for (size_t i = 0; i < buffer.size(); i++)
+        buffer[i] = (utils::byte)(i * 31);
+
+    for (utils::uint64 length : { 4, 8, 16, 32, 64, 256, 1024, 65536 })
+    {
+        utils::uint64 iterations = (utils::uint64(1) << 28) / (length + 32);
+        utils::uint64 sink = 0;
+        Timer timer;
+#ifdef HAS_CYCLE_COUNTER
+        utils::uint64 start = __rdtsc();
+#endif
+        for (utils::uint64 i = 0; i < iterations; i++)
+            sink += utils::hashBytes(buffer.data() + (i & 15), length);
+#ifdef HAS_CYCLE_COUNTER
+        double cycles = (double)(__rdtsc() - start);
+#endif
+        double seconds = timer.seconds();
+        double bytes = (double)iterations * (double)length;
+#ifdef HAS_CYCLE_COUNTER
+        std::printf("  %6lu bytes %10.2f GB/s %8.2f bytes/cycle %8.1f cycles/hash\n", length, bytes / seconds / 1e9, bytes / cycles, cycles / (double)iterations);
+#else
+        std::printf("  %6lu bytes %10.2f GB/s\n", length, bytes / seconds / 1e9);
+#endif
+        if (sink == 42)
+            std::printf("  (unlikely)\n");
+    }
+}
+
+}
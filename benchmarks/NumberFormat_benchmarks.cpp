@@ -0,0 +1,109 @@
+/*
+ * ---------------------------------------------------
+ * NumberFormat_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 03:58:41
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int NUMBER_COUNT = 1 << 20;
+
+}
+
+BENCHMARK(NumberFormat_integers)
+{
+    std::mt19937_64 rng(42);
+    std::vector<long long> values((std::size_t)NUMBER_COUNT);
+    for (long long& value : values)
+        value = (long long)(rng() >> (rng() % 64)) * ((rng() & 1) ? 1 : -1);
+    char buffer[utils::maxNumberLength];
+    utils::uint64 total = 0;
+
+    Timer snprintfTimer;
+    for (long long value : values)
+        total += (utils::uint64)std::snprintf(buffer, sizeof(buffer), "%lld", value);
+    report("snprintf %lld", NUMBER_COUNT, snprintfTimer.seconds());
+
+    Timer toStringTimer;
+    for (long long value : values)
+        total += std::to_string(value).size();
+    report("std::to_string", NUMBER_COUNT, toStringTimer.seconds());
+
+    Timer formatTimer;
+    for (long long value : values)
+        total += utils::formatInt(buffer, value);
+    report("formatInt", NUMBER_COUNT, formatTimer.seconds());
+
+    Timer hexTimer;
+    for (long long value : values)
+        total += utils::formatHex(buffer, (unsigned long long)value);
+    report("formatHex", NUMBER_COUNT, hexTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(NumberFormat_doubles)
+{
+    std::mt19937_64 rng(42);
+    std::vector<double> values((std::size_t)NUMBER_COUNT);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        // metrics like values: a few digits, and any double
+        if (i % 2 == 0)
+            values[i] = (double)(rng() % 1000000) / 100.0;
+        else
+        {
+            utils::uint64 bits = rng() & ~(utils::uint64(0x7FF) << 52);
+            bits |= (utils::uint64)(rng() % 2046 + 1) << 52;
+            std::memcpy(&values[i], &bits, sizeof(double));
+        }
+    }
+    char buffer[utils::maxNumberLength];
+    utils::uint64 total = 0;
+
+    Timer snprintfTimer;
+    for (double value : values)
+        total += (utils::uint64)std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    report("snprintf %.17g", NUMBER_COUNT, snprintfTimer.seconds());
+
+    Timer formatTimer;
+    for (double value : values)
+        total += utils::formatDouble(buffer, value);
+    report("formatDouble (shortest)", NUMBER_COUNT, formatTimer.seconds());
+
+    Timer floatTimer;
+    for (double value : values)
+        total += utils::formatFloat(buffer, (float)value);
+    report("formatFloat (shortest)", NUMBER_COUNT, floatTimer.seconds());
+
+    utils::StringBuilder builder(NUMBER_COUNT * 24);
+    Timer builderTimer;
+    for (double value : values)
+        builder.append(value).append(',');
+    report("StringBuilder::append(double)", NUMBER_COUNT, builderTimer.seconds());
+    total += builder.length();
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+}
@@ -0,0 +1,157 @@
+/*
+ * ---------------------------------------------------
+ * NumberParse_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 04:55:17
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/NumberParse.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int NUMBER_COUNT = 1 << 20;
+
+}
+
+BENCHMARK(NumberParse_integers)
+{
+    std::mt19937_64 rng(42);
+    std::vector<std::string> texts((std::size_t)NUMBER_COUNT);
+    char buffer[utils::maxNumberLength];
+    for (std::string& text : texts)
+    {
+        long long value = (long long)(rng() >> (rng() % 64)) * ((rng() & 1) ? 1 : -1);
+        text.assign(buffer, utils::formatInt(buffer, value));
+    }
+    long long total = 0;
+
+    Timer strtollTimer;
+    for (const std::string& text : texts)
+        total += std::strtoll(text.c_str(), nullptr, 10);
+    report("strtoll", NUMBER_COUNT, strtollTimer.seconds());
+
+    Timer stollTimer;
+    for (const std::string& text : texts)
+        total += std::stoll(text);
+    report("std::stoll", NUMBER_COUNT, stollTimer.seconds());
+
+    Timer parseTimer;
+    for (const std::string& text : texts)
+    {
+        long long value = 0;
+        utils::parseInt(utils::StringView(text.data(), text.size()), value);
+        total += value;
+    }
+    report("parseInt", NUMBER_COUNT, parseTimer.seconds());
+
+    if (total == 1)
+        std::printf("  (one)\n");
+}
+
+BENCHMARK(NumberParse_doubles)
+{
+    std::mt19937_64 rng(42);
+    std::vector<std::string> texts((std::size_t)NUMBER_COUNT);
+    char buffer[utils::maxNumberLength];
+    for (std::size_t i = 0; i < texts.size(); i++)
+    {
+        // metrics like values: a few digits, and any double in its shortest form
+        double value;
+        if (i % 2 == 0)
+            value = (double)(rng() % 1000000) / 100.0;
+        else
+        {
+            utils::uint64 bits = rng() & ~(utils::uint64(0x7FF) << 52);
+            bits |= (utils::uint64)(rng() % 2046 + 1) << 52;
+            std::memcpy(&value, &bits, sizeof(double));
+        }
+        texts[i].assign(buffer, utils::formatDouble(buffer, value));
+    }
+    double total = 0;
+
+    Timer strtodTimer;
+    for (const std::string& text : texts)
+        total += std::strtod(text.c_str(), nullptr);
+    report("strtod", NUMBER_COUNT, strtodTimer.seconds());
+
+    Timer stodTimer;
+    for (const std::string& text : texts)
+        total += std::stod(text);
+    report("std::stod", NUMBER_COUNT, stodTimer.seconds());
+
+    Timer parseTimer;
+    for (const std::string& text : texts)
+    {
+        double value = 0;
+        utils::parseDouble(utils::StringView(text.data(), text.size()), value);
+        total += value;
+    }
+    report("parseDouble", NUMBER_COUNT, parseTimer.seconds());
+
+    Timer floatTimer;
+    for (const std::string& text : texts)
+    {
+        float value = 0;
+        utils::parseFloat(utils::StringView(text.data(), text.size()), value);
+        total += (double)value;
+    }
+    report("parseFloat", NUMBER_COUNT, floatTimer.seconds());
+
+    if (total == 1)
+        std::printf("  (one)\n");
+}
+
+BENCHMARK(NumberParse_delimited)
+{
+    std::mt19937_64 rng(42);
+    utils::StringBuilder builder;
+    for (int i = 0; i < NUMBER_COUNT; i++)
+        builder.append((double)(rng() % 1000000) / 100.0).append(i + 1 < NUMBER_COUNT ? ", " : "\n");
+    utils::String csv = builder.build();
+    utils::uint64 total = 0;
+
+    Timer strtodTimer;
+    {
+        std::vector<double> values;
+        const char* it = csv;
+        for (char* end;; it = end + 1)
+        {
+            values.push_back(std::strtod(it, &end));
+            if (*end == '\0')
+                break;
+        }
+        total += values.size();
+    }
+    report("strtod loop into std::vector", NUMBER_COUNT, strtodTimer.seconds());
+
+    Timer parseTimer;
+    {
+        utils::Array<double> values;
+        utils::parseDelimited(csv, ',', values);
+        total += values.length();
+    }
+    report("parseDelimited into Array", NUMBER_COUNT, parseTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+}
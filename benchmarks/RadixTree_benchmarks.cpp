@@ -0,0 +1,97 @@
+/*
+ * ---------------------------------------------------
+ * RadixTree_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 22:58:13
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/RadixTree.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int KEY_COUNT = 1 << 17;
+constexpr int LOOKUP_COUNT = 1 << 21;
+
+// url like keys sharing long prefixes: /api/v<n>/<resource>/<id>
+std::vector<utils::String> urlKeys()
+{
+    const char* resources[] = { "users", "groups", "projects", "issues", "comments", "attachments", "settings", "tokens" };
+    std::vector<utils::String> keys;
+    utils::uint32 state = 0x9E3779B9;
+    char buffer[64];
+    for (int i = 0; i < KEY_COUNT; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        std::snprintf(buffer, sizeof(buffer), "/api/v%u/%s/%u", state % 3, resources[(state >> 8) % 8], state >> 11);
+        keys.emplace_back(buffer);
+    }
+    return keys;
+}
+
+template<typename Find>
+void lookups(const char* label, const std::vector<utils::String>& keys, const Find& find)
+{
+    utils::uint32 state = 0x2545F491;
+    utils::uint64 found = 0;
+    Timer timer;
+    for (int i = 0; i < LOOKUP_COUNT; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        found += find(keys[state % (utils::uint32)keys.size()]) ? 1 : 0;
+    }
+    double seconds = timer.seconds();
+    report(label, LOOKUP_COUNT, seconds);
+    if (found == 0)
+        std::printf("  (no hit)\n");
+}
+
+}
+
+BENCHMARK(RadixTree_lookup)
+{
+    std::vector<utils::String> keys = urlKeys();
+    utils::RadixTree<int> tree;
+    utils::HashMap<utils::String, int> hashMap;
+    utils::Dictionary<utils::String, int> dictionary;
+    for (int i = 0; i < KEY_COUNT; i++)
+    {
+        if (tree.contain(keys[i]))
+            continue;
+        tree.insert(keys[i], i);
+        hashMap.insert(keys[i], i);
+        dictionary.insert(keys[i], i);
+    }
+    std::printf("  %-40s %10.2f bytes/key\n", "RadixTree memory", (double)tree.memoryUsage() / (double)tree.size());
+
+    lookups("RadixTree", keys, [&](const utils::String& key) { return tree.contain(key); });
+    lookups("HashMap", keys, [&](const utils::String& key) { return hashMap.contain(key); });
+    lookups("Dictionary", keys, [&](const utils::String& key) { return dictionary.contain(key); });
+
+    Timer timer;
+    utils::uint64 matches = 0;
+    const int prefixQueries = 1000;
+    for (int i = 0; i < prefixQueries; i++)
+        tree.forEachWithPrefix(keys[(utils::uint64)i * 97 % keys.size()].substr(0, 16), [&](const utils::RadixTree<int>::KeyValPair&) { matches++; });
+    double seconds = timer.seconds();
+    std::printf("  %-40s %10.2f us/query (%llu matches)\n", "RadixTree prefix iteration", seconds * 1e6 / prefixQueries, (unsigned long long)matches);
+}
+
+}
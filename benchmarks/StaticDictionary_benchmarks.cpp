@@ -0,0 +1,98 @@
+/*
+ * ---------------------------------------------------
+ * StaticDictionary_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 21:48:57
+ * ---------------------------------------------------
+ */
+
+#include <cstring>
+#include <cstdio>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/StaticDictionary.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int LOOKUP_COUNT = 1 << 22;
+
+constexpr utils::StaticEntry<int> headerEntries[] = {
+    { "accept", 0 }, { "accept-charset", 1 }, { "accept-encoding", 2 }, { "accept-language", 3 },
+    { "accept-ranges", 4 }, { "age", 5 }, { "allow", 6 }, { "authorization", 7 }, { "cache-control", 8 },
+    { "connection", 9 }, { "content-disposition", 10 }, { "content-encoding", 11 }, { "content-language", 12 },
+    { "content-length", 13 }, { "content-location", 14 }, { "content-range", 15 }, { "content-type", 16 },
+    { "cookie", 17 }, { "date", 18 }, { "etag", 19 }, { "expect", 20 }, { "expires", 21 }, { "from", 22 },
+    { "host", 23 }, { "if-match", 24 }, { "if-modified-since", 25 }, { "if-none-match", 26 },
+    { "if-range", 27 }, { "if-unmodified-since", 28 }, { "last-modified", 29 }, { "link", 30 },
+    { "location", 31 }, { "max-forwards", 32 }, { "origin", 33 }, { "pragma", 34 },
+    { "proxy-authenticate", 35 }, { "proxy-authorization", 36 }, { "range", 37 }, { "referer", 38 },
+    { "refresh", 39 }, { "retry-after", 40 }, { "server", 41 }, { "set-cookie", 42 },
+    { "strict-transport-security", 43 }, { "transfer-encoding", 44 }, { "upgrade", 45 },
+    { "user-agent", 46 }, { "vary", 47 }, { "via", 48 }, { "www-authenticate", 49 },
+};
+
+constexpr int HEADER_COUNT = sizeof(headerEntries) / sizeof(headerEntries[0]);
+
+constexpr utils::StaticDictionary<int, HEADER_COUNT> staticHeaders(headerEntries);
+
+// lookups of known header names mixed with unknown ones
+template<typename Find>
+void lookups(const char* label, const utils::String* names, int nameCount, const Find& find)
+{
+    utils::uint32 state = 0x9E3779B9;
+    utils::uint64 sum = 0;
+    Timer timer;
+    for (int i = 0; i < LOOKUP_COUNT; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        sum += (utils::uint64)find(names[state % (utils::uint32)nameCount]);
+    }
+    double seconds = timer.seconds();
+    report(label, LOOKUP_COUNT, seconds);
+    if (sum == 0)
+        std::printf("  (no hit)\n");
+}
+
+}
+
+BENCHMARK(StaticDictionary_lookup)
+{
+    utils::Dictionary<utils::String, int> dictionary;
+    utils::HashMap<utils::String, int> hashMap;
+    utils::String names[HEADER_COUNT + 8];
+    int nameCount = 0;
+    for (const auto& entry : headerEntries)
+    {
+        dictionary.insert(entry.key, entry.val);
+        hashMap.insert(entry.key, entry.val);
+        names[nameCount++] = entry.key;
+    }
+    for (const char* unknown : { "x-request-id", "x-forwarded-for", "dnt", "te", "trailer", "warning", "forwarded", "prefer" })
+        names[nameCount++] = unknown;
+
+    lookups("StaticDictionary", names, nameCount, [&](const utils::String& name) {
+        const int* val = staticHeaders.find(name);
+        return val != nullptr ? *val : -1;
+    });
+    lookups("HashMap", names, nameCount, [&](const utils::String& name) {
+        auto it = hashMap.find(name);
+        return it != hashMap.end() ? it->val : -1;
+    });
+    lookups("Dictionary", names, nameCount, [&](const utils::String& name) {
+        auto it = dictionary.find(name);
+        return it != dictionary.end() ? it->val : -1;
+    });
+}
+
+}
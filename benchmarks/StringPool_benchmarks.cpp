@@ -0,0 +1,112 @@
+/*
+ * ---------------------------------------------------
+ * StringPool_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 06:14:20
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringPool.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int NAME_COUNT = 4000;
+constexpr int REFERENCE_COUNT = 1 << 20;
+
+}
+
+BENCHMARK(StringPool_tags)
+{
+    std::vector<std::string> names;
+    for (int i = 0; i < NAME_COUNT; i++)
+        names.push_back("service.component.metric_name_" + std::to_string(i));
+    std::mt19937 rng(42);
+    std::vector<int> references((std::size_t)REFERENCE_COUNT);
+    for (int& reference : references)
+        reference = (int)(rng() % NAME_COUNT);
+    utils::uint64 total = 0;
+
+    // the names as they come from the parsed input
+    std::vector<utils::StringView> inputs;
+    for (int reference : references)
+        inputs.emplace_back(names[(std::size_t)reference].data(), names[(std::size_t)reference].size());
+
+    Timer stringTimer;
+    std::vector<utils::String> strings;
+    strings.reserve(inputs.size());
+    for (utils::StringView input : inputs)
+        strings.emplace_back(input);
+    report("String copies", REFERENCE_COUNT, stringTimer.seconds());
+
+    utils::StringPool pool;
+    Timer internTimer;
+    std::vector<utils::InternedString> handles;
+    handles.reserve(inputs.size());
+    for (utils::StringView input : inputs)
+        handles.push_back(pool.intern(input));
+    report("StringPool::intern", REFERENCE_COUNT, internTimer.seconds());
+
+    utils::StringPool cachedPool(true);
+    Timer cachedTimer;
+    for (utils::StringView input : inputs)
+        total += cachedPool.intern(input).length();
+    report("StringPool::intern with thread cache", REFERENCE_COUNT, cachedTimer.seconds());
+
+    utils::uint64 stringBytes = strings.size() * sizeof(utils::String);
+    for (const utils::String& string : strings)
+        stringBytes += string.capacity();
+    std::printf("  memory: %.1f MB of Strings, %.1f MB of handles + %.2f MB of pool\n", (double)stringBytes / 1e6,
+        (double)(handles.size() * sizeof(utils::InternedString)) / 1e6, (double)pool.memoryUsage() / 1e6);
+
+    utils::Dictionary<utils::String, int> stringDictionary;
+    utils::Dictionary<utils::InternedString, int> internedDictionary;
+    utils::HashMap<utils::String, int> stringMap;
+    utils::HashMap<utils::InternedString, int> internedMap;
+    for (int i = 0; i < NAME_COUNT; i++)
+    {
+        stringDictionary.insert(utils::String(names[(std::size_t)i].c_str()), i);
+        internedDictionary.insert(pool.intern(names[(std::size_t)i].c_str()), i);
+        stringMap.insert(utils::String(names[(std::size_t)i].c_str()), i);
+        internedMap.insert(pool.intern(names[(std::size_t)i].c_str()), i);
+    }
+
+    Timer stringDictionaryTimer;
+    for (const utils::String& string : strings)
+        total += (utils::uint64)stringDictionary[string];
+    report("Dictionary<String> lookup", REFERENCE_COUNT, stringDictionaryTimer.seconds());
+
+    Timer internedDictionaryTimer;
+    for (utils::InternedString handle : handles)
+        total += (utils::uint64)internedDictionary[handle];
+    report("Dictionary<InternedString> lookup", REFERENCE_COUNT, internedDictionaryTimer.seconds());
+
+    Timer stringMapTimer;
+    for (const utils::String& string : strings)
+        total += (utils::uint64)stringMap[string];
+    report("HashMap<String> lookup", REFERENCE_COUNT, stringMapTimer.seconds());
+
+    Timer internedMapTimer;
+    for (utils::InternedString handle : handles)
+        total += (utils::uint64)internedMap[handle];
+    report("HashMap<InternedString> lookup", REFERENCE_COUNT, internedMapTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+}
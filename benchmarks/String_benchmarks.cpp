@@ -0,0 +1,434 @@
+/*
+ * ---------------------------------------------------
+ * String_benchmarks.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 01:12:45
+ * ---------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/Rope.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+namespace
+{
+
+constexpr int STRING_COUNT = 1 << 20;
+
+// previous Hash<String>, hashing the characters on every call
+struct UncachedHash
+{
+    inline utils::uint64 operator () (const utils::String& str) const { return utils::hashBytes((const char*)str, str.length()); }
+};
+
+}
+
+BENCHMARK(String_construction)
+{
+    std::vector<utils::String> keys;
+    keys.reserve(STRING_COUNT);
+
+    Timer numberTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+        keys.push_back(utils::String::fromUInt((utils::uint32)i * 2654435761U));
+    report("fromUInt", STRING_COUNT, numberTimer.seconds());
+
+    utils::uint64 total = 0;
+    Timer copyTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+    {
+        utils::String copy = keys[(std::size_t)i];
+        total += copy.length();
+    }
+    report("copy short String", STRING_COUNT, copyTimer.seconds());
+
+    std::vector<utils::String> descriptions((std::size_t)STRING_COUNT);
+    Timer copiedTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+        descriptions[(std::size_t)i] = utils::String("an error description too long for the inline buffer");
+    report("String from a long C string", STRING_COUNT, copiedTimer.seconds());
+
+    Timer literalTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+        descriptions[(std::size_t)i] = utils::String::literal("an error description too long for the inline buffer");
+    report("String::literal", STRING_COUNT, literalTimer.seconds());
+
+    utils::Dictionary<utils::String, int> dictionary;
+    Timer dictionaryTimer;
+    for (int i = 0; i < STRING_COUNT / 4; i++)
+        dictionary.insertOrAssign(keys[(std::size_t)i], i);
+    report("Dictionary<String, int> insert short keys", STRING_COUNT / 4, dictionaryTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_keyValueParsing)
+{
+    utils::String line("  configuration.entry.name = a value long enough to allocate  ");
+    utils::uint64 total = 0;
+
+    Timer copyTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+    {
+        utils::String::Index equal = utils::StringView(line).indexOf('=');
+        utils::String key(utils::StringView(line).substr(0, equal).trim());
+        utils::String value(utils::StringView(line).substr(equal + 1).trim());
+        total += key.length() + value.length();
+    }
+    report("split key = value into Strings", STRING_COUNT, copyTimer.seconds());
+
+    Timer viewTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+    {
+        utils::StringView view = line;
+        utils::StringView::Index equal = view.indexOf('=');
+        utils::StringView key = view.substr(0, equal).trim();
+        utils::StringView value = view.substr(equal + 1).trim();
+        total += key.length() + value.length() + (utils::uint64)(key.data() - value.data());
+    }
+    report("split key = value into StringViews", STRING_COUNT, viewTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_concatenation)
+{
+    utils::String name("some.configuration.entry");
+    utils::String value("a value long enough to allocate");
+    utils::uint64 total = 0;
+
+    Timer copyTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+    {
+        utils::String line = utils::String(name) + " = " + value + "; " + utils::String::fromUInt((utils::uint32)i);
+        total += line.length();
+    }
+    report("String operator + chain", STRING_COUNT, copyTimer.seconds());
+
+    Timer builderTimer;
+    for (int i = 0; i < STRING_COUNT; i++)
+    {
+        utils::StringBuilder builder(64);
+        builder.append(name).append(" = ").append(value).append("; ").append((utils::uint32)i);
+        utils::String line = builder.build();
+        total += line.length();
+    }
+    report("StringBuilder", STRING_COUNT, builderTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_middleInsert)
+{
+    constexpr int INSERT_COUNT = 20000;
+    utils::String text;
+    for (int i = 0; i < 1 << 14; i++)
+        text.append("some text line\n");
+    utils::Rope rope(text);
+
+    Timer stringTimer;
+    for (int i = 0; i < INSERT_COUNT; i++)
+    {
+        utils::String::Index pos = text.length() / 2;
+        text = utils::String(utils::StringView(text).substr(0, pos)) + "inserted" + utils::String(utils::StringView(text).substr(pos));
+    }
+    report("String insert in the middle", INSERT_COUNT, stringTimer.seconds());
+
+    Timer ropeTimer;
+    for (int i = 0; i < INSERT_COUNT; i++)
+        rope.insert(rope.length() / 2, "inserted");
+    report("Rope insert in the middle", INSERT_COUNT, ropeTimer.seconds());
+
+    if (rope.length() != text.length())
+        std::printf("  (length mismatch)\n");
+}
+
+BENCHMARK(String_search)
+{
+    constexpr int SEARCH_COUNT = 8;
+    std::string log;
+    for (int i = 0; log.size() < (16 << 20); i++)
+        log += "2026-10-20 05:12:" + std::to_string(i % 60) + " INFO request handled path=/api/items/" + std::to_string(i) + " status=200\n";
+    log += "2026-10-20 05:13:00 ERROR timeout path=/api/items status=504\n";
+    utils::StringView view(log.data(), log.size());
+    utils::uint64 total = 0;
+
+    // ops are bytes, Mops/s is MB/s
+
+    Timer stdCountTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+        total += (utils::uint64)std::count(log.begin(), log.end(), '\n');
+    report("std::count lines", (double)SEARCH_COUNT * log.size(), stdCountTimer.seconds());
+
+    Timer countTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+        total += view.count('\n');
+    report("StringView::count lines", (double)SEARCH_COUNT * log.size(), countTimer.seconds());
+
+    // previous String::lastIndexOf, a backwards loop over the characters
+    Timer loopTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+    {
+        for (utils::uint64 idx = log.size(); idx > 0; idx--)
+        {
+            if (log[idx - 1] == '#')
+            {
+                total += idx;
+                break;
+            }
+        }
+    }
+    report("backwards loop lastIndexOf (absent)", (double)SEARCH_COUNT * log.size(), loopTimer.seconds());
+
+    Timer lastTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+        total += view.lastIndexOf('#');
+    report("StringView::lastIndexOf (absent)", (double)SEARCH_COUNT * log.size(), lastTimer.seconds());
+
+    // a pattern starting with a rare character, then one starting with a frequent one
+    const char* patterns[] = { "ERROR timeout", "status=504" };
+    for (const char* pattern : patterns)
+    {
+        std::printf("  \"%s\"\n", pattern);
+        Timer stdFindTimer;
+        for (int i = 0; i < SEARCH_COUNT; i++)
+            total += log.find(pattern, (std::size_t)i);
+        report("std::string::find", (double)SEARCH_COUNT * log.size(), stdFindTimer.seconds());
+
+        Timer strstrTimer;
+        for (int i = 0; i < SEARCH_COUNT; i++)
+            total += (utils::uint64)(std::strstr(log.c_str() + i, pattern) - log.c_str());
+        report("strstr", (double)SEARCH_COUNT * log.size(), strstrTimer.seconds());
+
+        Timer findTimer;
+        for (int i = 0; i < SEARCH_COUNT; i++)
+            total += view.indexOf(pattern, (utils::uint64)i);
+        report("StringView::indexOf", (double)SEARCH_COUNT * log.size(), findTimer.seconds());
+    }
+
+    Timer stdAnyTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+        total += log.find_first_of("#!|");
+    report("std::string::find_first_of (absent)", (double)SEARCH_COUNT * log.size(), stdAnyTimer.seconds());
+
+    Timer anyTimer;
+    for (int i = 0; i < SEARCH_COUNT; i++)
+        total += view.findAnyOf("#!|");
+    report("StringView::findAnyOf (absent)", (double)SEARCH_COUNT * log.size(), anyTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_split)
+{
+    constexpr int LINE_COUNT = 1 << 18;
+    utils::StringBuilder builder;
+    for (int i = 0; i < LINE_COUNT; i++)
+        builder.append("cpu,host=server").append(i % 100).append(",region=eu-west usage_user=").append(i % 1000).append(".5,usage_system=2.25 1700000000").append(i).append("\n");
+    utils::String text = builder.build();
+    std::string stdText(text, text.length());
+    utils::uint64 total = 0;
+
+    // the line, its 3 space separated sections and the comma separated fields of the first two
+
+    Timer streamTimer;
+    {
+        std::istringstream stream(stdText);
+        std::string line, section, field;
+        while (std::getline(stream, line))
+        {
+            std::istringstream sections(line);
+            for (int i = 0; i < 2 && std::getline(sections, section, ' '); i++)
+            {
+                std::istringstream fields(section);
+                while (std::getline(fields, field, ','))
+                    total += field.size();
+            }
+        }
+    }
+    report("std::getline lines", LINE_COUNT, streamTimer.seconds());
+
+    // one String per field, like with indexOf and substr on Strings
+    Timer copyTimer;
+    for (utils::StringView line : text.lines())
+    {
+        utils::String rest(line);
+        for (int i = 0; i < 2; i++)
+        {
+            utils::String::Index space = rest.indexOf(' ');
+            utils::String section = utils::String(rest.substr(0, space));
+            rest = utils::String(rest.substr(space + 1, rest.length()));
+            for (utils::String::Index start = 0, comma = 0; comma != utils::StringView::npos; start = comma + 1)
+            {
+                comma = section.indexOf(',', start);
+                total += utils::String(section.substr(start, comma - start)).length();
+            }
+        }
+    }
+    report("String copies lines", LINE_COUNT, copyTimer.seconds());
+
+    Timer splitTimer;
+    for (utils::StringView line : text.lines())
+    {
+        int i = 0;
+        for (utils::StringView section : line.split(' '))
+        {
+            if (i++ == 2)
+                break;
+            for (utils::StringView field : section.split(','))
+                total += field.length();
+        }
+    }
+    report("split views lines", LINE_COUNT, splitTimer.seconds());
+
+    utils::Array<utils::StringView> sections;
+    utils::Array<utils::StringView> fields;
+    Timer intoTimer;
+    for (utils::StringView line : text.lines())
+    {
+        line.splitInto(' ', sections);
+        for (int i = 0; i < 2; i++)
+        {
+            sections[(utils::uint64)i].splitInto(',', fields);
+            for (utils::StringView field : fields)
+                total += field.length();
+        }
+    }
+    report("splitInto reused Arrays lines", LINE_COUNT, intoTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_fileLoading)
+{
+    constexpr int FILE_SIZE = 32 << 20;
+    constexpr int LOAD_COUNT = 8;
+    const char* path = "UtilsCPP_benchmark_file.txt";
+    {
+        std::ofstream file(path);
+        std::string line("some.configuration.entry = a value of the configuration\n");
+        for (int size = 0; size < FILE_SIZE; size += (int)line.size())
+            file << line;
+    }
+    utils::uint64 total = 0;
+
+    // ops are bytes, Mops/s is MB/s
+
+    // previous implementation, one istream::get and one String::append per character
+    Timer characterTimer;
+    for (int i = 0; i < LOAD_COUNT; i++)
+    {
+        std::ifstream file(path);
+        utils::String content;
+        for (int c = file.get(); c != std::ifstream::traits_type::eof(); c = file.get())
+            content.append((char)c);
+        total += content.length();
+    }
+    report("istream::get per character", (double)LOAD_COUNT * FILE_SIZE, characterTimer.seconds());
+
+    Timer fileTimer;
+    for (int i = 0; i < LOAD_COUNT; i++)
+        total += utils::String::contentOfFile(path).length();
+    report("String::contentOfFile", (double)LOAD_COUNT * FILE_SIZE, fileTimer.seconds());
+
+    utils::String buffer;
+    Timer reuseTimer;
+    for (int i = 0; i < LOAD_COUNT; i++)
+    {
+        utils::String::contentOfFile(path, buffer);
+        total += buffer.length();
+    }
+    report("contentOfFile in a reused String", (double)LOAD_COUNT * FILE_SIZE, reuseTimer.seconds());
+
+    std::remove(path);
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+BENCHMARK(String_hashLookup)
+{
+    constexpr int KEY_COUNT = 1 << 12;
+    constexpr int ROUNDS = 256;
+
+    std::vector<utils::String> keys;
+    for (int i = 0; i < KEY_COUNT; i++)
+        keys.push_back(utils::String("/usr/share/application/resources/localization/entry_") + utils::String::fromInt(i));
+    utils::HashMap<utils::String, int, UncachedHash> uncachedMap;
+    utils::HashMap<utils::String, int> cachedMap;
+    for (int i = 0; i < KEY_COUNT; i++)
+    {
+        uncachedMap.insert(keys[i], i);
+        cachedMap.insert(keys[i], i);
+    }
+    // looked up with other objects than the stored keys, the same ones each round
+    std::vector<utils::String> lookups(keys.begin(), keys.end());
+    long long total = 0;
+
+    Timer uncachedTimer;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (const utils::String& key : lookups)
+            total += uncachedMap.find(key)->val;
+    }
+    report("HashMap<String> lookup, hash on every call", (double)ROUNDS * KEY_COUNT, uncachedTimer.seconds());
+
+    Timer cachedTimer;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (const utils::String& key : lookups)
+            total += cachedMap.find(key)->val;
+    }
+    report("HashMap<String> lookup, cached hash", (double)ROUNDS * KEY_COUNT, cachedTimer.seconds());
+
+    // previous implementation, a loop over the characters
+    Timer characterTimer;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < KEY_COUNT; i++)
+        {
+            const utils::String& a = keys[i];
+            const utils::String& b = lookups[(i + r) % KEY_COUNT];
+            bool equal = a.length() == b.length();
+            for (utils::String::Size c = 0; equal && c < a.length(); c++)
+                equal = a[c] == b[c];
+            total += equal;
+        }
+    }
+    report("String == character loop", (double)ROUNDS * KEY_COUNT, characterTimer.seconds());
+
+    Timer compareTimer;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < KEY_COUNT; i++)
+            total += keys[i] == lookups[(i + r) % KEY_COUNT];
+    }
+    report("String == length, hashes, memcmp", (double)ROUNDS * KEY_COUNT, compareTimer.seconds());
+
+    if (total == 0)
+        std::printf("  (empty)\n");
+}
+
+}
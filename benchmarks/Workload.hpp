@@ -0,0 +1,78 @@
+/*
+ * ---------------------------------------------------
+ * Workload.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:22:40
+ * ---------------------------------------------------
+ */
+
+#ifndef WORKLOAD_HPP
+# define WORKLOAD_HPP
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils_benchmarks
+{
+
+constexpr int OPERATIONS_PER_THREAD = 1 << 20;
+
+inline utils::uint32 nextRandom(utils::uint32& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// containPercent% contain, the rest split between insert and remove, on random keys in [0, keyRange)
+template<typename Contain, typename Insert, typename Remove>
+void runMix(unsigned int threadCount, int keyRange, utils::uint32 containPercent, const Contain& contain, const Insert& insert, const Remove& remove)
+{
+    std::vector<std::thread> threads;
+    Timer timer;
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]() {
+            utils::uint32 state = 0x9E3779B9 * (t + 1);
+            utils::uint32 insertLimit = containPercent + (100 - containPercent) / 2;
+            for (int i = 0; i < OPERATIONS_PER_THREAD; i++)
+            {
+                utils::uint32 random = nextRandom(state);
+                int key = (int)((random >> 8) % (utils::uint32)keyRange);
+                utils::uint32 operation = random % 100;
+                if (operation < containPercent)
+                    contain(key);
+                else if (operation < insertLimit)
+                    insert(key);
+                else
+                    remove(key);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    char label[64];
+    std::snprintf(label, sizeof(label), "%u thread(s)", threadCount);
+    report(label, (double)threadCount * OPERATIONS_PER_THREAD, timer.seconds());
+}
+
+// 1, 2, 4... up to the number of hardware threads
+inline std::vector<unsigned int> threadCounts()
+{
+    unsigned int maxThreads = std::thread::hardware_concurrency();
+    std::vector<unsigned int> counts;
+    for (unsigned int count = 1; count < maxThreads; count *= 2)
+        counts.push_back(count);
+    counts.push_back(maxThreads == 0 ? 1 : maxThreads);
+    return counts;
+}
+
+}
+
+#endif // WORKLOAD_HPP
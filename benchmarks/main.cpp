@@ -0,0 +1,29 @@
+/*
+ * ---------------------------------------------------
+ * main.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 15:26:52
+ * ---------------------------------------------------
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "Benchmark.hpp"
+
+// usage: UtilsCPP_benchmark [filter...], runs the benchmarks whose name contains one of the filters
+int main(int argc, char* argv[])
+{
+    for (const auto& benchmark : utils_benchmarks::Benchmark::all())
+    {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc && selected == false; i++)
+            selected = std::strstr(benchmark.name, argv[i]) != nullptr;
+        if (selected == false)
+            continue;
+        std::printf("%s\n", benchmark.name);
+        benchmark.function();
+    }
+    return 0;
+}
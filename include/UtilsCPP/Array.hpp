@@ -14,10 +14,12 @@
 #include "UtilsCPP/Types.hpp"
 #include "UtilsCPP/Func.hpp"
 #include "UtilsCPP/Functions.hpp"
+#include "UtilsCPP/Hash.hpp"
 
 #include <initializer_list>
 #include <utility>
 #include <new>
+#include <type_traits>
 
 namespace utils
 {
@@ -219,19 +221,34 @@ public:
         m_buffer = (Element*)operator new (sizeof(Element) * m_capacity);
     }
 
+    // destroy the elements from index length, keeping the capacity to refill the array without allocating
+    void truncate(Size length)
+    {
+        for (Size i = length; i < m_length; ++i)
+            m_buffer[i].~Element();
+        if (length < m_length)
+            m_length = length;
+    }
+
     inline       Element& last()        { return m_buffer[m_length - 1]; }
     inline const Element& last()  const { return m_buffer[m_length - 1]; }
     inline       Element& first()       { return m_buffer[0]; }
     inline const Element& first() const { return m_buffer[0]; }
 
-    void sort()
+    inline void sort() { sort([](const Element& a, const Element& b) { return a < b; }); }
+
+    template<typename Less>
+    void sort(const Less& isLess)
     {
+        if (m_length < 2)
+            return;
         Func<Index(Index, Index)> partition = [&](Index l, Index r) -> Index {
+            swap((*this)[l + (r - l) / 2], (*this)[r]); // middle pivot, avoid the quadratic case on sorted input
             Element& pivot = (*this)[r];
             Index pivotDst = l;
             for (Index i = l; i < r; i++)
             {
-                if ((*this)[i] < pivot)
+                if (isLess((*this)[i], pivot))
                     swap((*this)[pivotDst++], (*this)[i]);
             }
             swap((*this)[pivotDst], pivot);
@@ -465,6 +482,30 @@ public:
     };
 };
 
+// arrays of integers are hashed as one block of bytes, other element types are hashed one by one
+template<typename T>
+struct Hash<Array<T>>
+{
+    uint64 seed = 0;
+
+    Hash() = default;
+    explicit Hash(uint64 s) : seed(s) {}
+
+    uint64 operator () (const Array<T>& array) const { return hash(array, std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value>()); }
+
+private:
+    inline uint64 hash(const Array<T>& array, std::true_type) const { return hashBytes((const T*)array, array.length() * sizeof(T), seed); }
+
+    uint64 hash(const Array<T>& array, std::false_type) const
+    {
+        Hash<T> elementHash;
+        uint64 result = hashInteger(array.length(), seed);
+        for (const T& element : array)
+            result = hashCombine(result, elementHash(element));
+        return result;
+    }
+};
+
 }
 
 #endif // ARRAY_HPP
\ No newline at end of file
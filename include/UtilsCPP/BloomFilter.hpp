@@ -0,0 +1,247 @@
+/*
+ * ---------------------------------------------------
+ * BloomFilter.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 23:31:07
+ * ---------------------------------------------------
+ */
+
+#ifndef BLOOMFILTER_HPP
+# define BLOOMFILTER_HPP
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace utils
+{
+
+// Probabilistic set answering "definitely not present" or "maybe present", used in front of a
+// slower container so most of the lookups of missing keys stop after a single cache miss.
+// The filter is blocked: a key only sets bits of one 64 bytes block (one bit in each of its
+// 8 words), so an insert or a lookup touches a single cache line and the 8 bit tests have no
+// dependency between them. Keys can't be removed (see CuckooFilter).
+// A moved from filter has no blocks and a capacity of 0, it contains nothing and allocates on the next insert.
+template<typename T, typename Hash = utils::Hash<T>>
+class BloomFilter
+{
+public:
+    using Size = uint64;
+
+    static constexpr bool canRemove = false;
+
+public:
+    BloomFilter() : BloomFilter(0) {}
+    BloomFilter(const BloomFilter& cp) : m_hash(cp.m_hash), m_falsePositiveRate(cp.m_falsePositiveRate), m_capacity(cp.m_capacity), m_size(cp.m_size)
+    {
+        if (cp.m_blocks == nullptr)
+            return;
+        allocate(cp.m_blockCount);
+        std::memcpy(m_blocks, cp.m_blocks, sizeof(Block) * m_blockCount);
+    }
+    BloomFilter(BloomFilter&& mv) noexcept
+        : m_hash(std::move(mv.m_hash)), m_falsePositiveRate(mv.m_falsePositiveRate), m_capacity(mv.m_capacity), m_size(mv.m_size),
+          m_memory(mv.m_memory), m_blocks(mv.m_blocks), m_blockCount(mv.m_blockCount)
+    {
+        mv.m_memory = nullptr;
+        mv.m_blocks = nullptr;
+        mv.m_blockCount = 0;
+        mv.m_capacity = 0;
+        mv.m_size = 0;
+    }
+
+    // sized for capacity keys with the given false positive rate, more keys can be inserted
+    // but the false positive rate grows with them
+    explicit BloomFilter(Size capacity, double falsePositiveRate = 0.01, const Hash& hash = Hash()) : m_hash(hash), m_falsePositiveRate(falsePositiveRate)
+    {
+        allocate(blockCountFor(capacity));
+        m_capacity = capacity;
+    }
+
+    // bulk build, sized for the keys of the array
+    explicit BloomFilter(const Array<T>& keys, double falsePositiveRate = 0.01, const Hash& hash = Hash()) : BloomFilter(keys.length(), falsePositiveRate, hash)
+    {
+        insertMany((const T*)keys, keys.length());
+    }
+
+    inline Size size() const { return m_size; }
+    inline bool isEmpty() const { return m_size == 0; }
+    inline Size capacity() const { return m_capacity; }
+    inline double falsePositiveRate() const { return m_falsePositiveRate; }
+    inline Size memoryUsage() const { return sizeof(BloomFilter) + sizeof(Block) * m_blockCount; }
+
+    // always succeed, a bloom filter is never full
+    template<typename K>
+    inline bool insert(const K& key)
+    {
+        if (m_blocks == nullptr)
+            reset(0);
+        uint64 hash = m_hash(key);
+        set(m_blocks[blockIndex(hash)], hash);
+        m_size++;
+        return true;
+    }
+
+    // hash all the keys of a group first and prefetch their blocks, then set the bits
+    template<typename K>
+    void insertMany(const K* keys, Size count)
+    {
+        if (m_blocks == nullptr)
+            reset(count);
+        uint64 hashes[s_insertBatch];
+        for (Size first = 0; first < count; first += s_insertBatch)
+        {
+            Size batch = count - first < s_insertBatch ? count - first : s_insertBatch;
+            for (Size i = 0; i < batch; i++)
+            {
+                hashes[i] = m_hash(keys[first + i]);
+                UTILSCPP_PREFETCH(m_blocks + blockIndex(hashes[i]));
+            }
+            for (Size i = 0; i < batch; i++)
+                set(m_blocks[blockIndex(hashes[i])], hashes[i]);
+        }
+        m_size += count;
+    }
+
+    // false if the key was never inserted, true if it was or with a probability of about falsePositiveRate
+    template<typename K>
+    inline bool mayContain(const K& key) const
+    {
+        if (m_blocks == nullptr)
+            return false;
+        uint64 hash = m_hash(key);
+        return test(m_blocks[blockIndex(hash)], hash);
+    }
+
+    void clear()
+    {
+        if (m_blocks != nullptr)
+            std::memset(m_blocks, 0, sizeof(Block) * m_blockCount);
+        m_size = 0;
+    }
+
+    // clear and resize the filter for a new capacity, keeping the hash and the false positive rate
+    void reset(Size capacity)
+    {
+        Size blockCount = blockCountFor(capacity);
+        if (blockCount != m_blockCount)
+        {
+            void* memory = m_memory;
+            allocate(blockCount);
+            operator delete (memory);
+        }
+        else
+            clear();
+        m_capacity = capacity;
+        m_size = 0;
+    }
+
+    ~BloomFilter()
+    {
+        operator delete (m_memory);
+    }
+
+private:
+    static constexpr Size s_wordCount = 8;
+    static constexpr Size s_blockSize = 64;
+    static constexpr Size s_insertBatch = 16;
+
+    struct Block
+    {
+        uint64 words[s_wordCount];
+    };
+
+    Hash m_hash;
+    double m_falsePositiveRate = 0.01;
+    Size m_capacity = 0;
+    Size m_size = 0;
+    void* m_memory = nullptr;
+    Block* m_blocks = nullptr; // m_memory aligned on a cache line
+    Size m_blockCount = 0;
+
+    // bits per key of an optimal (not blocked) bloom filter for the rate
+    Size blockCountFor(Size capacity) const
+    {
+        double rate = m_falsePositiveRate > 1e-9 ? (m_falsePositiveRate < 0.5 ? m_falsePositiveRate : 0.5) : 1e-9;
+        double bitsPerKey = -std::log(rate) / (0.69314718056 * 0.69314718056);
+        Size blockCount = (Size)std::ceil((double)capacity * bitsPerKey / (double)(s_blockSize * 8));
+        return blockCount > 0 ? blockCount : 1;
+    }
+
+    void allocate(Size blockCount)
+    {
+        m_memory = operator new (sizeof(Block) * blockCount + s_blockSize - 1);
+        m_blocks = (Block*)(((uintptr_t)m_memory + s_blockSize - 1) & ~(uintptr_t)(s_blockSize - 1));
+        m_blockCount = blockCount;
+        std::memset(m_blocks, 0, sizeof(Block) * blockCount);
+    }
+
+    // the high half of the hash picks the block (multiply shift range reduction, any block count works)
+    inline Size blockIndex(uint64 hash) const { return (Size)(((hash >> 32) * m_blockCount) >> 32); }
+
+    // the low half picks one bit in each word, multiplied by a different odd salt for each word
+    static inline uint64 bit(uint64 hash, Size word)
+    {
+        static constexpr uint32 salts[s_wordCount] = {
+            0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU, 0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U
+        };
+        return uint64(1) << ((uint32)((uint32)hash * salts[word]) >> 26);
+    }
+
+    static inline void set(Block& block, uint64 hash)
+    {
+        for (Size i = 0; i < s_wordCount; i++)
+            block.words[i] |= bit(hash, i);
+    }
+
+    static inline bool test(const Block& block, uint64 hash)
+    {
+        uint64 missing = 0;
+        for (Size i = 0; i < s_wordCount; i++)
+            missing |= ~block.words[i] & bit(hash, i);
+        return missing == 0;
+    }
+
+public:
+    BloomFilter& operator = (const BloomFilter& cp)
+    {
+        if (this != &cp)
+        {
+            BloomFilter copy(cp);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    BloomFilter& operator = (BloomFilter&& mv) noexcept
+    {
+        if (this != &mv)
+        {
+            operator delete (m_memory);
+            m_hash = std::move(mv.m_hash);
+            m_falsePositiveRate = mv.m_falsePositiveRate;
+            m_capacity = mv.m_capacity;
+            m_size = mv.m_size;
+            m_memory = mv.m_memory;
+            m_blocks = mv.m_blocks;
+            m_blockCount = mv.m_blockCount;
+            mv.m_memory = nullptr;
+            mv.m_blocks = nullptr;
+            mv.m_blockCount = 0;
+            mv.m_capacity = 0;
+            mv.m_size = 0;
+        }
+        return *this;
+    }
+};
+
+}
+
+#endif // BLOOMFILTER_HPP
@@ -0,0 +1,42 @@
+/*
+ * ---------------------------------------------------
+ * Compare.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 10:12:31
+ * ---------------------------------------------------
+ */
+
+#ifndef COMPARE_HPP
+# define COMPARE_HPP
+
+namespace utils
+{
+
+// Three-way comparison used by the ordered containers.
+// Returns a negative value if a < b, zero if a == b and a positive value if a > b.
+// The call is templated so any type comparable with T can be used for lookups.
+// Specialize it for types that can do a cheaper single pass comparison (see String).
+template<typename T>
+struct Compare
+{
+    template<typename A, typename B>
+    inline int operator () (const A& a, const B& b) const
+    {
+        if (a == b)
+            return 0;
+        return a < b ? -1 : 1;
+    }
+};
+
+// Equality used by the hash containers, templated like Compare for heterogeneous lookups.
+template<typename T>
+struct Equal
+{
+    template<typename A, typename B>
+    inline bool operator () (const A& a, const B& b) const { return a == b; }
+};
+
+}
+
+#endif // COMPARE_HPP
@@ -0,0 +1,195 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentCache.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:58:21
+ * ---------------------------------------------------
+ */
+
+#ifndef CONCURRENTCACHE_HPP
+# define CONCURRENTCACHE_HPP
+
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/LruCache.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <mutex>
+#include <utility>
+
+namespace utils
+{
+
+// Thread safe cache made of independently locked LruCache (or LfuCache) shards. The high bits of the
+// key hash pick the shard and the same hash functor is given to every shard cache (its third template
+// argument), so a key is hashed with a single functor. The capacity is split evenly between the shards
+// (the first ones getting the remainder, and never more shards than the capacity) so the total never
+// exceeds it and the eviction order is only exact within a shard. Values are returned by copy because an
+// entry can be evicted by another thread as soon as the shard is unlocked.
+template<typename Key, typename Value, typename Hash = utils::Hash<Key>, typename Cache = LruCache<Key, Value, Hash>>
+class ConcurrentCache
+{
+public:
+    using Size             = uint64;
+    using Stats            = typename Cache::Stats;
+    using Weigher          = typename Cache::Weigher;
+    using EvictionCallback = typename Cache::EvictionCallback;
+
+public:
+    ConcurrentCache()                       = delete;
+    ConcurrentCache(const ConcurrentCache&) = delete;
+    ConcurrentCache(ConcurrentCache&&)      = delete;
+
+    explicit ConcurrentCache(Size capacity, Size shardCount = 16, const Weigher& weigher = Weigher(), const Hash& hash = Hash()) : m_hash(hash)
+    {
+        while ((Size(1) << m_shardBits) < shardCount && m_shardBits < 16 && (Size(1) << (m_shardBits + 1)) <= capacity)
+            m_shardBits++;
+        Size count = Size(1) << m_shardBits;
+        m_shards = new Shard[count];
+        try
+        {
+            for (Size i = 0; i < count; i++)
+                m_shards[i].cache = new Cache(capacity / count + (i < capacity % count ? 1 : 0), weigher, hash);
+        }
+        catch (...)
+        {
+            delete[] m_shards;
+            throw;
+        }
+    }
+
+    inline Size shardCount() const { return Size(1) << m_shardBits; }
+
+    // sum of the shards capacities, the one given to the constructor
+    Size capacity() const
+    {
+        Size capacity = 0;
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            capacity += m_shards[i].cache->capacity();
+        }
+        return capacity;
+    }
+
+    // exact when there is no concurrent update
+    Size size() const
+    {
+        Size size = 0;
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            size += m_shards[i].cache->size();
+        }
+        return size;
+    }
+
+    inline bool isEmpty() const { return size() == 0; }
+
+    // sum of the shards counters
+    Stats stats() const
+    {
+        Stats stats;
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            const Stats& shardStats = m_shards[i].cache->stats();
+            stats.hits += shardStats.hits;
+            stats.misses += shardStats.misses;
+            stats.evictions += shardStats.evictions;
+        }
+        return stats;
+    }
+
+    // the callback is called with the lock of the shard held, it must not use the cache
+    void setEvictionCallback(const EvictionCallback& callback)
+    {
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            m_shards[i].cache->setEvictionCallback(callback);
+        }
+    }
+
+    template<typename K>
+    bool contain(const K& key) const
+    {
+        Shard& shard = shardFor(m_hash(key));
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache->contain(key);
+    }
+
+    // copy the value of the key in val, return false if the key is missing
+    template<typename K>
+    bool tryGet(const K& key, Value& val)
+    {
+        Shard& shard = shardFor(m_hash(key));
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Value* cached = shard.cache->get(key);
+        if (cached == nullptr)
+            return false;
+        val = *cached;
+        return true;
+    }
+
+    template<typename V>
+    void put(const Key& key, V&& val)
+    {
+        Shard& shard = shardFor(m_hash(key));
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache->put(key, std::forward<V>(val));
+    }
+
+    template<typename K>
+    bool remove(const K& key)
+    {
+        Shard& shard = shardFor(m_hash(key));
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache->remove(key);
+    }
+
+    void clear()
+    {
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            m_shards[i].cache->clear();
+        }
+    }
+
+    ~ConcurrentCache()
+    {
+        delete[] m_shards;
+    }
+
+private:
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        Cache* cache = nullptr;
+        byte padding[64]; // keep the shards on separate cache lines
+
+        Shard() = default;
+        Shard(const Shard&) = delete;
+        Shard(Shard&&)      = delete;
+
+        ~Shard() { delete cache; }
+
+        Shard& operator = (const Shard&) = delete;
+        Shard& operator = (Shard&&)      = delete;
+    };
+
+    Shard* m_shards = nullptr;
+    uint32 m_shardBits = 0;
+    Hash m_hash;
+
+    inline Shard& shardFor(uint64 hash) const { return m_shards[m_shardBits == 0 ? 0 : hash >> (64 - m_shardBits)]; }
+
+public:
+    ConcurrentCache& operator = (const ConcurrentCache&) = delete;
+    ConcurrentCache& operator = (ConcurrentCache&&)      = delete;
+};
+
+}
+
+#endif // CONCURRENTCACHE_HPP
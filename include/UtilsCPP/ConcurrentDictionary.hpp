@@ -0,0 +1,104 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentDictionary.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 14:31:08
+ * ---------------------------------------------------
+ */
+
+#ifndef CONCURRENTDICTIONARY_HPP
+# define CONCURRENTDICTIONARY_HPP
+
+#include "UtilsCPP/ConcurrentSet.hpp"
+#include "UtilsCPP/Compare.hpp"
+
+namespace utils
+{
+
+// Lock-free Dictionary built on ConcurrentSet, see ConcurrentSet for the consistency guarantees.
+// Values can not be modified in place, tryGet returns a copy.
+template<typename Key, typename Value, typename Compare = utils::Compare<Key>>
+class ConcurrentDictionary
+{
+public:
+    struct KeyValPair
+    {
+        Key key;
+        Value val;
+    };
+
+    struct KeyValPairCompare
+    {
+        Compare keyCompare;
+
+        inline int operator () (const KeyValPair& a, const KeyValPair& b) const { return keyCompare(a.key, b.key); }
+
+        template<typename K>
+        inline int operator () (const KeyValPair& a, const K& b) const { return keyCompare(a.key, b); }
+    };
+
+public:
+    using DataStructure  = ConcurrentSet<KeyValPair, KeyValPairCompare>;
+    using Size           = typename DataStructure::Size;
+    using Iterator       = typename DataStructure::Iterator;
+    using const_Iterator = typename DataStructure::const_Iterator;
+
+    template<typename Hi>
+    using Range = typename DataStructure::template Range<Hi>;
+
+public:
+    ConcurrentDictionary()                            = default;
+    ConcurrentDictionary(const ConcurrentDictionary&) = delete;
+    ConcurrentDictionary(ConcurrentDictionary&&)      = delete;
+
+    explicit ConcurrentDictionary(const Compare& compare) : m_data(KeyValPairCompare{compare})
+    {
+    }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_data.contain(key); }
+    inline Size size() const { return m_data.size(); }
+    inline bool isEmpty() const { return m_data.isEmpty(); }
+
+    inline Iterator begin() const { return m_data.begin(); }
+    inline Iterator end()   const { return m_data.end(); }
+
+    template<typename K>
+    inline Iterator find(const K& key) const { return m_data.find(key); }
+
+    template<typename K>
+    bool tryGet(const K& key, Value& val) const
+    {
+        Iterator it = m_data.find(key);
+        if (it == m_data.end())
+            return false;
+        val = it->val;
+        return true;
+    }
+
+    // keys in [lo, hi)
+    template<typename Lo, typename Hi>
+    inline Range<Hi> iterateRange(const Lo& lo, const Hi& hi) const { return m_data.iterateRange(lo, hi); }
+
+    // return false if the key is already in the dictionary
+    inline bool insert(const Key& key, const Value& val) { return m_data.insert(KeyValPair{key, val}); }
+
+    template<typename K>
+    inline bool remove(const K& key) { return m_data.remove(key); }
+
+    inline void clear() { m_data.clear(); }
+
+    ~ConcurrentDictionary() = default;
+
+private:
+    DataStructure m_data;
+
+public:
+    ConcurrentDictionary& operator = (const ConcurrentDictionary&) = delete;
+    ConcurrentDictionary& operator = (ConcurrentDictionary&&)      = delete;
+};
+
+}
+
+#endif // CONCURRENTDICTIONARY_HPP
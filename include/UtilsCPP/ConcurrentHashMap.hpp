@@ -0,0 +1,359 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentHashMap.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 18:40:26
+ * ---------------------------------------------------
+ */
+
+#ifndef CONCURRENTHASHMAP_HPP
+# define CONCURRENTHASHMAP_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Epoch.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace utils
+{
+
+// Hash map split in independently locked shards, the shard is chosen by the high bits of the key hash.
+// Reads never lock: entries are immutable nodes in chained buckets, a writer (holding its shard lock)
+// publishes new nodes with atomic stores and hands the unlinked ones to Epoch. An update replaces
+// the node, so readers see either the old or the new value, never a partially written one.
+// A shard grows alone by building a new bucket table while the other shards keep working.
+template<typename Key, typename Value, typename Hash = utils::Hash<Key>, typename Equal = utils::Equal<Key>>
+class ConcurrentHashMap
+{
+public:
+    using Size = uint64;
+
+    struct KeyValPair
+    {
+        Key key;
+        Value val;
+    };
+
+public:
+    explicit ConcurrentHashMap(Size shardCount = 64, const Hash& hash = Hash(), const Equal& equal = Equal()) : m_hash(hash), m_equal(equal)
+    {
+        while ((Size(1) << m_shardBits) < shardCount && m_shardBits < 16)
+            m_shardBits++;
+        m_shards = new Shard[Size(1) << m_shardBits];
+    }
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap(ConcurrentHashMap&&)      = delete;
+
+    // exact when there is no concurrent update
+    Size size() const
+    {
+        Size size = 0;
+        for (Size i = 0; i < shardCount(); i++)
+            size += m_shards[i].count.load(std::memory_order_relaxed);
+        return size;
+    }
+
+    inline bool isEmpty() const { return size() == 0; }
+    inline Size shardCount() const { return Size(1) << m_shardBits; }
+
+    template<typename K>
+    bool contain(const K& key) const
+    {
+        uint64 hash = m_hash(key);
+        Epoch::Guard guard;
+        return findNode(shardFor(hash).table.load(std::memory_order_acquire), key, hash) != nullptr;
+    }
+
+    template<typename K>
+    bool tryGet(const K& key, Value& val) const
+    {
+        uint64 hash = m_hash(key);
+        Epoch::Guard guard;
+        const Node* node = findNode(shardFor(hash).table.load(std::memory_order_acquire), key, hash);
+        if (node == nullptr)
+            return false;
+        val = node->pair.val;
+        return true;
+    }
+
+    // return false if the key is already in the map
+    bool insert(const Key& key, const Value& val)
+    {
+        uint64 hash = m_hash(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (findNode(shard.table.load(std::memory_order_relaxed), key, hash) != nullptr)
+            return false;
+        link(shard, new Node(KeyValPair{key, val}, hash));
+        return true;
+    }
+
+    void insertOrAssign(const Key& key, const Value& val)
+    {
+        uint64 hash = m_hash(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::atomic<Node*>* slot = findSlot(shard.table.load(std::memory_order_relaxed), key, hash);
+        if (slot != nullptr)
+            replace(*slot, KeyValPair{key, val});
+        else
+            link(shard, new Node(KeyValPair{key, val}, hash));
+    }
+
+    // value of the key, inserting factory() first if it is missing.
+    // factory runs under the shard lock so it is called at most once per missing key.
+    template<typename Factory>
+    Value getOrInsert(const Key& key, const Factory& factory)
+    {
+        uint64 hash = m_hash(key);
+        Shard& shard = shardFor(hash);
+        {
+            Epoch::Guard guard;
+            const Node* node = findNode(shard.table.load(std::memory_order_acquire), key, hash);
+            if (node != nullptr)
+                return node->pair.val;
+        }
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const Node* node = findNode(shard.table.load(std::memory_order_relaxed), key, hash);
+        if (node == nullptr)
+        {
+            Node* newNode = new Node(KeyValPair{key, factory()}, hash);
+            link(shard, newNode);
+            node = newNode;
+        }
+        return node->pair.val;
+    }
+
+    // replace the value with function(oldValue), atomically with respect to the other writers.
+    // return false if the key is not in the map
+    template<typename K, typename Function>
+    bool update(const K& key, const Function& function)
+    {
+        uint64 hash = m_hash(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::atomic<Node*>* slot = findSlot(shard.table.load(std::memory_order_relaxed), key, hash);
+        if (slot == nullptr)
+            return false;
+        const Node* node = slot->load(std::memory_order_relaxed);
+        replace(*slot, KeyValPair{node->pair.key, function(node->pair.val)});
+        return true;
+    }
+
+    // return false if the key was not in the map
+    template<typename K>
+    bool remove(const K& key)
+    {
+        uint64 hash = m_hash(key);
+        Shard& shard = shardFor(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::atomic<Node*>* slot = findSlot(shard.table.load(std::memory_order_relaxed), key, hash);
+        if (slot == nullptr)
+            return false;
+        Node* node = slot->load(std::memory_order_relaxed);
+        slot->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+        shard.count.fetch_sub(1, std::memory_order_relaxed);
+        Epoch::retire(node, &deleteNode);
+        return true;
+    }
+
+    // weakly consistent, entries updated during the call may or may not be seen
+    template<typename Function>
+    void forEach(const Function& function) const
+    {
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            Epoch::Guard guard;
+            const Table* table = m_shards[i].table.load(std::memory_order_acquire);
+            if (table == nullptr)
+                continue;
+            for (Size bucket = 0; bucket <= table->mask; bucket++)
+            {
+                for (const Node* node = table->buckets[bucket].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire))
+                    function(node->pair);
+            }
+        }
+    }
+
+    void clear()
+    {
+        for (Size i = 0; i < shardCount(); i++)
+        {
+            Shard& shard = m_shards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            Table* table = shard.table.exchange(nullptr, std::memory_order_acq_rel);
+            shard.count.store(0, std::memory_order_relaxed);
+            if (table != nullptr)
+                Epoch::retire(table, &deleteTable);
+        }
+    }
+
+    // must not run concurrently with any other access
+    ~ConcurrentHashMap()
+    {
+        for (Size i = 0; i < shardCount(); i++)
+            deleteTable(m_shards[i].table.load(std::memory_order_acquire));
+        delete[] m_shards;
+    }
+
+private:
+    struct Node
+    {
+        const KeyValPair pair;
+        const uint64 hash;
+        std::atomic<Node*> next;
+
+        Node(KeyValPair&& p, uint64 h) : pair(std::move(p)), hash(h), next(nullptr) {}
+    };
+
+    struct Table
+    {
+        Size mask;
+        std::atomic<Node*>* buckets;
+
+        explicit Table(Size bucketCount) : mask(bucketCount - 1), buckets(new std::atomic<Node*>[bucketCount])
+        {
+            for (Size i = 0; i < bucketCount; i++)
+                buckets[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Table() { delete[] buckets; }
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::atomic<Table*> table{nullptr};
+        std::atomic<Size> count{0};
+        byte padding[64]; // keep the shards on separate cache lines
+    };
+
+    static constexpr Size s_initialBucketCount = 16;
+
+    Shard* m_shards = nullptr;
+    uint32 m_shardBits = 0;
+    Hash m_hash;
+    Equal m_equal;
+
+    // the shard uses the high bits of the hash and the buckets the low ones
+    inline Shard& shardFor(uint64 hash) const { return m_shards[m_shardBits == 0 ? 0 : hash >> (64 - m_shardBits)]; }
+
+    static void deleteNode(void* ptr)
+    {
+        delete static_cast<Node*>(ptr);
+    }
+
+    // also deletes the nodes still linked in the table
+    static void deleteTable(void* ptr)
+    {
+        Table* table = static_cast<Table*>(ptr);
+        if (table == nullptr)
+            return;
+        for (Size bucket = 0; bucket <= table->mask; bucket++)
+        {
+            Node* node = table->buckets[bucket].load(std::memory_order_relaxed);
+            while (node != nullptr)
+            {
+                Node* next = node->next.load(std::memory_order_relaxed);
+                delete node;
+                node = next;
+            }
+        }
+        delete table;
+    }
+
+    template<typename K>
+    const Node* findNode(const Table* table, const K& key, uint64 hash) const
+    {
+        if (table == nullptr)
+            return nullptr;
+        for (const Node* node = table->buckets[hash & table->mask].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire))
+        {
+            if (node->hash == hash && m_equal(node->pair.key, key))
+                return node;
+        }
+        return nullptr;
+    }
+
+    // pointer pointing to the node of the key, only used by writers
+    template<typename K>
+    std::atomic<Node*>* findSlot(Table* table, const K& key, uint64 hash) const
+    {
+        if (table == nullptr)
+            return nullptr;
+        std::atomic<Node*>* slot = &table->buckets[hash & table->mask];
+        for (Node* node = slot->load(std::memory_order_relaxed); node != nullptr; node = slot->load(std::memory_order_relaxed))
+        {
+            if (node->hash == hash && m_equal(node->pair.key, key))
+                return slot;
+            slot = &node->next;
+        }
+        return nullptr;
+    }
+
+    void replace(std::atomic<Node*>& slot, KeyValPair&& pair)
+    {
+        Node* old = slot.load(std::memory_order_relaxed);
+        Node* node = new Node(std::move(pair), old->hash);
+        node->next.store(old->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        slot.store(node, std::memory_order_release);
+        Epoch::retire(old, &deleteNode);
+    }
+
+    void link(Shard& shard, Node* node)
+    {
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        Size count = shard.count.load(std::memory_order_relaxed) + 1;
+        if (table == nullptr || count > table->mask + 1)
+            table = grow(shard, table);
+        std::atomic<Node*>& bucket = table->buckets[node->hash & table->mask];
+        node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bucket.store(node, std::memory_order_release);
+        shard.count.store(count, std::memory_order_relaxed);
+    }
+
+    // readers may still walk the old table, so its nodes are copied instead of relinked
+    Table* grow(Shard& shard, Table* oldTable)
+    {
+        Table* table = new Table(oldTable == nullptr ? s_initialBucketCount : (oldTable->mask + 1) * 2);
+        if (oldTable != nullptr)
+        {
+            try
+            {
+                for (Size bucket = 0; bucket <= oldTable->mask; bucket++)
+                {
+                    for (Node* node = oldTable->buckets[bucket].load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed))
+                    {
+                        Node* copy = new Node(KeyValPair(node->pair), node->hash);
+                        std::atomic<Node*>& newBucket = table->buckets[copy->hash & table->mask];
+                        copy->next.store(newBucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                        newBucket.store(copy, std::memory_order_relaxed);
+                    }
+                }
+            }
+            catch (...)
+            {
+                deleteTable(table);
+                throw;
+            }
+        }
+        shard.table.store(table, std::memory_order_release);
+        if (oldTable != nullptr)
+            Epoch::retire(oldTable, &deleteTable);
+        return table;
+    }
+
+public:
+    ConcurrentHashMap& operator = (const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator = (ConcurrentHashMap&&)      = delete;
+};
+
+}
+
+#endif // CONCURRENTHASHMAP_HPP
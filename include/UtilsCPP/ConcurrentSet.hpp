@@ -0,0 +1,456 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentSet.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 13:52:40
+ * ---------------------------------------------------
+ */
+
+#ifndef CONCURRENTSET_HPP
+# define CONCURRENTSET_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Epoch.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+namespace utils
+{
+
+// Lock-free ordered set, a skip list following Herlihy & Shavit "The Art of Multiprocessor Programming".
+// A node is removed by first marking its next pointers (lowest bit), then unlinked by any thread
+// walking past it. Unlinked nodes are deleted through Epoch once no thread can still be reading them.
+// Iteration and range scans are weakly consistent: they never see an element twice or out of order
+// but may or may not see the updates made while they run. Elements can not be modified in place.
+template<typename T, typename Compare = utils::Compare<T>>
+class ConcurrentSet
+{
+public:
+    using Element = T;
+    using Size    = uint64;
+
+    class Iterator;
+    using const_Iterator = Iterator;
+    template<typename Hi> class Range;
+
+public:
+    ConcurrentSet()
+    {
+        for (auto& next : m_head)
+            next.store(0, std::memory_order_relaxed);
+    }
+
+    explicit ConcurrentSet(const Compare& compare) : ConcurrentSet()
+    {
+        m_compare = compare;
+    }
+
+    ConcurrentSet(const ConcurrentSet&) = delete;
+    ConcurrentSet(ConcurrentSet&&)      = delete;
+
+    ConcurrentSet(std::initializer_list<Element> init_list) : ConcurrentSet()
+    {
+        for (const auto& elem : init_list)
+            insert(elem);
+    }
+
+    inline bool isEmpty() const { return begin() == end(); }
+
+    // exact when there is no concurrent update
+    inline Size size() const { return m_size.load(std::memory_order_relaxed); }
+
+    Iterator begin() const
+    {
+        Epoch::Guard guard;
+        return Iterator(firstAlive(toNode(m_head[0].load(std::memory_order_acquire))));
+    }
+
+    inline Iterator end() const { return Iterator(nullptr); }
+
+    template<typename Y>
+    Iterator find(const Y& value) const
+    {
+        Epoch::Guard guard;
+        Node* node = lowerBoundNode(value);
+        if (node == nullptr || m_compare(node->value, value) != 0)
+            return Iterator(nullptr);
+        return Iterator(node);
+    }
+
+    template<typename Y>
+    bool contain(const Y& value) const
+    {
+        Epoch::Guard guard;
+        Node* node = lowerBoundNode(value);
+        return node != nullptr && m_compare(node->value, value) == 0;
+    }
+
+    template<typename Y>
+    Iterator lowerBound(const Y& value) const
+    {
+        Epoch::Guard guard;
+        return Iterator(lowerBoundNode(value));
+    }
+
+    // elements in [lo, hi)
+    template<typename Lo, typename Hi>
+    inline Range<Hi> iterateRange(const Lo& lo, const Hi& hi) const { return Range<Hi>(*this, lowerBound(lo), hi); }
+
+    // return false if an equal element is already in the set
+    inline bool insert(const Element& value) { return insertElement(value); }
+    inline bool insert(Element&& value) { return insertElement(std::move(value)); }
+
+    // return false if the element was not in the set
+    template<typename Y>
+    bool remove(const Y& value)
+    {
+        Epoch::Guard guard;
+        Node* preds[s_maxLevel];
+        Node* succs[s_maxLevel];
+        if (find(value, preds, succs) == false)
+            return false;
+        Node* node = succs[0];
+        for (uint32 level = node->levels - 1; level > 0; level--)
+        {
+            uintptr_t next = node->next(level).load();
+            while (isMarked(next) == false && node->next(level).compare_exchange_weak(next, next | 1) == false)
+                ;
+        }
+        uintptr_t next = node->next(0).load();
+        while (true)
+        {
+            if (isMarked(next))
+                return false; // removed by an other thread
+            if (node->next(0).compare_exchange_strong(next, next | 1))
+                break;
+        }
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        find(node->value, preds, succs); // unlink it from every level
+        release(node);
+        return true;
+    }
+
+    void clear()
+    {
+        for (const Element& element : *this)
+            remove(element);
+    }
+
+    // must not run concurrently with any other access
+    ~ConcurrentSet()
+    {
+        Node* node = toNode(m_head[0].load(std::memory_order_acquire));
+        while (node != nullptr)
+        {
+            Node* next = toNode(node->next(0).load(std::memory_order_relaxed));
+            destroyNode(node);
+            node = next;
+        }
+    }
+
+private:
+    // with a 1/4 promotion probability 16 levels are enough for 4^16 elements
+    static constexpr uint32 s_maxLevel = 16;
+
+    struct Node
+    {
+        Element value;
+        uint32 levels;
+        std::atomic<uint32> refCount; // one for the list, one for the inserting thread
+
+        template<typename E>
+        Node(E&& v, uint32 lvls) : value(std::forward<E>(v)), levels(lvls), refCount(2)
+        {
+        }
+
+        // the next pointers are allocated right after the node
+        inline std::atomic<uintptr_t>& next(uint32 level)
+        {
+            return reinterpret_cast<std::atomic<uintptr_t>*>(reinterpret_cast<byte*>(this) + nextOffset())[level];
+        }
+    };
+
+    mutable std::atomic<uintptr_t> m_head[s_maxLevel];
+    std::atomic<Size> m_size{0};
+    Compare m_compare;
+
+    static constexpr std::size_t nextOffset()
+    {
+        return (sizeof(Node) + alignof(std::atomic<uintptr_t>) - 1) / alignof(std::atomic<uintptr_t>) * alignof(std::atomic<uintptr_t>);
+    }
+
+    static inline bool isMarked(uintptr_t word) { return (word & 1) != 0; }
+    static inline Node* toNode(uintptr_t word) { return reinterpret_cast<Node*>(word & ~(uintptr_t)1); }
+    static inline uintptr_t toWord(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+
+    inline std::atomic<uintptr_t>& nextOf(Node* pred, uint32 level) const { return pred == nullptr ? m_head[level] : pred->next(level); }
+
+    template<typename E>
+    static Node* makeNode(E&& value, uint32 levels)
+    {
+        void* memory = operator new (nextOffset() + sizeof(std::atomic<uintptr_t>) * levels);
+        Node* node = nullptr;
+        try
+        {
+            node = new (memory) Node(std::forward<E>(value), levels);
+        }
+        catch (...)
+        {
+            operator delete (memory);
+            throw;
+        }
+        for (uint32 level = 0; level < levels; level++)
+            new (&node->next(level)) std::atomic<uintptr_t>(0);
+        return node;
+    }
+
+    static void destroyNode(void* ptr)
+    {
+        static_cast<Node*>(ptr)->~Node();
+        operator delete (ptr);
+    }
+
+    static inline void release(Node* node)
+    {
+        if (node->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            Epoch::retire(node, &destroyNode);
+    }
+
+    static uint32 randomLevel()
+    {
+        static std::atomic<uint64> seeds(0x9E3779B97F4A7C15);
+        static thread_local uint64 state = seeds.fetch_add(0x9E3779B97F4A7C15, std::memory_order_relaxed) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint32 level = 1;
+        for (uint64 bits = state; level < s_maxLevel && (bits & 3) == 0; bits >>= 2)
+            level++;
+        return level;
+    }
+
+    static Node* firstAlive(Node* node)
+    {
+        while (node != nullptr)
+        {
+            uintptr_t next = node->next(0).load(std::memory_order_acquire);
+            if (isMarked(next) == false)
+                break;
+            node = toNode(next);
+        }
+        return node;
+    }
+
+    // read only search, skips marked nodes without unlinking them
+    template<typename Y>
+    Node* lowerBoundNode(const Y& value) const
+    {
+        Node* pred = nullptr;
+        Node* curr = nullptr;
+        for (uint32 level = s_maxLevel; level-- > 0;)
+        {
+            curr = toNode(nextOf(pred, level).load(std::memory_order_acquire));
+            while (curr != nullptr)
+            {
+                uintptr_t next = curr->next(level).load(std::memory_order_acquire);
+                if (isMarked(next))
+                    curr = toNode(next);
+                else if (m_compare(curr->value, value) < 0)
+                {
+                    pred = curr;
+                    curr = toNode(next);
+                }
+                else
+                    break;
+            }
+        }
+        return curr;
+    }
+
+    // fill preds and succs for every level, unlinking the marked nodes on the way
+    template<typename Y>
+    bool find(const Y& value, Node** preds, Node** succs) const
+    {
+        bool restart = true;
+        while (restart)
+        {
+            restart = false;
+            Node* pred = nullptr;
+            for (uint32 level = s_maxLevel; restart == false && level-- > 0;)
+            {
+                Node* curr = toNode(nextOf(pred, level).load());
+                while (curr != nullptr)
+                {
+                    uintptr_t next = curr->next(level).load();
+                    if (isMarked(next))
+                    {
+                        uintptr_t expected = toWord(curr);
+                        if (nextOf(pred, level).compare_exchange_strong(expected, next & ~(uintptr_t)1) == false)
+                        {
+                            restart = true;
+                            break;
+                        }
+                        curr = toNode(next);
+                    }
+                    else if (m_compare(curr->value, value) < 0)
+                    {
+                        pred = curr;
+                        curr = toNode(next);
+                    }
+                    else
+                        break;
+                }
+                preds[level] = pred;
+                succs[level] = curr;
+            }
+        }
+        return succs[0] != nullptr && m_compare(succs[0]->value, value) == 0;
+    }
+
+    template<typename E>
+    bool insertElement(E&& value)
+    {
+        Epoch::Guard guard;
+        Node* preds[s_maxLevel];
+        Node* succs[s_maxLevel];
+        if (find(value, preds, succs))
+            return false;
+
+        Node* node = makeNode(std::forward<E>(value), randomLevel());
+        while (true)
+        {
+            for (uint32 level = 0; level < node->levels; level++)
+                node->next(level).store(toWord(succs[level]), std::memory_order_relaxed);
+            uintptr_t expected = toWord(succs[0]);
+            if (nextOf(preds[0], 0).compare_exchange_strong(expected, toWord(node)))
+                break;
+            if (find(node->value, preds, succs))
+            {
+                destroyNode(node);
+                return false;
+            }
+        }
+        m_size.fetch_add(1, std::memory_order_relaxed);
+
+        bool aborted = false;
+        for (uint32 level = 1; aborted == false && level < node->levels; level++)
+        {
+            while (true)
+            {
+                uintptr_t next = node->next(level).load();
+                if (isMarked(next) || (next != toWord(succs[level]) && node->next(level).compare_exchange_strong(next, toWord(succs[level])) == false))
+                {
+                    aborted = true; // being removed, stop linking it
+                    break;
+                }
+                uintptr_t expected = toWord(succs[level]);
+                if (nextOf(preds[level], level).compare_exchange_strong(expected, toWord(node)))
+                    break;
+                if (find(node->value, preds, succs) == false || succs[0] != node)
+                {
+                    aborted = true;
+                    break;
+                }
+            }
+        }
+        // a remover may have finished unlinking before the last level was linked
+        if (isMarked(node->next(0).load()))
+            find(node->value, preds, succs);
+        release(node);
+        return true;
+    }
+
+public:
+    ConcurrentSet& operator = (const ConcurrentSet&) = delete;
+    ConcurrentSet& operator = (ConcurrentSet&&)      = delete;
+
+public:
+    // Keeps the calling thread inside an epoch while alive, must not be shared between threads.
+    class Iterator
+    {
+    private:
+        friend class ConcurrentSet;
+
+    public:
+        Iterator()                   = default;
+        Iterator(const Iterator& cp) = default;
+
+    protected:
+        explicit Iterator(Node* node) : m_node(node) {}
+
+        Epoch::Guard m_guard;
+        Node* m_node = nullptr;
+
+    public:
+        Iterator& operator = (const Iterator& cp) = default;
+
+        inline const Element& operator  * () const { return  m_node->value; };
+        inline const Element* operator -> () const { return &m_node->value; };
+
+        inline bool operator == (const Iterator& rhs) const { return m_node == rhs.m_node; }
+        inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        inline Iterator& operator ++ ()    { m_node = firstAlive(toNode(m_node->next(0).load(std::memory_order_acquire))); return *this; }
+        inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+    };
+
+    template<typename Hi>
+    class Range
+    {
+    private:
+        friend class ConcurrentSet;
+
+    public:
+        class Iterator : public ConcurrentSet::Iterator
+        {
+        private:
+            friend class Range;
+
+        public:
+            Iterator()                   = default;
+            Iterator(const Iterator& cp) = default;
+
+        private:
+            Iterator(const ConcurrentSet::Iterator& it, const Range* range) : ConcurrentSet::Iterator(it), m_range(range)
+            {
+                clip();
+            }
+
+            const Range* m_range = nullptr;
+
+            void clip()
+            {
+                if (this->m_node != nullptr && m_range->m_set->m_compare(this->m_node->value, m_range->m_hi) >= 0)
+                    this->m_node = nullptr;
+            }
+
+        public:
+            Iterator& operator = (const Iterator& cp) = default;
+
+            inline Iterator& operator ++ ()    { ConcurrentSet::Iterator::operator++(); clip(); return *this; }
+            inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+        };
+
+    private:
+        Range(const ConcurrentSet& set, const ConcurrentSet::Iterator& first, const Hi& hi) : m_set(&set), m_first(first), m_hi(hi) {}
+
+        const ConcurrentSet* m_set;
+        ConcurrentSet::Iterator m_first;
+        Hi m_hi;
+
+    public:
+        inline Iterator begin() const { return Iterator(m_first, this); }
+        inline Iterator end()   const { return Iterator(m_set->end(), this); }
+    };
+};
+
+}
+
+#endif // CONCURRENTSET_HPP
@@ -0,0 +1,305 @@
+/*
+ * ---------------------------------------------------
+ * CuckooFilter.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 23:44:52
+ * ---------------------------------------------------
+ */
+
+#ifndef CUCKOOFILTER_HPP
+# define CUCKOOFILTER_HPP
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace utils
+{
+
+// Probabilistic set like BloomFilter that also supports removal. Each key is stored as a 16 bits
+// fingerprint in one of its two candidate buckets of 4 fingerprints (partial key cuckoo hashing:
+// the second bucket is computed from the first one and the fingerprint, so entries can be moved
+// without the key). A lookup reads two 8 bytes buckets and the false positive rate is about 0.01%.
+// Only remove keys that were inserted, removing a false positive removes the fingerprint of another key.
+// A moved from filter has no buckets and a capacity of 0, it contains nothing and allocates on the next insert.
+template<typename T, typename Hash = utils::Hash<T>>
+class CuckooFilter
+{
+public:
+    using Size = uint64;
+
+    static constexpr bool canRemove = true;
+
+public:
+    CuckooFilter() : CuckooFilter(0) {}
+    CuckooFilter(const CuckooFilter& cp)
+        : m_hash(cp.m_hash), m_bucketMask(cp.m_bucketMask), m_size(cp.m_size), m_victim(cp.m_victim), m_random(cp.m_random)
+    {
+        if (cp.m_buckets == nullptr)
+            return;
+        m_buckets = new uint64[m_bucketMask + 1];
+        std::memcpy(m_buckets, cp.m_buckets, sizeof(uint64) * (m_bucketMask + 1));
+    }
+    CuckooFilter(CuckooFilter&& mv) noexcept
+        : m_hash(std::move(mv.m_hash)), m_buckets(mv.m_buckets), m_bucketMask(mv.m_bucketMask),
+          m_size(mv.m_size), m_victim(mv.m_victim), m_random(mv.m_random)
+    {
+        mv.m_buckets = nullptr;
+        mv.m_bucketMask = 0;
+        mv.m_size = 0;
+        mv.m_victim = Victim();
+    }
+
+    // the table has room for capacity keys at 95% load
+    explicit CuckooFilter(Size capacity, const Hash& hash = Hash()) : m_hash(hash)
+    {
+        allocate(capacity);
+    }
+
+    // bulk build, sized for the keys of the array
+    explicit CuckooFilter(const Array<T>& keys, const Hash& hash = Hash()) : CuckooFilter(keys.length(), hash)
+    {
+        for (const T& key : keys)
+            insert(key);
+    }
+
+    inline Size size() const { return m_size; }
+    inline bool isEmpty() const { return m_size == 0; }
+    inline Size capacity() const { return bucketCount() * s_slotCount; }
+    inline double loadFactor() const { return capacity() > 0 ? (double)m_size / (double)capacity() : 0.0; }
+    inline Size memoryUsage() const { return sizeof(CuckooFilter) + sizeof(uint64) * bucketCount(); }
+
+    // return false if the filter is full, the key is not inserted then
+    template<typename K>
+    bool insert(const K& key)
+    {
+        if (m_victim.used)
+            return false;
+        if (m_buckets == nullptr)
+            reset(0);
+        uint64 hash = m_hash(key);
+        uint64 fp = fingerprint(hash);
+        Size index = hash & m_bucketMask;
+        if (put(index, fp) || put(alternate(index, fp), fp))
+        {
+            m_size++;
+            return true;
+        }
+        // kick a random fingerprint to its other bucket until one has a free slot, the last
+        // one kicked is kept aside when there is still no room so no key is ever lost
+        if (nextRandom() & 1)
+            index = alternate(index, fp);
+        for (Size kick = 0; kick < s_maxKicks; kick++)
+        {
+            Size slot = nextRandom() % s_slotCount;
+            uint64 kicked = read(index, slot);
+            write(index, slot, fp);
+            fp = kicked;
+            index = alternate(index, fp);
+            if (put(index, fp))
+            {
+                m_size++;
+                return true;
+            }
+        }
+        m_victim.used = true;
+        m_victim.index = index;
+        m_victim.fp = fp;
+        m_size++;
+        return true;
+    }
+
+    // false if the key was never inserted, true if it was or with a probability of about 0.01%
+    template<typename K>
+    bool mayContain(const K& key) const
+    {
+        if (m_buckets == nullptr)
+            return false;
+        uint64 hash = m_hash(key);
+        uint64 fp = fingerprint(hash);
+        Size index = hash & m_bucketMask;
+        Size other = alternate(index, fp);
+        if (hasFingerprint(m_buckets[index], fp) || hasFingerprint(m_buckets[other], fp))
+            return true;
+        return m_victim.used && m_victim.fp == fp && (m_victim.index == index || m_victim.index == other);
+    }
+
+    // return false if no fingerprint of the key was found
+    template<typename K>
+    bool remove(const K& key)
+    {
+        if (m_buckets == nullptr)
+            return false;
+        uint64 hash = m_hash(key);
+        uint64 fp = fingerprint(hash);
+        Size index = hash & m_bucketMask;
+        Size other = alternate(index, fp);
+        if (erase(index, fp) || erase(other, fp))
+        {
+            m_size--;
+            // a slot was freed, the victim may fit now
+            if (m_victim.used && (put(m_victim.index, m_victim.fp) || put(alternate(m_victim.index, m_victim.fp), m_victim.fp)))
+                m_victim = Victim();
+            return true;
+        }
+        if (m_victim.used && m_victim.fp == fp && (m_victim.index == index || m_victim.index == other))
+        {
+            m_victim = Victim();
+            m_size--;
+            return true;
+        }
+        return false;
+    }
+
+    void clear()
+    {
+        if (m_buckets != nullptr)
+            std::memset(m_buckets, 0, sizeof(uint64) * (m_bucketMask + 1));
+        m_size = 0;
+        m_victim = Victim();
+    }
+
+    // clear and resize the filter for a new capacity
+    void reset(Size capacity)
+    {
+        uint64* buckets = m_buckets;
+        allocate(capacity);
+        delete[] buckets;
+        m_size = 0;
+        m_victim = Victim();
+    }
+
+    ~CuckooFilter()
+    {
+        delete[] m_buckets;
+    }
+
+private:
+    static constexpr Size s_slotCount = 4; // 16 bits fingerprints packed in a uint64, 0 is an empty slot
+    static constexpr Size s_maxKicks = 500;
+    static constexpr uint64 s_lanes = 0x0001000100010001ULL;
+
+    struct Victim
+    {
+        bool used = false;
+        Size index = 0;
+        uint64 fp = 0;
+    };
+
+    Hash m_hash;
+    uint64* m_buckets = nullptr;
+    Size m_bucketMask = 0;
+    Size m_size = 0;
+    Victim m_victim;
+    uint64 m_random = 0x9E3779B97F4A7C15ULL;
+
+    // 0 for a moved from filter
+    inline Size bucketCount() const { return m_buckets != nullptr ? m_bucketMask + 1 : 0; }
+
+    // power of two bucket count so the alternate bucket is a xor away
+    void allocate(Size capacity)
+    {
+        Size bucketCount = 1;
+        while (bucketCount * s_slotCount * 95 < capacity * 100)
+            bucketCount *= 2;
+        m_buckets = new uint64[bucketCount];
+        std::memset(m_buckets, 0, sizeof(uint64) * bucketCount);
+        m_bucketMask = bucketCount - 1;
+    }
+
+    // the low bits of the hash are the bucket, the fingerprint comes from the high ones
+    static inline uint64 fingerprint(uint64 hash)
+    {
+        uint64 fp = hash >> 48;
+        return fp != 0 ? fp : 1;
+    }
+
+    inline Size alternate(Size index, uint64 fp) const { return (index ^ (fp * 0x5BD1E995)) & m_bucketMask; }
+
+    // a lane of bucket ^ (fp in every lane) is zero where the fingerprint is
+    static inline bool hasFingerprint(uint64 bucket, uint64 fp)
+    {
+        uint64 x = bucket ^ (fp * s_lanes);
+        return ((x - s_lanes) & ~x & (s_lanes << 15)) != 0;
+    }
+
+    inline uint64 read(Size index, Size slot) const { return (m_buckets[index] >> (slot * 16)) & 0xFFFF; }
+
+    inline void write(Size index, Size slot, uint64 fp)
+    {
+        m_buckets[index] = (m_buckets[index] & ~(uint64(0xFFFF) << (slot * 16))) | (fp << (slot * 16));
+    }
+
+    bool put(Size index, uint64 fp)
+    {
+        for (Size slot = 0; slot < s_slotCount; slot++)
+        {
+            if (read(index, slot) == 0)
+            {
+                write(index, slot, fp);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool erase(Size index, uint64 fp)
+    {
+        for (Size slot = 0; slot < s_slotCount; slot++)
+        {
+            if (read(index, slot) == fp)
+            {
+                write(index, slot, 0);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // xorshift, only picks the kicked slots
+    inline uint64 nextRandom()
+    {
+        m_random ^= m_random << 13;
+        m_random ^= m_random >> 7;
+        m_random ^= m_random << 17;
+        return m_random;
+    }
+
+public:
+    CuckooFilter& operator = (const CuckooFilter& cp)
+    {
+        if (this != &cp)
+        {
+            CuckooFilter copy(cp);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    CuckooFilter& operator = (CuckooFilter&& mv) noexcept
+    {
+        if (this != &mv)
+        {
+            delete[] m_buckets;
+            m_hash = std::move(mv.m_hash);
+            m_buckets = mv.m_buckets;
+            m_bucketMask = mv.m_bucketMask;
+            m_size = mv.m_size;
+            m_victim = mv.m_victim;
+            m_random = mv.m_random;
+            mv.m_buckets = nullptr;
+            mv.m_bucketMask = 0;
+            mv.m_size = 0;
+            mv.m_victim = Victim();
+        }
+        return *this;
+    }
+};
+
+}
+
+#endif // CUCKOOFILTER_HPP
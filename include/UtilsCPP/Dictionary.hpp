@@ -11,6 +11,7 @@
 # define DICTIONARY_HPP
 
 #include "UtilsCPP/Set.hpp"
+#include "UtilsCPP/Compare.hpp"
 #include "UtilsCPP/Error.hpp"
 #include "UtilsCPP/Macros.hpp"
 
@@ -19,7 +20,7 @@
 namespace utils
 {
 
-template<typename Key, typename Value>
+template<typename Key, typename Value, typename Compare = utils::Compare<Key>>
 class Dictionary
 {
 public:
@@ -38,18 +39,47 @@ public:
         inline bool operator  < (const Key& rhsKey) const { return key  < rhsKey; }
     };
 
+    struct KeyValPairCompare
+    {
+        Compare keyCompare;
+
+        inline int operator () (const KeyValPair& a, const KeyValPair& b) const { return keyCompare(a.key, b.key); }
+
+        template<typename K>
+        inline int operator () (const KeyValPair& a, const K& b) const { return keyCompare(a.key, b); }
+    };
+
 public:
-    using DataStructure  = Set<KeyValPair>;
+    using DataStructure  = Set<KeyValPair, KeyValPairCompare>;
     using Size           = typename DataStructure::Size;
     using Iterator       = typename DataStructure::Iterator;
     using const_Iterator = typename DataStructure::const_Iterator;
 
+    using ReverseIterator       = typename DataStructure::ReverseIterator;
+    using const_ReverseIterator = typename DataStructure::const_ReverseIterator;
+
+    using Range       = typename DataStructure::template Range<Iterator>;
+    using const_Range = typename DataStructure::template Range<const_Iterator>;
+
+    using NodeHandle = typename DataStructure::NodeHandle;
+
+    struct InsertResult
+    {
+        Iterator iterator;
+        bool inserted;
+    };
+
 public:
     Dictionary()                  = default;
     Dictionary(const Dictionary&) = default;
     Dictionary(Dictionary&&)      = default;
 
-    inline bool contain(const Key& key) const { return m_data.contain(key); }
+    explicit Dictionary(const Compare& compare) : m_data(KeyValPairCompare{compare})
+    {
+    }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_data.contain(key); }
     inline Size size() const { return m_data.size(); }
     inline bool isEmpty() const { return m_data.isEmpty(); }
 
@@ -58,24 +88,99 @@ public:
     inline       Iterator end()         { return m_data.end(); }
     inline const_Iterator end()   const { return m_data.end(); }
 
+    inline       ReverseIterator rbegin()       { return m_data.rbegin(); }
+    inline const_ReverseIterator rbegin() const { return m_data.rbegin(); }
+    inline       ReverseIterator rend()         { return m_data.rend(); }
+    inline const_ReverseIterator rend()   const { return m_data.rend(); }
+
     inline Iterator insert(const Key& key, const Value& val) { return m_data.insert(KeyValPair{key, val}); }
     inline Iterator insert(const Key& key, Value&& val) { return m_data.insert(KeyValPair{key, std::move(val)}); }
 
-    inline void remove(const Key& key) { m_data.remove(m_data.find(key)); }
+    // The following functions search the key only once, the key is only converted or
+    // copied to a Key (or moved if it is an rvalue) when a new entry is created.
+
+    // insert Value(args...) if the key is missing, an existing value is left untouched
+    template<typename K, typename... Args>
+    InsertResult tryEmplace(K&& key, Args&&... args)
+    {
+        InsertResult result;
+        result.iterator = m_data.findOrInsert(key, [&]() { return KeyValPair{Key(std::forward<K>(key)), Value(std::forward<Args>(args)...)}; }, &result.inserted);
+        return result;
+    }
+
+    template<typename K, typename V>
+    InsertResult insertOrAssign(K&& key, V&& val)
+    {
+        InsertResult result;
+        result.iterator = m_data.findOrInsert(key, [&]() { return KeyValPair{Key(std::forward<K>(key)), Value(std::forward<V>(val))}; }, &result.inserted);
+        if (result.inserted == false)
+            result.iterator->val = std::forward<V>(val);
+        return result;
+    }
+
+    // value of the key, inserting factory() first if it is missing
+    template<typename K, typename Factory>
+    Value& getOrInsert(K&& key, const Factory& factory)
+    {
+        return m_data.findOrInsert(key, [&]() { return KeyValPair{Key(std::forward<K>(key)), factory()}; })->val;
+    }
+
+    // call function(value) on the value of the key, return false if the key is missing
+    template<typename K, typename Function>
+    bool update(const K& key, const Function& function)
+    {
+        Iterator it = m_data.find(key);
+        if (it == m_data.end())
+            return false;
+        function(it->val);
+        return true;
+    }
+
+    template<typename K>
+    inline void remove(const K& key) { m_data.remove(m_data.find(key)); }
     inline void remove(const Iterator& it) { m_data.remove(it); }
 
     inline void clear() { m_data.clear(); }
 
+    // move entries between dictionaries without reallocating or copying keys
+    inline NodeHandle extract(const Iterator& it) { return m_data.extract(it); }
+
+    template<typename K>
+    inline NodeHandle extract(const K& key) { return m_data.extract(m_data.find(key)); }
+
+    inline Iterator insert(NodeHandle&& handle) { return m_data.insert(std::move(handle)); }
+
+    // move the entries of other whose key is not in this dictionary
+    inline void merge(Dictionary& other) { m_data.merge(other.m_data); }
+
     DEPRECATED("will be remove or changed")
     Value& get(const Key& key, const Value& deff = Value())
     {
-        if (contain(key) == false)
-            insert(key, deff);
-        return operator[](key);
+        return getOrInsert(key, [&]() { return deff; });
     }
 
-    inline Iterator find(const Key& key) { return m_data.find(key); }
-    inline const_Iterator find(const Key& key) const { return m_data.find(key); }
+    template<typename K>
+    inline Iterator find(const K& key) { return m_data.find(key); }
+
+    template<typename K>
+    inline const_Iterator find(const K& key) const { return m_data.find(key); }
+
+    // batched lookups overlapping their cache misses, out[i] is the result for keys[i]
+    template<typename K> inline void findMany(const K* keys, Size count, Iterator* out)             { m_data.findMany(keys, count, out); }
+    template<typename K> inline void findMany(const K* keys, Size count, const_Iterator* out) const { m_data.findMany(keys, count, out); }
+    template<typename K> inline void containMany(const K* keys, Size count, bool* out)        const { m_data.containMany(keys, count, out); }
+
+    template<typename K> inline       Iterator lowerBound(const K& key)       { return m_data.lowerBound(key); }
+    template<typename K> inline const_Iterator lowerBound(const K& key) const { return m_data.lowerBound(key); }
+    template<typename K> inline       Iterator upperBound(const K& key)       { return m_data.upperBound(key); }
+    template<typename K> inline const_Iterator upperBound(const K& key) const { return m_data.upperBound(key); }
+
+    template<typename K> inline       Range equalRange(const K& key)       { return m_data.equalRange(key); }
+    template<typename K> inline const_Range equalRange(const K& key) const { return m_data.equalRange(key); }
+
+    // entries with a key in [lo, hi)
+    template<typename Lo, typename Hi> inline       Range iterateRange(const Lo& lo, const Hi& hi)       { return m_data.iterateRange(lo, hi); }
+    template<typename Lo, typename Hi> inline const_Range iterateRange(const Lo& lo, const Hi& hi) const { return m_data.iterateRange(lo, hi); }
 
     ~Dictionary() = default;
 
@@ -86,7 +191,8 @@ public:
     Dictionary& operator = (const Dictionary&) = default;
     Dictionary& operator = (Dictionary&&)      = default;
 
-    Value& operator [] (const Key& key)
+    template<typename K>
+    Value& operator [] (const K& key)
     {
         typename DataStructure::Iterator it = m_data.find(key);
 
@@ -96,7 +202,8 @@ public:
         return it->val;
     }
 
-    const Value& operator [] (const Key& key) const
+    template<typename K>
+    const Value& operator [] (const K& key) const
     {
         typename DataStructure::const_Iterator it = m_data.find(key);
 
@@ -0,0 +1,48 @@
+/*
+ * ---------------------------------------------------
+ * Epoch.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 13:10:27
+ * ---------------------------------------------------
+ */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+#include "UtilsCPP/Macros.hpp"
+
+namespace utils
+{
+
+// Epoch based memory reclamation for the lock-free containers.
+// A thread accessing shared nodes holds an Epoch::Guard, nodes unlinked from a structure
+// are passed to retire() and only deleted once every thread that could still see them
+// has released its guard.
+class UTILSCPP_API Epoch
+{
+public:
+    class UTILSCPP_API Guard
+    {
+    public:
+        Guard();
+        Guard(const Guard&);
+
+        ~Guard();
+
+    public:
+        Guard& operator = (const Guard&) = default;
+    };
+
+public:
+    Epoch() = delete;
+
+    static void retire(void* ptr, void (*deleter)(void*));
+
+    // try to advance the epoch and delete what can be, must be called outside of a Guard
+    static void collect();
+};
+
+}
+
+#endif // EPOCH_HPP
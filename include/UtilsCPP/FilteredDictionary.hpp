@@ -0,0 +1,164 @@
+/*
+ * ---------------------------------------------------
+ * FilteredDictionary.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 00:07:39
+ * ---------------------------------------------------
+ */
+
+#ifndef FILTEREDDICTIONARY_HPP
+# define FILTEREDDICTIONARY_HPP
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/BloomFilter.hpp"
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace utils
+{
+
+// Dictionary with a BloomFilter or CuckooFilter of its keys kept in sync, see FilteredSet.
+template<typename Key, typename Value, typename Filter = BloomFilter<Key>, typename Compare = utils::Compare<Key>>
+class FilteredDictionary
+{
+public:
+    using Container      = Dictionary<Key, Value, Compare>;
+    using Size           = typename Container::Size;
+    using Iterator       = typename Container::Iterator;
+    using const_Iterator = typename Container::const_Iterator;
+    using KeyValPair     = typename Container::KeyValPair;
+
+public:
+    FilteredDictionary()                          = default;
+    FilteredDictionary(const FilteredDictionary&) = default;
+    FilteredDictionary(FilteredDictionary&&)      = default;
+
+    // the filter sets the hash and the false positive rate, its content is replaced
+    explicit FilteredDictionary(const Filter& filter, const Compare& compare = Compare()) : m_dictionary(compare), m_filter(filter)
+    {
+        m_filter.reset(0);
+    }
+
+    // bulk build
+    explicit FilteredDictionary(const Array<KeyValPair>& entries)
+    {
+        for (const KeyValPair& entry : entries)
+            m_dictionary.insert(entry.key, entry.val);
+        rebuildFilter(entries.length());
+    }
+
+    inline Size size() const { return m_dictionary.size(); }
+    inline bool isEmpty() const { return m_dictionary.isEmpty(); }
+
+    inline       Iterator begin()       { return m_dictionary.begin(); }
+    inline const_Iterator begin() const { return m_dictionary.begin(); }
+    inline       Iterator end()         { return m_dictionary.end(); }
+    inline const_Iterator end()   const { return m_dictionary.end(); }
+
+    inline const Container& container() const { return m_dictionary; }
+    inline const Filter& filter() const { return m_filter; }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_filter.mayContain(key) && m_dictionary.contain(key); }
+
+    template<typename K>
+    inline Iterator find(const K& key) { return m_filter.mayContain(key) ? m_dictionary.find(key) : m_dictionary.end(); }
+
+    template<typename K>
+    inline const_Iterator find(const K& key) const { return m_filter.mayContain(key) ? m_dictionary.find(key) : m_dictionary.end(); }
+
+    template<typename V>
+    Iterator insert(const Key& key, V&& val)
+    {
+        Iterator it = m_dictionary.insert(key, std::forward<V>(val));
+        added(it->key);
+        return it;
+    }
+
+    void remove(const Iterator& it)
+    {
+        if (it == m_dictionary.end())
+            return;
+        removed(it->key, std::integral_constant<bool, Filter::canRemove>());
+        m_dictionary.remove(it);
+        if (m_staleCount > m_dictionary.size())
+            rebuildFilter(m_dictionary.size() * 2);
+    }
+
+    template<typename K>
+    inline void remove(const K& key) { remove(m_dictionary.find(key)); }
+
+    void clear()
+    {
+        m_dictionary.clear();
+        m_filter.clear();
+        m_staleCount = 0;
+    }
+
+    // rebuild the filter from the keys, sized for capacity keys
+    void rebuildFilter(Size capacity)
+    {
+        bool complete = false;
+        while (complete == false)
+        {
+            m_filter.reset(capacity > m_dictionary.size() ? capacity : m_dictionary.size());
+            complete = true;
+            for (const KeyValPair& entry : m_dictionary)
+            {
+                if (m_filter.insert(entry.key) == false)
+                {
+                    complete = false;
+                    break;
+                }
+            }
+            capacity = capacity * 2 + 1;
+        }
+        m_staleCount = 0;
+    }
+
+    ~FilteredDictionary() = default;
+
+private:
+    Container m_dictionary;
+    Filter m_filter;
+    Size m_staleCount = 0; // removed keys still in a filter that can't remove them
+
+    void added(const Key& key)
+    {
+        if (m_filter.size() < m_filter.capacity() && m_filter.insert(key))
+            return;
+        rebuildFilter(m_dictionary.size() * 2);
+    }
+
+    inline void removed(const Key& key, std::true_type) { m_filter.remove(key); }
+    inline void removed(const Key&, std::false_type) { m_staleCount++; }
+
+public:
+    FilteredDictionary& operator = (const FilteredDictionary&) = default;
+    FilteredDictionary& operator = (FilteredDictionary&&)      = default;
+
+    template<typename K>
+    Value& operator [] (const K& key)
+    {
+        if (m_filter.mayContain(key) == false)
+            throw typename Container::KeyNoFoundError();
+        return m_dictionary[key];
+    }
+
+    template<typename K>
+    const Value& operator [] (const K& key) const
+    {
+        if (m_filter.mayContain(key) == false)
+            throw typename Container::KeyNoFoundError();
+        return m_dictionary[key];
+    }
+};
+
+}
+
+#endif // FILTEREDDICTIONARY_HPP
@@ -0,0 +1,149 @@
+/*
+ * ---------------------------------------------------
+ * FilteredSet.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 23:58:16
+ * ---------------------------------------------------
+ */
+
+#ifndef FILTEREDSET_HPP
+# define FILTEREDSET_HPP
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/BloomFilter.hpp"
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Set.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace utils
+{
+
+// Set with a BloomFilter or CuckooFilter kept in sync, lookups of missing elements are answered by
+// the filter most of the time without walking the tree. The filter grows with the set. A BloomFilter
+// can't forget the removed elements, it is rebuilt once there are more of them than elements.
+template<typename T, typename Filter = BloomFilter<T>, typename Compare = utils::Compare<T>>
+class FilteredSet
+{
+public:
+    using Container      = Set<T, Compare>;
+    using Size           = typename Container::Size;
+    using Iterator       = typename Container::Iterator;
+    using const_Iterator = typename Container::const_Iterator;
+
+public:
+    FilteredSet()                   = default;
+    FilteredSet(const FilteredSet&) = default;
+    FilteredSet(FilteredSet&&)      = default;
+
+    // the filter sets the hash and the false positive rate, its content is replaced
+    explicit FilteredSet(const Filter& filter, const Compare& compare = Compare()) : m_set(compare), m_filter(filter)
+    {
+        m_filter.reset(0);
+    }
+
+    // bulk build
+    explicit FilteredSet(const Array<T>& elements) : m_set(elements.begin(), elements.end())
+    {
+        rebuildFilter(elements.length());
+    }
+
+    inline Size size() const { return m_set.size(); }
+    inline bool isEmpty() const { return m_set.isEmpty(); }
+
+    inline       Iterator begin()       { return m_set.begin(); }
+    inline const_Iterator begin() const { return m_set.begin(); }
+    inline       Iterator end()         { return m_set.end(); }
+    inline const_Iterator end()   const { return m_set.end(); }
+
+    inline const Container& container() const { return m_set; }
+    inline const Filter& filter() const { return m_filter; }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_filter.mayContain(key) && m_set.contain(key); }
+
+    template<typename K>
+    inline Iterator find(const K& key) { return m_filter.mayContain(key) ? m_set.find(key) : m_set.end(); }
+
+    template<typename K>
+    inline const_Iterator find(const K& key) const { return m_filter.mayContain(key) ? m_set.find(key) : m_set.end(); }
+
+    Iterator insert(T&& element)
+    {
+        Iterator it = m_set.insert(std::move(element));
+        added(*it);
+        return it;
+    }
+
+    inline Iterator insert(const T& element) { return insert((T&&)T(element)); }
+
+    void remove(const Iterator& it)
+    {
+        if (it == m_set.end())
+            return;
+        removed(*it, std::integral_constant<bool, Filter::canRemove>());
+        m_set.remove(it);
+        if (m_staleCount > m_set.size())
+            rebuildFilter(m_set.size() * 2);
+    }
+
+    template<typename K>
+    inline void remove(const K& key) { remove(m_set.find(key)); }
+
+    void clear()
+    {
+        m_set.clear();
+        m_filter.clear();
+        m_staleCount = 0;
+    }
+
+    // rebuild the filter from the elements, sized for capacity elements
+    void rebuildFilter(Size capacity)
+    {
+        bool complete = false;
+        while (complete == false)
+        {
+            m_filter.reset(capacity > m_set.size() ? capacity : m_set.size());
+            complete = true;
+            for (const T& element : m_set)
+            {
+                if (m_filter.insert(element) == false)
+                {
+                    complete = false;
+                    break;
+                }
+            }
+            capacity = capacity * 2 + 1;
+        }
+        m_staleCount = 0;
+    }
+
+    ~FilteredSet() = default;
+
+private:
+    Container m_set;
+    Filter m_filter;
+    Size m_staleCount = 0; // removed elements still in a filter that can't remove them
+
+    void added(const T& element)
+    {
+        if (m_filter.size() < m_filter.capacity() && m_filter.insert(element))
+            return;
+        rebuildFilter(m_set.size() * 2);
+    }
+
+    inline void removed(const T& element, std::true_type) { m_filter.remove(element); }
+
+    inline void removed(const T&, std::false_type) { m_staleCount++; }
+
+public:
+    FilteredSet& operator = (const FilteredSet&) = default;
+    FilteredSet& operator = (FilteredSet&&)      = default;
+};
+
+}
+
+#endif // FILTEREDSET_HPP
@@ -102,7 +102,7 @@ private:
 public:
     Func() = default;
 
-    Func(const Func& cp) : m_callable(cp.m_callable->clone())
+    Func(const Func& cp) : m_callable(cp.m_callable ? cp.m_callable->clone() : nullptr)
     {
     }
 
@@ -0,0 +1,197 @@
+/*
+ * ---------------------------------------------------
+ * Hash.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 16:02:15
+ * ---------------------------------------------------
+ */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+#include "UtilsCPP/Types.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace utils
+{
+
+// Hash functor used by the hash containers, returns a 64 bits hash with all the bits well mixed.
+// The provided specializations take an optional seed, use a random one for keys coming from
+// untrusted input. Specialize it for custom key types (hashCombine helps for composite keys),
+// adding overloads for the types usable in lookups (see String).
+template<typename T>
+struct Hash;
+
+namespace wyhash
+{
+
+constexpr uint64 s_secret0 = 0x2D358DCCAA6C78A5ULL;
+constexpr uint64 s_secret1 = 0x8BB84B93962EACC9ULL;
+constexpr uint64 s_secret2 = 0x4B33A62ED433D4A3ULL;
+constexpr uint64 s_secret3 = 0x4D5A2DA51DE1AA47ULL;
+
+// a, b = low and high halves of a * b
+inline void multiply(uint64& a, uint64& b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 r = (uint128)a * b;
+    a = (uint64)r;
+    b = (uint64)(r >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned __int64 high = 0;
+    a = _umul128(a, b, &high);
+    b = high;
+#else
+    uint64 ha = a >> 32, hb = b >> 32, la = (uint32)a, lb = (uint32)b;
+    uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64 t = rl + (rm0 << 32);
+    uint64 c = t < rl;
+    uint64 lo = t + (rm1 << 32);
+    c += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64 mix(uint64 a, uint64 b)
+{
+    multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64 read8(const byte* p) { uint64 v; std::memcpy(&v, p, 8); return v; }
+inline uint64 read4(const byte* p) { uint32 v; std::memcpy(&v, p, 4); return v; }
+inline uint64 read3(const byte* p, uint64 k) { return ((uint64)p[0] << 16) | ((uint64)p[k >> 1] << 8) | p[k - 1]; }
+
+}
+
+// wyhash (final version 4), reads 48 bytes per iteration on long inputs
+inline uint64 hashBytes(const void* data, uint64 length, uint64 seed = 0)
+{
+    using namespace wyhash;
+
+    const byte* p = static_cast<const byte*>(data);
+    seed ^= mix(seed ^ s_secret0, s_secret1);
+    uint64 a = 0;
+    uint64 b = 0;
+    if (length <= 16)
+    {
+        if (length >= 4)
+        {
+            uint64 offset = (length >> 3) << 2;
+            a = (read4(p) << 32) | read4(p + offset);
+            b = (read4(p + length - 4) << 32) | read4(p + length - 4 - offset);
+        }
+        else if (length > 0)
+            a = read3(p, length);
+    }
+    else
+    {
+        uint64 left = length;
+        if (left > 48)
+        {
+            uint64 seed1 = seed;
+            uint64 seed2 = seed;
+            do
+            {
+                seed  = mix(read8(p)      ^ s_secret1, read8(p + 8)  ^ seed);
+                seed1 = mix(read8(p + 16) ^ s_secret2, read8(p + 24) ^ seed1);
+                seed2 = mix(read8(p + 32) ^ s_secret3, read8(p + 40) ^ seed2);
+                p += 48;
+                left -= 48;
+            } while (left > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (left > 16)
+        {
+            seed = mix(read8(p) ^ s_secret1, read8(p + 8) ^ seed);
+            p += 16;
+            left -= 16;
+        }
+        a = read8(p + left - 16);
+        b = read8(p + left - 8);
+    }
+    a ^= s_secret1;
+    b ^= seed;
+    multiply(a, b);
+    return mix(a ^ s_secret0 ^ length, b ^ s_secret1);
+}
+
+// full avalanche mixer for a single 64 bits value
+inline uint64 hashInteger(uint64 value, uint64 seed = 0)
+{
+    using namespace wyhash;
+
+    uint64 a = value ^ s_secret0;
+    uint64 b = seed ^ s_secret1;
+    multiply(a, b);
+    return mix(a ^ s_secret0, b ^ s_secret1);
+}
+
+// order dependent combination of hashes, for composite keys
+inline uint64 hashCombine(uint64 seed, uint64 hash)
+{
+    return wyhash::mix(seed ^ wyhash::s_secret2, hash ^ wyhash::s_secret3);
+}
+
+inline uint64 hashValues(uint64 seed)
+{
+    return seed;
+}
+
+// hashValues(seed, a, b, c) == hashCombine(hashCombine(hashCombine(seed, Hash<A>()(a)), Hash<B>()(b)), Hash<C>()(c))
+template<typename First, typename... Others>
+inline uint64 hashValues(uint64 seed, const First& first, const Others&... others)
+{
+    return hashValues(hashCombine(seed, Hash<First>()(first)), others...);
+}
+
+#define UTILSCPP_INTEGER_HASH(type)                                                                   \
+    template<>                                                                                        \
+    struct Hash<type>                                                                                 \
+    {                                                                                                 \
+        uint64 seed = 0;                                                                              \
+                                                                                                      \
+        Hash() = default;                                                                             \
+        explicit Hash(uint64 s) : seed(s) {}                                                          \
+                                                                                                      \
+        inline uint64 operator () (type value) const { return hashInteger((uint64)value, seed); }     \
+    };
+
+UTILSCPP_INTEGER_HASH(bool)
+UTILSCPP_INTEGER_HASH(char)
+UTILSCPP_INTEGER_HASH(signed char)
+UTILSCPP_INTEGER_HASH(unsigned char)
+UTILSCPP_INTEGER_HASH(short)
+UTILSCPP_INTEGER_HASH(unsigned short)
+UTILSCPP_INTEGER_HASH(int)
+UTILSCPP_INTEGER_HASH(unsigned int)
+UTILSCPP_INTEGER_HASH(long)
+UTILSCPP_INTEGER_HASH(unsigned long)
+UTILSCPP_INTEGER_HASH(long long)
+UTILSCPP_INTEGER_HASH(unsigned long long)
+
+#undef UTILSCPP_INTEGER_HASH
+
+template<typename T>
+struct Hash<T*>
+{
+    uint64 seed = 0;
+
+    Hash() = default;
+    explicit Hash(uint64 s) : seed(s) {}
+
+    inline uint64 operator () (const T* ptr) const { return hashInteger((uint64)reinterpret_cast<uintptr_t>(ptr), seed); }
+};
+
+}
+
+#endif // HASH_HPP
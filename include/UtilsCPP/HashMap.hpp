@@ -0,0 +1,140 @@
+/*
+ * ---------------------------------------------------
+ * HashMap.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 16:48:30
+ * ---------------------------------------------------
+ */
+
+#ifndef HASHMAP_HPP
+# define HASHMAP_HPP
+
+#include "UtilsCPP/HashSet.hpp"
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Error.hpp"
+#include "UtilsCPP/Hash.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+// Unordered Dictionary built on HashSet, use it when the keys don't need to be ordered.
+// Inserting may move the entries and invalidates the iterators and references to values.
+template<typename Key, typename Value, typename Hash = utils::Hash<Key>, typename Equal = utils::Equal<Key>>
+class HashMap
+{
+public:
+    ERROR_DEFF(KeyNoFoundError, "Key not in the map");
+
+public:
+    struct KeyValPair
+    {
+        Key key;
+        Value val;
+    };
+
+    struct KeyValPairHash
+    {
+        Hash keyHash;
+
+        inline uint64 operator () (const KeyValPair& pair) const { return keyHash(pair.key); }
+
+        template<typename K>
+        inline uint64 operator () (const K& key) const { return keyHash(key); }
+    };
+
+    struct KeyValPairEqual
+    {
+        Equal keyEqual;
+
+        inline bool operator () (const KeyValPair& a, const KeyValPair& b) const { return keyEqual(a.key, b.key); }
+
+        template<typename K>
+        inline bool operator () (const KeyValPair& a, const K& b) const { return keyEqual(a.key, b); }
+    };
+
+public:
+    using DataStructure  = HashSet<KeyValPair, KeyValPairHash, KeyValPairEqual>;
+    using Size           = typename DataStructure::Size;
+    using Iterator       = typename DataStructure::Iterator;
+    using const_Iterator = typename DataStructure::const_Iterator;
+
+public:
+    HashMap()               = default;
+    HashMap(const HashMap&) = default;
+    HashMap(HashMap&&)      = default;
+
+    explicit HashMap(const Hash& hash, const Equal& equal = Equal()) : m_data(KeyValPairHash{hash}, KeyValPairEqual{equal})
+    {
+    }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_data.contain(key); }
+    inline Size size() const { return m_data.size(); }
+    inline bool isEmpty() const { return m_data.isEmpty(); }
+
+    inline Size capacity() const { return m_data.capacity(); }
+    inline void reserve(Size count) { m_data.reserve(count); }
+
+    inline       Iterator begin()       { return m_data.begin(); }
+    inline const_Iterator begin() const { return m_data.begin(); }
+    inline       Iterator end()         { return m_data.end(); }
+    inline const_Iterator end()   const { return m_data.end(); }
+
+    inline Iterator insert(const Key& key, const Value& val) { return m_data.insert(KeyValPair{key, val}); }
+    inline Iterator insert(const Key& key, Value&& val) { return m_data.insert(KeyValPair{key, std::move(val)}); }
+
+    template<typename K>
+    inline bool remove(const K& key) { return m_data.remove(key); }
+    inline void remove(const Iterator& it) { m_data.remove(it); }
+
+    inline void clear() { m_data.clear(); }
+
+    template<typename K>
+    inline Iterator find(const K& key) { return m_data.find(key); }
+
+    template<typename K>
+    inline const_Iterator find(const K& key) const { return m_data.find(key); }
+
+    // batched lookups overlapping their cache misses, out[i] is the result for keys[i]
+    template<typename K> inline void findMany(const K* keys, Size count, Iterator* out)             { m_data.findMany(keys, count, out); }
+    template<typename K> inline void findMany(const K* keys, Size count, const_Iterator* out) const { m_data.findMany(keys, count, out); }
+    template<typename K> inline void containMany(const K* keys, Size count, bool* out)        const { m_data.containMany(keys, count, out); }
+
+    ~HashMap() = default;
+
+private:
+    DataStructure m_data;
+
+public:
+    HashMap& operator = (const HashMap&) = default;
+    HashMap& operator = (HashMap&&)      = default;
+
+    template<typename K>
+    Value& operator [] (const K& key)
+    {
+        Iterator it = m_data.find(key);
+
+        if (it == m_data.end())
+            throw KeyNoFoundError();
+
+        return it->val;
+    }
+
+    template<typename K>
+    const Value& operator [] (const K& key) const
+    {
+        const_Iterator it = m_data.find(key);
+
+        if (it == m_data.end())
+            throw KeyNoFoundError();
+
+        return it->val;
+    }
+};
+
+}
+
+#endif // HASHMAP_HPP
@@ -0,0 +1,516 @@
+/*
+ * ---------------------------------------------------
+ * HashSet.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 16:10:48
+ * ---------------------------------------------------
+ */
+
+#ifndef HASHSET_HPP
+# define HASHSET_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Error.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define UTILSCPP_HASHSET_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace utils
+{
+
+// Unordered set using open addressing (Swiss table).
+// Every slot has a control byte holding 7 bits of the element hash, or marking the slot as
+// empty or deleted. Lookups probe groups of 16 control bytes at a time (with SSE2 when available)
+// and only compare the elements whose control byte matches. Elements are stored contiguously,
+// so inserting may move them and invalidates the iterators.
+template<typename T, typename Hash = utils::Hash<T>, typename Equal = utils::Equal<T>>
+class HashSet
+{
+public:
+    ERROR_DEFF(DuplicateElementError, "Element already in the set");
+
+public:
+    using Element = T;
+    using Size    = uint64;
+
+    class Iterator;
+    class const_Iterator;
+
+public:
+    HashSet() = default;
+
+    explicit HashSet(const Hash& hash, const Equal& equal = Equal()) : m_hash(hash), m_equal(equal)
+    {
+    }
+
+    HashSet(const HashSet& cp) : m_hash(cp.m_hash), m_equal(cp.m_equal)
+    {
+        reserve(cp.m_size);
+        for (const Element& element : cp)
+            insertNew(m_hash(element), element);
+    }
+
+    HashSet(HashSet&& mv) noexcept
+        : m_slots(mv.m_slots), m_ctrl(mv.m_ctrl), m_groupCount(mv.m_groupCount), m_size(mv.m_size), m_growthLeft(mv.m_growthLeft),
+          m_hash(mv.m_hash), m_equal(mv.m_equal)
+    {
+        mv.m_slots = nullptr;
+        mv.m_ctrl = nullptr;
+        mv.m_groupCount = 0;
+        mv.m_size = 0;
+        mv.m_growthLeft = 0;
+    }
+
+    HashSet(std::initializer_list<Element> init_list)
+    {
+        reserve(init_list.size());
+        for (const auto& elem : init_list)
+            insert(elem);
+    }
+
+    inline bool isEmpty() const { return m_size == 0; }
+    inline Size size() const { return m_size; }
+
+    // number of elements that fit without rehashing
+    inline Size capacity() const { return maxLoad(slotCount()); }
+
+    void reserve(Size count)
+    {
+        if (count <= capacity())
+            return;
+        Size groupCount = m_groupCount == 0 ? 1 : m_groupCount;
+        while (maxLoad(groupCount * s_groupWidth) < count)
+            groupCount *= 2;
+        if (groupCount != m_groupCount)
+            rehash(groupCount);
+    }
+
+    inline       Iterator begin()       { return       Iterator(this, firstFull(0)); }
+    inline const_Iterator begin() const { return const_Iterator(this, firstFull(0)); }
+    inline       Iterator end()         { return       Iterator(this, slotCount()); }
+    inline const_Iterator end()   const { return const_Iterator(this, slotCount()); }
+
+    inline Iterator insert(const Element& value) { return insertElement(value); }
+    inline Iterator insert(Element&& value) { return insertElement(std::move(value)); }
+
+    template<typename K>
+    inline Iterator find(const K& key) { return Iterator(this, findIndex(key, m_hash(key))); }
+
+    template<typename K>
+    inline const_Iterator find(const K& key) const { return const_Iterator(this, findIndex(key, m_hash(key))); }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return findIndex(key, m_hash(key)) != slotCount(); }
+
+    // out[i] = find(keys[i]), the memory accesses of the lookups are prefetched by batches so their cache misses overlap
+    template<typename K>
+    void findMany(const K* keys, Size count, Iterator* out)
+    {
+        searchMany(keys, count, [&](Size i, Size idx) { out[i] = Iterator(this, idx); });
+    }
+
+    template<typename K>
+    void findMany(const K* keys, Size count, const_Iterator* out) const
+    {
+        searchMany(keys, count, [&](Size i, Size idx) { out[i] = const_Iterator(this, idx); });
+    }
+
+    template<typename K>
+    void containMany(const K* keys, Size count, bool* out) const
+    {
+        searchMany(keys, count, [&](Size i, Size idx) { out[i] = idx != slotCount(); });
+    }
+
+    // return false if the element was not in the set
+    template<typename K>
+    bool remove(const K& key)
+    {
+        Size idx = findIndex(key, m_hash(key));
+        if (idx == slotCount())
+            return false;
+        removeAt(idx);
+        return true;
+    }
+
+    inline void remove(const Iterator& it)
+    {
+        if (it != end())
+            removeAt(it.m_idx);
+    }
+
+    void clear()
+    {
+        for (Size i = 0; i < slotCount(); i++)
+        {
+            if (isFull(m_ctrl[i]))
+                m_slots[i].~Element();
+        }
+        if (m_ctrl != nullptr)
+            std::memset(m_ctrl, s_empty, slotCount());
+        m_size = 0;
+        m_growthLeft = capacity();
+    }
+
+    ~HashSet()
+    {
+        clear();
+        operator delete (m_slots);
+    }
+
+private:
+    static constexpr Size s_groupWidth = 16;
+
+    // control bytes, a full slot stores the 7 low bits of its hash
+    static constexpr byte s_empty   = 0x80;
+    static constexpr byte s_deleted = 0xFE;
+
+    static_assert(alignof(Element) <= alignof(std::max_align_t), "over aligned elements are not supported");
+
+    Element* m_slots = nullptr; // allocated with the control bytes right after the slots
+    byte* m_ctrl = nullptr;
+    Size m_groupCount = 0; // always a power of 2
+    Size m_size = 0;
+    Size m_growthLeft = 0; // empty slots that can still be used before a rehash
+    Hash m_hash;
+    Equal m_equal;
+
+    static inline bool isFull(byte ctrl) { return (ctrl & 0x80) == 0; }
+    static inline byte hashBits(uint64 hash) { return (byte)(hash & 0x7F); }
+
+    // at most 7/8 of the slots are used so a probe always ends on an empty slot
+    static inline Size maxLoad(Size slots) { return slots - slots / 8; }
+
+    inline Size slotCount() const { return m_groupCount * s_groupWidth; }
+
+    static inline uint32 lowestBit(uint32 mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return (uint32)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+        unsigned long idx = 0;
+        _BitScanForward(&idx, mask);
+        return (uint32)idx;
+#else
+        uint32 idx = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            idx++;
+        }
+        return idx;
+#endif
+    }
+
+    // bitmasks of the matching control bytes in a group
+    struct Group
+    {
+#ifdef UTILSCPP_HASHSET_SSE2
+        __m128i ctrl;
+
+        explicit Group(const byte* ptr) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))) {}
+
+        inline uint32 match(byte value) const { return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value))); }
+        inline uint32 matchEmptyOrDeleted() const { return (uint32)_mm_movemask_epi8(ctrl); }
+#else
+        const byte* ctrl;
+
+        explicit Group(const byte* ptr) : ctrl(ptr) {}
+
+        uint32 match(byte value) const
+        {
+            uint32 mask = 0;
+            for (uint32 i = 0; i < s_groupWidth; i++)
+                mask |= (uint32)(ctrl[i] == value) << i;
+            return mask;
+        }
+
+        uint32 matchEmptyOrDeleted() const
+        {
+            uint32 mask = 0;
+            for (uint32 i = 0; i < s_groupWidth; i++)
+                mask |= (uint32)(ctrl[i] >> 7) << i;
+            return mask;
+        }
+#endif
+        inline uint32 matchEmpty() const { return match(s_empty); }
+    };
+
+    static constexpr Size s_searchBatch = 16;
+
+    // lookups in three passes over each batch: hash the keys and prefetch their first control group,
+    // then match the control bytes and prefetch the first candidate slot, then do the actual lookups.
+    // result(i, idx) is called with the index of keys[i] or slotCount()
+    template<typename K, typename Result>
+    void searchMany(const K* keys, Size count, const Result& result) const
+    {
+        uint64 hashes[s_searchBatch];
+        for (Size first = 0; first < count; first += s_searchBatch)
+        {
+            Size batch = count - first < s_searchBatch ? count - first : s_searchBatch;
+            if (m_groupCount == 0)
+            {
+                for (Size i = 0; i < batch; i++)
+                    result(first + i, slotCount());
+                continue;
+            }
+            for (Size i = 0; i < batch; i++)
+            {
+                hashes[i] = m_hash(keys[first + i]);
+                UTILSCPP_PREFETCH(m_ctrl + ((hashes[i] >> 7) & (m_groupCount - 1)) * s_groupWidth);
+            }
+            for (Size i = 0; i < batch; i++)
+            {
+                Size group = (hashes[i] >> 7) & (m_groupCount - 1);
+                uint32 mask = Group(m_ctrl + group * s_groupWidth).match(hashBits(hashes[i]));
+                if (mask != 0)
+                    UTILSCPP_PREFETCH(m_slots + group * s_groupWidth + lowestBit(mask));
+            }
+            for (Size i = 0; i < batch; i++)
+                result(first + i, findIndex(keys[first + i], hashes[i]));
+        }
+    }
+
+    // return slotCount() if not found
+    template<typename K>
+    Size findIndex(const K& key, uint64 hash) const
+    {
+        if (m_groupCount == 0)
+            return 0;
+        Size group = (hash >> 7) & (m_groupCount - 1);
+        for (Size step = 1;; step++)
+        {
+            Group g(m_ctrl + group * s_groupWidth);
+            for (uint32 mask = g.match(hashBits(hash)); mask != 0; mask &= mask - 1)
+            {
+                Size idx = group * s_groupWidth + lowestBit(mask);
+                if (m_equal(m_slots[idx], key))
+                    return idx;
+            }
+            if (g.matchEmpty() != 0)
+                return slotCount();
+            group = (group + step) & (m_groupCount - 1); // triangular probing visits every group
+        }
+    }
+
+    Size findFirstNonFull(uint64 hash) const
+    {
+        Size group = (hash >> 7) & (m_groupCount - 1);
+        for (Size step = 1;; step++)
+        {
+            uint32 mask = Group(m_ctrl + group * s_groupWidth).matchEmptyOrDeleted();
+            if (mask != 0)
+                return group * s_groupWidth + lowestBit(mask);
+            group = (group + step) & (m_groupCount - 1);
+        }
+    }
+
+    Size firstFull(Size idx) const
+    {
+        while (idx < slotCount() && isFull(m_ctrl[idx]) == false)
+            idx++;
+        return idx;
+    }
+
+    void rehash(Size groupCount)
+    {
+        Element* oldSlots = m_slots;
+        byte* oldCtrl = m_ctrl;
+        Size oldSlotCount = slotCount();
+
+        Size slots = groupCount * s_groupWidth;
+        m_slots = static_cast<Element*>(operator new (sizeof(Element) * slots + slots));
+        m_ctrl = reinterpret_cast<byte*>(m_slots + slots);
+        std::memset(m_ctrl, s_empty, slots);
+        m_groupCount = groupCount;
+        m_growthLeft = maxLoad(slots) - m_size;
+
+        for (Size i = 0; i < oldSlotCount; i++)
+        {
+            if (isFull(oldCtrl[i]) == false)
+                continue;
+            uint64 hash = m_hash(oldSlots[i]);
+            Size idx = findFirstNonFull(hash);
+            new (&m_slots[idx]) Element(std::move(oldSlots[i]));
+            m_ctrl[idx] = hashBits(hash);
+            oldSlots[i].~Element();
+        }
+        operator delete (oldSlots);
+    }
+
+    // slot for a new element, growing the table or cleaning the deleted slots if needed
+    Size prepareInsert(uint64 hash)
+    {
+        Size idx = m_groupCount == 0 ? 0 : findFirstNonFull(hash);
+        if (m_growthLeft == 0 && (m_groupCount == 0 || m_ctrl[idx] != s_deleted))
+        {
+            if (m_size <= capacity() / 2)
+                rehash(m_groupCount == 0 ? 1 : m_groupCount); // mostly deleted slots, same size is enough
+            else
+                rehash(m_groupCount * 2);
+            idx = findFirstNonFull(hash);
+        }
+        return idx;
+    }
+
+    template<typename E>
+    Size insertNew(uint64 hash, E&& value)
+    {
+        Size idx = prepareInsert(hash);
+        new (&m_slots[idx]) Element(std::forward<E>(value));
+        if (m_ctrl[idx] == s_empty)
+            m_growthLeft--;
+        m_ctrl[idx] = hashBits(hash);
+        m_size++;
+        return idx;
+    }
+
+    template<typename E>
+    Iterator insertElement(E&& value)
+    {
+        uint64 hash = m_hash(value);
+        if (findIndex(value, hash) != slotCount())
+            throw DuplicateElementError();
+        return Iterator(this, insertNew(hash, std::forward<E>(value)));
+    }
+
+    void removeAt(Size idx)
+    {
+        m_slots[idx].~Element();
+        m_size--;
+        // a probe only goes past a group with no empty slot, if there is one no probe can need this slot
+        if (Group(m_ctrl + idx / s_groupWidth * s_groupWidth).matchEmpty() != 0)
+        {
+            m_ctrl[idx] = s_empty;
+            m_growthLeft++;
+        }
+        else
+            m_ctrl[idx] = s_deleted;
+    }
+
+public:
+    HashSet& operator = (const HashSet& rhs)
+    {
+        if (&rhs != this)
+            *this = HashSet(rhs);
+        return *this;
+    }
+
+    HashSet& operator = (HashSet&& rhs) noexcept
+    {
+        if (&rhs != this)
+        {
+            clear();
+            operator delete (m_slots);
+            m_slots = rhs.m_slots;
+            m_ctrl = rhs.m_ctrl;
+            m_groupCount = rhs.m_groupCount;
+            m_size = rhs.m_size;
+            m_growthLeft = rhs.m_growthLeft;
+            m_hash = rhs.m_hash;
+            m_equal = rhs.m_equal;
+            rhs.m_slots = nullptr;
+            rhs.m_ctrl = nullptr;
+            rhs.m_groupCount = 0;
+            rhs.m_size = 0;
+            rhs.m_growthLeft = 0;
+        }
+        return *this;
+    }
+
+    bool operator == (const HashSet& rhs) const
+    {
+        if (m_size != rhs.m_size)
+            return false;
+        for (const Element& element : *this)
+        {
+            if (rhs.contain(element) == false)
+                return false;
+        }
+        return true;
+    }
+
+    inline bool operator != (const HashSet& rhs) const { return !(*this == rhs); }
+
+public:
+    class Iterator
+    {
+    private:
+        friend class HashSet;
+
+    public:
+        Iterator()                   = default;
+        Iterator(const Iterator& cp) = default;
+        Iterator(Iterator&& mv)      = default;
+
+    private:
+        Iterator(HashSet* set, Size idx) : m_set(set), m_idx(idx) {}
+
+        HashSet* m_set = nullptr;
+        Size m_idx = 0;
+
+    public:
+        Iterator& operator = (const Iterator& cp) = default;
+        Iterator& operator = (Iterator&& mv)      = default;
+
+        inline Element& operator  * () const { return  m_set->m_slots[m_idx]; };
+        inline Element* operator -> () const { return &m_set->m_slots[m_idx]; };
+
+        inline bool operator == (const Iterator& rhs) const { return m_set == rhs.m_set && m_idx == rhs.m_idx; }
+        inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        inline Iterator& operator ++ ()    { m_idx = m_set->firstFull(m_idx + 1); return *this; }
+        inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+    };
+
+    class const_Iterator
+    {
+    private:
+        friend class HashSet;
+
+    public:
+        const_Iterator()                         = default;
+        const_Iterator(const const_Iterator& cp) = default;
+        const_Iterator(const_Iterator&& mv)      = default;
+
+        const_Iterator(const Iterator& cp) : m_set(cp.m_set), m_idx(cp.m_idx) {}
+
+    private:
+        const_Iterator(const HashSet* set, Size idx) : m_set(set), m_idx(idx) {}
+
+        const HashSet* m_set = nullptr;
+        Size m_idx = 0;
+
+    public:
+        const_Iterator& operator = (const const_Iterator& cp) = default;
+        const_Iterator& operator = (const_Iterator&& mv)      = default;
+
+        inline const Element& operator  * () const { return  m_set->m_slots[m_idx]; };
+        inline const Element* operator -> () const { return &m_set->m_slots[m_idx]; };
+
+        inline bool operator == (const const_Iterator& rhs) const { return m_set == rhs.m_set && m_idx == rhs.m_idx; }
+        inline bool operator != (const const_Iterator& rhs) const { return !(*this == rhs); }
+
+        inline const_Iterator& operator ++ ()    { m_idx = m_set->firstFull(m_idx + 1); return *this; }
+        inline const_Iterator  operator ++ (int) { const_Iterator temp(*this); ++(*this); return temp; }
+    };
+};
+
+}
+
+#endif // HASHSET_HPP
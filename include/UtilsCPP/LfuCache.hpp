@@ -0,0 +1,337 @@
+/*
+ * ---------------------------------------------------
+ * LfuCache.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:34:05
+ * ---------------------------------------------------
+ */
+
+#ifndef LFUCACHE_HPP
+# define LFUCACHE_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Func.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/HashSet.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+// Bounded cache evicting the least frequently used entry (the least recently used one among
+// equally used entries), every operation is O(1). Entries are grouped in buckets of equal use
+// count kept in increasing order, a use moves the entry to the bucket of the next count.
+// Same interface as LruCache, prefer it when a few keys are much hotter than the others and a
+// scan of cold keys must not flush them.
+template<typename Key, typename Value, typename Hash = utils::Hash<Key>, typename Equal = utils::Equal<Key>>
+class LfuCache
+{
+public:
+    using Size = uint64;
+
+    using Weigher          = Func<Size(const Key&, const Value&)>;
+    using EvictionCallback = Func<void(const Key&, Value&)>;
+
+    struct Stats
+    {
+        uint64 hits = 0;
+        uint64 misses = 0;
+        uint64 evictions = 0;
+    };
+
+public:
+    LfuCache()                = delete;
+    LfuCache(const LfuCache&) = delete;
+    LfuCache(LfuCache&&)      = delete;
+
+    explicit LfuCache(Size capacity, const Weigher& weigher = Weigher(), const Hash& hash = Hash(), const Equal& equal = Equal())
+        : m_index(NodeHash{hash}, NodeEqual{equal}), m_capacity(capacity), m_weigher(weigher)
+    {
+    }
+
+    inline Size size() const { return m_index.size(); }
+    inline bool isEmpty() const { return m_index.isEmpty(); }
+    inline Size weight() const { return m_weight; }
+    inline Size capacity() const { return m_capacity; }
+    inline const Stats& stats() const { return m_stats; }
+
+    inline void resetStats() { m_stats = Stats(); }
+
+    // called with the entries evicted to respect the capacity, not with the removed ones
+    inline void setEvictionCallback(const EvictionCallback& callback) { m_onEviction = callback; }
+
+    // shrinking the capacity evicts the least frequently used entries
+    void setCapacity(Size capacity)
+    {
+        m_capacity = capacity;
+        evict();
+    }
+
+    // does not count as a use
+    template<typename K>
+    inline bool contain(const K& key) const { return m_index.contain(key); }
+
+    // number of uses of the key (its insertion included), 0 if it is missing
+    template<typename K>
+    Size useCount(const K& key) const
+    {
+        typename Index::const_Iterator it = m_index.find(key);
+        return it == m_index.end() ? 0 : (*it)->bucket->count;
+    }
+
+    // nullptr if the key is missing, otherwise counts a use of the entry
+    template<typename K>
+    Value* get(const K& key)
+    {
+        typename Index::Iterator it = m_index.find(key);
+        if (it == m_index.end())
+        {
+            m_stats.misses++;
+            return nullptr;
+        }
+        m_stats.hits++;
+        Node* node = *it;
+        touch(node);
+        return &node->val;
+    }
+
+    // insert or replace the value of the key (replacing counts as a use), then evict until the cache fits
+    // in its capacity. An entry heavier than the whole capacity is evicted right away instead of flushing the cache
+    template<typename V>
+    void put(const Key& key, V&& val)
+    {
+        Node* node = nullptr;
+        typename Index::Iterator it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            node = *it;
+            node->val = std::forward<V>(val);
+            m_weight -= node->weight;
+            node->weight = weigh(node->key, node->val);
+            m_weight += node->weight;
+            touch(node);
+        }
+        else
+        {
+            node = new Node{key, Value(std::forward<V>(val)), 0, nullptr, nullptr, nullptr};
+            Bucket* bucket = nullptr;
+            try
+            {
+                node->weight = weigh(node->key, node->val);
+                if (m_lowest == nullptr || m_lowest->count != 1)
+                    bucket = new Bucket{1, nullptr, nullptr, nullptr, m_lowest};
+                m_index.insert(node);
+            }
+            catch (...)
+            {
+                delete bucket;
+                delete node;
+                throw;
+            }
+            if (bucket != nullptr)
+            {
+                if (m_lowest != nullptr)
+                    m_lowest->prev = bucket;
+                m_lowest = bucket;
+            }
+            m_weight += node->weight;
+            pushFront(m_lowest, node);
+        }
+        if (node->weight > m_capacity)
+            return evict(node);
+        evict();
+    }
+
+    // return false if the key was not in the cache
+    template<typename K>
+    bool remove(const K& key)
+    {
+        typename Index::Iterator it = m_index.find(key);
+        if (it == m_index.end())
+            return false;
+        Node* node = *it;
+        m_index.remove(it);
+        unlink(node);
+        m_weight -= node->weight;
+        delete node;
+        return true;
+    }
+
+    void clear()
+    {
+        Bucket* bucket = m_lowest;
+        while (bucket != nullptr)
+        {
+            Node* node = bucket->head;
+            while (node != nullptr)
+            {
+                Node* next = node->next;
+                delete node;
+                node = next;
+            }
+            Bucket* next = bucket->next;
+            delete bucket;
+            bucket = next;
+        }
+        m_index.clear();
+        m_lowest = nullptr;
+        m_weight = 0;
+    }
+
+    ~LfuCache()
+    {
+        clear();
+    }
+
+private:
+    struct Bucket;
+
+    struct Node
+    {
+        Key key;
+        Value val;
+        Size weight;
+        Bucket* bucket;
+        Node* prev;
+        Node* next;
+    };
+
+    // entries used count times, most recently used first
+    struct Bucket
+    {
+        Size count;
+        Node* head;
+        Node* tail;
+        Bucket* prev;
+        Bucket* next;
+    };
+
+    // the index stores the node pointers and looks them up by key
+    struct NodeHash
+    {
+        Hash keyHash;
+
+        inline uint64 operator () (Node* node) const { return keyHash(node->key); }
+
+        template<typename K>
+        inline uint64 operator () (const K& key) const { return keyHash(key); }
+    };
+
+    struct NodeEqual
+    {
+        Equal keyEqual;
+
+        inline bool operator () (Node* a, Node* b) const { return keyEqual(a->key, b->key); }
+
+        template<typename K>
+        inline bool operator () (Node* a, const K& b) const { return keyEqual(a->key, b); }
+    };
+
+    using Index = HashSet<Node*, NodeHash, NodeEqual>;
+
+    Index m_index;
+    Bucket* m_lowest = nullptr; // buckets are sorted by increasing count
+    Size m_capacity;
+    Size m_weight = 0;
+    Weigher m_weigher;
+    EvictionCallback m_onEviction;
+    Stats m_stats;
+
+    inline Size weigh(const Key& key, const Value& val) const { return m_weigher ? m_weigher(key, val) : 1; }
+
+    static void pushFront(Bucket* bucket, Node* node)
+    {
+        node->bucket = bucket;
+        node->prev = nullptr;
+        node->next = bucket->head;
+        if (bucket->head != nullptr)
+            bucket->head->prev = node;
+        else
+            bucket->tail = node;
+        bucket->head = node;
+    }
+
+    // also deletes the bucket of the node if it becomes empty
+    void unlink(Node* node)
+    {
+        Bucket* bucket = node->bucket;
+        if (node->prev != nullptr)
+            node->prev->next = node->next;
+        else
+            bucket->head = node->next;
+        if (node->next != nullptr)
+            node->next->prev = node->prev;
+        else
+            bucket->tail = node->prev;
+
+        if (bucket->head == nullptr)
+        {
+            if (bucket->prev != nullptr)
+                bucket->prev->next = bucket->next;
+            else
+                m_lowest = bucket->next;
+            if (bucket->next != nullptr)
+                bucket->next->prev = bucket->prev;
+            delete bucket;
+        }
+    }
+
+    void touch(Node* node)
+    {
+        Bucket* bucket = node->bucket;
+        Bucket* next = bucket->next;
+        if (next == nullptr || next->count != bucket->count + 1)
+        {
+            if (node->prev == nullptr && node->next == nullptr)
+            {
+                // alone in its bucket, which can take the next count in place
+                bucket->count++;
+                return;
+            }
+            next = new Bucket{bucket->count + 1, nullptr, nullptr, bucket, bucket->next};
+            if (bucket->next != nullptr)
+                bucket->next->prev = next;
+            bucket->next = next;
+        }
+        unlink(node);
+        pushFront(next, node);
+    }
+
+    void evict()
+    {
+        while (m_weight > m_capacity && m_lowest != nullptr)
+            evict(m_lowest->tail);
+    }
+
+    void evict(Node* node)
+    {
+        m_index.remove(node);
+        unlink(node);
+        m_weight -= node->weight;
+        m_stats.evictions++;
+        if (m_onEviction)
+        {
+            try
+            {
+                m_onEviction(node->key, node->val);
+            }
+            catch (...)
+            {
+                delete node;
+                throw;
+            }
+        }
+        delete node;
+    }
+
+public:
+    LfuCache& operator = (const LfuCache&) = delete;
+    LfuCache& operator = (LfuCache&&)      = delete;
+};
+
+}
+
+#endif // LFUCACHE_HPP
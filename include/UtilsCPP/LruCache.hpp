@@ -0,0 +1,273 @@
+/*
+ * ---------------------------------------------------
+ * LruCache.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:12:40
+ * ---------------------------------------------------
+ */
+
+#ifndef LRUCACHE_HPP
+# define LRUCACHE_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Func.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/HashSet.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+// Bounded cache evicting the least recently used entry, every operation is O(1).
+// Entries are nodes of a recency list indexed by a HashSet, so they never move: the pointer
+// returned by get stays valid until the entry is removed or evicted.
+// Without a weigher every entry weighs 1 and the capacity is a number of entries,
+// with a weigher the capacity is a budget in the weigher unit (bytes for example).
+template<typename Key, typename Value, typename Hash = utils::Hash<Key>, typename Equal = utils::Equal<Key>>
+class LruCache
+{
+public:
+    using Size = uint64;
+
+    using Weigher          = Func<Size(const Key&, const Value&)>;
+    using EvictionCallback = Func<void(const Key&, Value&)>;
+
+    struct Stats
+    {
+        uint64 hits = 0;
+        uint64 misses = 0;
+        uint64 evictions = 0;
+    };
+
+public:
+    LruCache()                = delete;
+    LruCache(const LruCache&) = delete;
+    LruCache(LruCache&&)      = delete;
+
+    explicit LruCache(Size capacity, const Weigher& weigher = Weigher(), const Hash& hash = Hash(), const Equal& equal = Equal())
+        : m_index(NodeHash{hash}, NodeEqual{equal}), m_capacity(capacity), m_weigher(weigher)
+    {
+    }
+
+    inline Size size() const { return m_index.size(); }
+    inline bool isEmpty() const { return m_index.isEmpty(); }
+    inline Size weight() const { return m_weight; }
+    inline Size capacity() const { return m_capacity; }
+    inline const Stats& stats() const { return m_stats; }
+
+    inline void resetStats() { m_stats = Stats(); }
+
+    // called with the entries evicted to respect the capacity, not with the removed ones
+    inline void setEvictionCallback(const EvictionCallback& callback) { m_onEviction = callback; }
+
+    // shrinking the capacity evicts the least recently used entries
+    void setCapacity(Size capacity)
+    {
+        m_capacity = capacity;
+        evict();
+    }
+
+    // does not count as a use
+    template<typename K>
+    inline bool contain(const K& key) const { return m_index.contain(key); }
+
+    // nullptr if the key is missing, otherwise the entry becomes the most recently used
+    template<typename K>
+    Value* get(const K& key)
+    {
+        typename Index::Iterator it = m_index.find(key);
+        if (it == m_index.end())
+        {
+            m_stats.misses++;
+            return nullptr;
+        }
+        m_stats.hits++;
+        Node* node = *it;
+        moveToFront(node);
+        return &node->val;
+    }
+
+    // insert or replace the value of the key, then evict until the cache fits in its capacity.
+    // An entry heavier than the whole capacity is evicted right away instead of flushing the cache
+    template<typename V>
+    void put(const Key& key, V&& val)
+    {
+        typename Index::Iterator it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            Node* node = *it;
+            node->val = std::forward<V>(val);
+            m_weight -= node->weight;
+            node->weight = weigh(node->key, node->val);
+            m_weight += node->weight;
+            moveToFront(node);
+        }
+        else
+        {
+            Node* node = new Node{key, Value(std::forward<V>(val)), 0, nullptr, nullptr};
+            try
+            {
+                node->weight = weigh(node->key, node->val);
+                m_index.insert(node);
+            }
+            catch (...)
+            {
+                delete node;
+                throw;
+            }
+            m_weight += node->weight;
+            pushFront(node);
+        }
+        if (m_head->weight > m_capacity)
+            return evict(m_head);
+        evict();
+    }
+
+    // return false if the key was not in the cache
+    template<typename K>
+    bool remove(const K& key)
+    {
+        typename Index::Iterator it = m_index.find(key);
+        if (it == m_index.end())
+            return false;
+        Node* node = *it;
+        m_index.remove(it);
+        unlink(node);
+        m_weight -= node->weight;
+        delete node;
+        return true;
+    }
+
+    void clear()
+    {
+        Node* node = m_head;
+        while (node != nullptr)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        m_index.clear();
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_weight = 0;
+    }
+
+    ~LruCache()
+    {
+        clear();
+    }
+
+private:
+    struct Node
+    {
+        Key key;
+        Value val;
+        Size weight;
+        Node* prev;
+        Node* next;
+    };
+
+    // the index stores the node pointers and looks them up by key
+    struct NodeHash
+    {
+        Hash keyHash;
+
+        inline uint64 operator () (Node* node) const { return keyHash(node->key); }
+
+        template<typename K>
+        inline uint64 operator () (const K& key) const { return keyHash(key); }
+    };
+
+    struct NodeEqual
+    {
+        Equal keyEqual;
+
+        inline bool operator () (Node* a, Node* b) const { return keyEqual(a->key, b->key); }
+
+        template<typename K>
+        inline bool operator () (Node* a, const K& b) const { return keyEqual(a->key, b); }
+    };
+
+    using Index = HashSet<Node*, NodeHash, NodeEqual>;
+
+    Index m_index;
+    Node* m_head = nullptr; // most recently used
+    Node* m_tail = nullptr; // least recently used
+    Size m_capacity;
+    Size m_weight = 0;
+    Weigher m_weigher;
+    EvictionCallback m_onEviction;
+    Stats m_stats;
+
+    inline Size weigh(const Key& key, const Value& val) const { return m_weigher ? m_weigher(key, val) : 1; }
+
+    void pushFront(Node* node)
+    {
+        node->prev = nullptr;
+        node->next = m_head;
+        if (m_head != nullptr)
+            m_head->prev = node;
+        else
+            m_tail = node;
+        m_head = node;
+    }
+
+    void unlink(Node* node)
+    {
+        if (node->prev != nullptr)
+            node->prev->next = node->next;
+        else
+            m_head = node->next;
+        if (node->next != nullptr)
+            node->next->prev = node->prev;
+        else
+            m_tail = node->prev;
+    }
+
+    inline void moveToFront(Node* node)
+    {
+        if (node == m_head)
+            return;
+        unlink(node);
+        pushFront(node);
+    }
+
+    void evict()
+    {
+        while (m_weight > m_capacity && m_tail != nullptr)
+            evict(m_tail);
+    }
+
+    void evict(Node* node)
+    {
+        m_index.remove(node);
+        unlink(node);
+        m_weight -= node->weight;
+        m_stats.evictions++;
+        if (m_onEviction)
+        {
+            try
+            {
+                m_onEviction(node->key, node->val);
+            }
+            catch (...)
+            {
+                delete node;
+                throw;
+            }
+        }
+        delete node;
+    }
+
+public:
+    LruCache& operator = (const LruCache&) = delete;
+    LruCache& operator = (LruCache&&)      = delete;
+};
+
+}
+
+#endif // LRUCACHE_HPP
@@ -38,4 +38,19 @@
     #define UTILSCPP_API
 #endif
 
+// hint to load the cache line of ptr for a read, used to overlap the cache misses of independent lookups
+#if defined(__GNUC__) || defined(__clang__)
+    #define UTILSCPP_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <xmmintrin.h>
+    #define UTILSCPP_PREFETCH(ptr) _mm_prefetch((const char*)(ptr), _MM_HINT_T0)
+#else
+    #define UTILSCPP_PREFETCH(ptr) ((void)(ptr))
+#endif
+
+// set when the relaxed constexpr rules of C++14 are available (loops and local variables)
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+    #define UTILSCPP_CXX14
+#endif
+
 #endif // UTILSCPP_MACROS_HPP
@@ -0,0 +1,41 @@
+/*
+ * ---------------------------------------------------
+ * NumberFormat.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 03:19:52
+ * ---------------------------------------------------
+ */
+
+#ifndef NUMBERFORMAT_HPP
+# define NUMBERFORMAT_HPP
+
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils
+{
+
+// Number to text conversions writing into a caller buffer. Nothing is allocated and no '\0' is
+// written, the functions return the number of characters written. A buffer of maxNumberLength
+// characters is large enough for any of them. StringBuilder::append uses them.
+
+constexpr uint64 maxNumberLength = 64; // binary digits of a uint64
+
+// decimal, digits written two at a time from a table of the 100 pairs
+UTILSCPP_API uint64 formatInt(char* buffer, long long value);
+UTILSCPP_API uint64 formatUInt(char* buffer, unsigned long long value);
+
+// lowercase digits without prefix, padded with zeros to minDigits (at most 16 for hex, 64 for binary)
+UTILSCPP_API uint64 formatHex(char* buffer, unsigned long long value, uint64 minDigits = 1);
+UTILSCPP_API uint64 formatBinary(char* buffer, unsigned long long value, uint64 minDigits = 1);
+
+// Shortest representation that reads back to the same value, the closest one to the exact value
+// when there are several (Ryu algorithm). Fixed notation for values in [1e-6, 1e21), scientific
+// otherwise: "0.1", "100", "1.5e-7", "1e+21". Special values are "nan", "inf" and "-inf".
+UTILSCPP_API uint64 formatDouble(char* buffer, double value);
+UTILSCPP_API uint64 formatFloat(char* buffer, float value);
+
+}
+
+#endif // NUMBERFORMAT_HPP
@@ -0,0 +1,63 @@
+/*
+ * ---------------------------------------------------
+ * NumberParse.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 04:09:18
+ * ---------------------------------------------------
+ */
+
+#ifndef NUMBERPARSE_HPP
+# define NUMBERPARSE_HPP
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils
+{
+
+// Text to number conversions reading a StringView (so a String or a C string) without allocating
+// or looking at the locale. Errors are returned, not thrown.
+
+enum class ParseError
+{
+    none,
+    invalid,   // no number at the start of the text
+    outOfRange // a number too large for the type
+};
+
+struct ParseResult
+{
+    uint64 length; // characters read, on error where the parsing stopped
+    ParseError error;
+
+    inline explicit operator bool () const { return error == ParseError::none; }
+};
+
+// Parse the number at the start of text, without skipping whitespaces. The number may be followed by
+// other characters, compare result.length with the length of the text to require a whole text number.
+// value is left unchanged on error.
+
+// an optional '-' (parseInt only) and decimal digits, eight digits at a time when possible
+UTILSCPP_API ParseResult parseInt(StringView text, long long& value);
+UTILSCPP_API ParseResult parseUInt(StringView text, unsigned long long& value);
+
+// "-12.5e3", ".5", "5.", "inf", "infinity" or "nan" (case insensitive), correctly rounded to the
+// nearest value (Eisel-Lemire, with a big decimal fallback for the rare undecidable cases of more
+// than 19 significant digits). Values too small for the type round to zero without error.
+UTILSCPP_API ParseResult parseDouble(StringView text, double& value);
+UTILSCPP_API ParseResult parseFloat(StringView text, float& value);
+
+// Parse the values of text separated by delimiter, skipping the whitespaces around them, and append
+// them to values. The parsing stops at the first invalid value: result.length is its position and
+// the values before it are kept. An empty text has no value.
+UTILSCPP_API ParseResult parseDelimited(StringView text, char delimiter, Array<long long>& values);
+UTILSCPP_API ParseResult parseDelimited(StringView text, char delimiter, Array<unsigned long long>& values);
+UTILSCPP_API ParseResult parseDelimited(StringView text, char delimiter, Array<double>& values);
+UTILSCPP_API ParseResult parseDelimited(StringView text, char delimiter, Array<float>& values);
+
+}
+
+#endif // NUMBERPARSE_HPP
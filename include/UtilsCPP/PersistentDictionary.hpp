@@ -0,0 +1,119 @@
+/*
+ * ---------------------------------------------------
+ * PersistentDictionary.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 11:40:52
+ * ---------------------------------------------------
+ */
+
+#ifndef PERSISTENTDICTIONARY_HPP
+# define PERSISTENTDICTIONARY_HPP
+
+#include "UtilsCPP/PersistentSet.hpp"
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Error.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+// Immutable Dictionary built on PersistentSet, see PersistentSet for the sharing and threading guarantees.
+template<typename Key, typename Value, typename Compare = utils::Compare<Key>>
+class PersistentDictionary
+{
+public:
+    ERROR_DEFF(KeyNoFoundError, "Key not in the dictionary");
+
+public:
+    struct KeyValPair
+    {
+        Key key;
+        Value val;
+    };
+
+    struct KeyValPairCompare
+    {
+        Compare keyCompare;
+
+        inline int operator () (const KeyValPair& a, const KeyValPair& b) const { return keyCompare(a.key, b.key); }
+
+        template<typename K>
+        inline int operator () (const KeyValPair& a, const K& b) const { return keyCompare(a.key, b); }
+    };
+
+public:
+    using DataStructure  = PersistentSet<KeyValPair, KeyValPairCompare>;
+    using Size           = typename DataStructure::Size;
+    using Iterator       = typename DataStructure::Iterator;
+    using const_Iterator = typename DataStructure::const_Iterator;
+
+public:
+    PersistentDictionary()                            = default;
+    PersistentDictionary(const PersistentDictionary&) = default;
+    PersistentDictionary(PersistentDictionary&&)      = default;
+
+    explicit PersistentDictionary(const Compare& compare) : m_data(KeyValPairCompare{compare})
+    {
+    }
+
+    template<typename K>
+    inline bool contain(const K& key) const { return m_data.contain(key); }
+    inline Size size() const { return m_data.size(); }
+    inline bool isEmpty() const { return m_data.isEmpty(); }
+
+    inline Iterator begin() const { return m_data.begin(); }
+    inline Iterator end()   const { return m_data.end(); }
+
+    template<typename K>
+    inline Iterator find(const K& key) const { return m_data.find(key); }
+
+    inline void insert(const Key& key, const Value& val) { m_data.insert(KeyValPair{key, val}); }
+    inline void insertOrAssign(const Key& key, const Value& val) { m_data.insertOrReplace(KeyValPair{key, val}); }
+
+    template<typename K>
+    inline bool remove(const K& key) { return m_data.remove(key); }
+
+    inline void clear() { m_data.clear(); }
+
+    // functional updates, this dictionary is left untouched
+    PersistentDictionary with(const Key& key, const Value& val) const
+    {
+        PersistentDictionary newDict = *this;
+        newDict.insertOrAssign(key, val);
+        return newDict;
+    }
+
+    template<typename K>
+    PersistentDictionary without(const K& key) const
+    {
+        PersistentDictionary newDict = *this;
+        newDict.remove(key);
+        return newDict;
+    }
+
+    ~PersistentDictionary() = default;
+
+private:
+    DataStructure m_data;
+
+public:
+    PersistentDictionary& operator = (const PersistentDictionary&) = default;
+    PersistentDictionary& operator = (PersistentDictionary&&)      = default;
+
+    template<typename K>
+    const Value& operator [] (const K& key) const
+    {
+        Iterator it = m_data.find(key);
+
+        if (it == m_data.end())
+            throw KeyNoFoundError();
+
+        return it->val;
+    }
+};
+
+}
+
+#endif // PERSISTENTDICTIONARY_HPP
@@ -0,0 +1,396 @@
+/*
+ * ---------------------------------------------------
+ * PersistentSet.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 11:02:17
+ * ---------------------------------------------------
+ */
+
+#ifndef PERSISTENTSET_HPP
+# define PERSISTENTSET_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Error.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+#include <initializer_list>
+#include <utility>
+
+namespace utils
+{
+
+// Immutable ordered set sharing unchanged subtrees between versions.
+// Nodes are never modified once built, an update copies the O(log n) nodes on the path
+// to the changed element (AVL balanced) and shares everything else with the previous version.
+// Copying a PersistentSet is O(1) and node reference counts are atomic, so a snapshot
+// can be handed to and released from other threads while the writer keeps updating its own copy.
+template<typename T, typename Compare = utils::Compare<T>>
+class PersistentSet
+{
+public:
+    ERROR_DEFF(DuplicateElementError, "Element already in the set");
+
+public:
+    using Element = T;
+    using Size    = uint64;
+
+    class Iterator;
+    using const_Iterator = Iterator;
+
+public:
+    PersistentSet() = default;
+
+    explicit PersistentSet(const Compare& compare) : m_compare(compare)
+    {
+    }
+
+    PersistentSet(const PersistentSet& cp) : m_root(retain(cp.m_root)), m_size(cp.m_size), m_compare(cp.m_compare)
+    {
+    }
+
+    PersistentSet(PersistentSet&& mv) noexcept : m_root(mv.m_root), m_size(mv.m_size), m_compare(mv.m_compare)
+    {
+        mv.m_root = nullptr;
+        mv.m_size = 0;
+    }
+
+    PersistentSet(std::initializer_list<Element> init_list)
+    {
+        for (const auto& elem : init_list)
+            insert(elem);
+    }
+
+    inline bool isEmpty() const { return m_root == nullptr; }
+    inline Size size() const { return m_size; }
+
+    Iterator begin() const
+    {
+        Iterator it;
+        it.pushLeftSpine(m_root);
+        return it;
+    }
+
+    inline Iterator end() const { return Iterator(); }
+
+    template<typename Y>
+    Iterator find(const Y& value) const
+    {
+        Iterator it;
+        const Node* curr = m_root;
+        while (curr != nullptr)
+        {
+            int cmp = m_compare(curr->value, value);
+            if (cmp == 0)
+            {
+                it.push(curr);
+                return it;
+            }
+            if (cmp > 0)
+            {
+                it.push(curr);
+                curr = curr->left;
+            }
+            else
+                curr = curr->right;
+        }
+        return Iterator();
+    }
+
+    template<typename Y>
+    bool contain(const Y& value) const
+    {
+        const Node* curr = m_root;
+        while (curr != nullptr)
+        {
+            int cmp = m_compare(curr->value, value);
+            if (cmp == 0)
+                return true;
+            curr = cmp > 0 ? curr->left : curr->right;
+        }
+        return false;
+    }
+
+    inline void insert(const Element& value) { insert(value, false); }
+
+    // replace the element comparing equal to value if there is one
+    inline void insertOrReplace(const Element& value) { insert(value, true); }
+
+    template<typename Y>
+    bool remove(const Y& value)
+    {
+        if (contain(value) == false)
+            return false;
+        const Node* newRoot = removeFromSubTree(m_root, value);
+        release(m_root);
+        m_root = newRoot;
+        m_size--;
+        return true;
+    }
+
+    inline void clear()
+    {
+        release(m_root);
+        m_root = nullptr;
+        m_size = 0;
+    }
+
+    ~PersistentSet()
+    {
+        release(m_root);
+    }
+
+private:
+    struct Node
+    {
+        Element value;
+        const Node* left;
+        const Node* right;
+        uint32 height;
+        mutable std::atomic<uint32> refCount;
+
+        Node(const Element& v, const Node* l, const Node* r)
+            : value(v), left(l), right(r), height(1 + (PersistentSet::height(l) > PersistentSet::height(r) ? PersistentSet::height(l) : PersistentSet::height(r))), refCount(1)
+        {
+        }
+
+        ~Node()
+        {
+            release(left);
+            release(right);
+        }
+    };
+
+    const Node* m_root = nullptr;
+    Size m_size = 0;
+    Compare m_compare;
+
+    static inline uint32 height(const Node* node) { return node == nullptr ? 0 : node->height; }
+
+    static inline const Node* retain(const Node* node)
+    {
+        if (node != nullptr)
+            node->refCount.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    static inline void release(const Node* node)
+    {
+        if (node != nullptr && node->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete node;
+    }
+
+    // takes ownership of the references to left and right
+    static const Node* balance(const Element& value, const Node* left, const Node* right)
+    {
+        if (height(left) > height(right) + 1)
+        {
+            const Node* newRoot = nullptr;
+            if (height(left->left) >= height(left->right))
+                newRoot = new Node(left->value, retain(left->left), new Node(value, retain(left->right), right));
+            else
+            {
+                const Node* lr = left->right;
+                newRoot = new Node(lr->value,
+                    new Node(left->value, retain(left->left), retain(lr->left)),
+                    new Node(value, retain(lr->right), right));
+            }
+            release(left);
+            return newRoot;
+        }
+        if (height(right) > height(left) + 1)
+        {
+            const Node* newRoot = nullptr;
+            if (height(right->right) >= height(right->left))
+                newRoot = new Node(right->value, new Node(value, left, retain(right->left)), retain(right->right));
+            else
+            {
+                const Node* rl = right->left;
+                newRoot = new Node(rl->value,
+                    new Node(value, left, retain(rl->left)),
+                    new Node(right->value, retain(rl->right), retain(right->right)));
+            }
+            release(right);
+            return newRoot;
+        }
+        return new Node(value, left, right);
+    }
+
+    void insert(const Element& value, bool replace)
+    {
+        bool replaced = false;
+        const Node* newRoot = insertInSubTree(m_root, value, replace, replaced);
+        release(m_root);
+        m_root = newRoot;
+        if (replaced == false)
+            m_size++;
+    }
+
+    const Node* insertInSubTree(const Node* root, const Element& value, bool replace, bool& replaced) const // NOLINT(misc-no-recursion)
+    {
+        if (root == nullptr)
+            return new Node(value, nullptr, nullptr);
+        int cmp = m_compare(root->value, value);
+        if (cmp == 0)
+        {
+            if (replace == false)
+                throw DuplicateElementError();
+            replaced = true;
+            return new Node(value, retain(root->left), retain(root->right));
+        }
+        if (cmp > 0)
+        {
+            const Node* newLeft = insertInSubTree(root->left, value, replace, replaced);
+            return balance(root->value, newLeft, retain(root->right));
+        }
+        const Node* newRight = insertInSubTree(root->right, value, replace, replaced);
+        return balance(root->value, retain(root->left), newRight);
+    }
+
+    static const Node* removeFirst(const Node* root, const Node** first) // NOLINT(misc-no-recursion)
+    {
+        if (root->left == nullptr)
+        {
+            *first = root;
+            return retain(root->right);
+        }
+        const Node* newLeft = removeFirst(root->left, first);
+        return balance(root->value, newLeft, retain(root->right));
+    }
+
+    template<typename Y>
+    const Node* removeFromSubTree(const Node* root, const Y& value) const // NOLINT(misc-no-recursion)
+    {
+        int cmp = m_compare(root->value, value);
+        if (cmp > 0)
+        {
+            const Node* newLeft = removeFromSubTree(root->left, value);
+            return balance(root->value, newLeft, retain(root->right));
+        }
+        if (cmp < 0)
+        {
+            const Node* newRight = removeFromSubTree(root->right, value);
+            return balance(root->value, retain(root->left), newRight);
+        }
+        if (root->left == nullptr)
+            return retain(root->right);
+        if (root->right == nullptr)
+            return retain(root->left);
+        const Node* first = nullptr;
+        const Node* newRight = removeFirst(root->right, &first);
+        return balance(first->value, retain(root->left), newRight);
+    }
+
+public:
+    PersistentSet& operator = (const PersistentSet& rhs)
+    {
+        if (&rhs != this)
+        {
+            const Node* old = m_root;
+            m_root = retain(rhs.m_root);
+            m_size = rhs.m_size;
+            m_compare = rhs.m_compare;
+            release(old);
+        }
+        return *this;
+    }
+
+    PersistentSet& operator = (PersistentSet&& rhs) noexcept
+    {
+        if (&rhs != this)
+        {
+            release(m_root);
+            m_root = rhs.m_root;
+            m_size = rhs.m_size;
+            m_compare = rhs.m_compare;
+            rhs.m_root = nullptr;
+            rhs.m_size = 0;
+        }
+        return *this;
+    }
+
+    bool operator == (const PersistentSet& rhs) const
+    {
+        if (m_size != rhs.m_size)
+            return false;
+        if (m_root == rhs.m_root)
+            return true;
+        Iterator itA = begin();
+        Iterator itB = rhs.begin();
+        for (; itA != end(); ++itA, ++itB)
+        {
+            if (m_compare(*itA, *itB) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    inline bool operator != (const PersistentSet& rhs) const { return !(*this == rhs); }
+
+    PersistentSet operator + (const Element& value) const
+    {
+        PersistentSet newSet = *this;
+        newSet.insert(value);
+        return newSet;
+    }
+
+    template<typename Y>
+    PersistentSet operator - (const Y& value) const
+    {
+        PersistentSet newSet = *this;
+        newSet.remove(value);
+        return newSet;
+    }
+
+public:
+    // In-order iterator, only valid while a PersistentSet sharing the iterated nodes is alive.
+    class Iterator
+    {
+    private:
+        friend class PersistentSet;
+
+        // an AVL tree of height 96 would need more than 2^64 nodes
+        static constexpr uint32 s_maxHeight = 96;
+
+    public:
+        Iterator()                   = default;
+        Iterator(const Iterator& cp) = default;
+        Iterator(Iterator&& mv)      = default;
+
+    private:
+        const Node* m_stack[s_maxHeight] = {};
+        uint32 m_depth = 0;
+
+        inline void push(const Node* node) { m_stack[m_depth++] = node; }
+
+        void pushLeftSpine(const Node* node)
+        {
+            for (; node != nullptr; node = node->left)
+                push(node);
+        }
+
+    public:
+        Iterator& operator = (const Iterator& cp) = default;
+        Iterator& operator = (Iterator&& mv)      = default;
+
+        inline const Element& operator  * () const { return  m_stack[m_depth - 1]->value; };
+        inline const Element* operator -> () const { return &m_stack[m_depth - 1]->value; };
+
+        inline bool operator == (const Iterator& rhs) const { return m_depth == rhs.m_depth && (m_depth == 0 || m_stack[m_depth - 1] == rhs.m_stack[m_depth - 1]); }
+        inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        Iterator& operator ++ ()
+        {
+            const Node* node = m_stack[--m_depth];
+            pushLeftSpine(node->right);
+            return *this;
+        }
+
+        inline Iterator operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+    };
+};
+
+}
+
+#endif // PERSISTENTSET_HPP
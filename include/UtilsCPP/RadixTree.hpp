@@ -0,0 +1,1189 @@
+/*
+ * ---------------------------------------------------
+ * RadixTree.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 22:05:31
+ * ---------------------------------------------------
+ */
+
+#ifndef RADIXTREE_HPP
+# define RADIXTREE_HPP
+
+#include "UtilsCPP/Error.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define UTILSCPP_RADIXTREE_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace utils
+{
+
+// String keyed map stored as an adaptive radix tree (ART): every inner node branches on one byte of
+// the key and grows from 4 to 16, 48 and 256 children as needed, chains of single child nodes are
+// compressed in the prefix of the next node. A lookup touches at most one node per distinguishing
+// byte and never compares whole keys except once at the leaf.
+// Keys are compared as bytes with an implicit '\0' terminator, so they must not contain '\0'.
+// Iteration is in byte-wise lexicographic order, leaves never move while they are in the tree but
+// iterators are invalidated by any insertion or removal.
+template<typename Value>
+class RadixTree
+{
+public:
+    ERROR_DEFF(DuplicateElementError, "Key already in the radix tree");
+    ERROR_DEFF(KeyNoFoundError, "Key not in the radix tree");
+
+public:
+    using Size = uint64;
+
+    struct KeyValPair
+    {
+        String key;
+        Value val;
+    };
+
+    // key argument of the lookups, built from a String, a StringView or a C string
+    struct KeyRef
+    {
+        const char* data;
+        Size length;
+
+        KeyRef(const char* str) : data(str), length(std::strlen(str)) {} // NOLINT(*-explicit-constructor)
+        KeyRef(const String& str) : data(str), length(str.length()) {}   // NOLINT(*-explicit-constructor)
+        KeyRef(StringView str) : data(str.data()), length(str.length()) {} // NOLINT(*-explicit-constructor)
+        KeyRef(const char* str, Size len) : data(str), length(len) {}
+    };
+
+    class Iterator;
+    class const_Iterator;
+
+    template<typename It> struct Range;
+
+public:
+    RadixTree() = default;
+
+    RadixTree(const RadixTree& cp) : RadixTree()
+    {
+        cp.forEach([&](const KeyValPair& pair) { insert(pair.key, pair.val); });
+    }
+
+    RadixTree(RadixTree&& mv) noexcept : m_root(mv.m_root), m_size(mv.m_size), m_memory(mv.m_memory)
+    {
+        mv.m_root = nullptr;
+        mv.m_size = 0;
+        mv.m_memory = 0;
+    }
+
+    inline Size size() const { return m_size; }
+    inline bool isEmpty() const { return m_size == 0; }
+
+    // bytes allocated by the nodes and the leaves (keys included)
+    inline Size memoryUsage() const { return m_memory; }
+
+    inline bool contain(const KeyRef& key) const { return findLeaf(key) != nullptr; }
+
+    // nullptr if the key is missing
+    inline Value* find(const KeyRef& key)
+    {
+        Leaf* leaf = findLeaf(key);
+        return leaf != nullptr ? &leaf->val : nullptr;
+    }
+
+    inline const Value* find(const KeyRef& key) const
+    {
+        const Leaf* leaf = findLeaf(key);
+        return leaf != nullptr ? &leaf->val : nullptr;
+    }
+
+    template<typename V>
+    Value& insert(const KeyRef& key, V&& val)
+    {
+        bool inserted = false;
+        Leaf* leaf = insertLeaf(key, [&]() { return new Leaf{makeKey(key), Value(std::forward<V>(val))}; }, inserted);
+        if (inserted == false)
+            throw DuplicateElementError();
+        return leaf->val;
+    }
+
+    template<typename V>
+    Value& insertOrAssign(const KeyRef& key, V&& val)
+    {
+        bool inserted = false;
+        Leaf* leaf = insertLeaf(key, [&]() { return new Leaf{makeKey(key), Value(std::forward<V>(val))}; }, inserted);
+        if (inserted == false)
+            leaf->val = std::forward<V>(val);
+        return leaf->val;
+    }
+
+    // return false if the key was not in the tree
+    bool remove(const KeyRef& key)
+    {
+        Leaf* leaf = removeLeaf(&m_root, m_root, key, 0);
+        if (leaf == nullptr)
+            return false;
+        deleteLeaf(leaf);
+        return true;
+    }
+
+    // entry with the longest key that is a prefix of key (key itself included), nullptr if there is none
+    const KeyValPair* longestPrefixMatch(const KeyRef& key) const
+    {
+        const Leaf* best = nullptr;
+        Node* node = m_root;
+        Size depth = 0;
+        while (node != nullptr)
+        {
+            if (isLeaf(node))
+            {
+                if (isPrefixOf(asLeaf(node), key))
+                    best = asLeaf(node);
+                break;
+            }
+            if (node->prefixLength > 0)
+            {
+                if (checkPrefix(node, key, depth) != min(node->prefixLength, s_maxPrefixLength))
+                    break;
+                depth += node->prefixLength;
+                if (depth > key.length)
+                    break;
+            }
+            Node* const* terminator = findChild(node, 0);
+            if (terminator != nullptr && isPrefixOf(asLeaf(*terminator), key))
+                best = asLeaf(*terminator);
+            if (depth == key.length)
+                break;
+            Node* const* child = findChild(node, (byte)key.data[depth]);
+            node = child != nullptr ? *child : nullptr;
+            depth++;
+        }
+        return best;
+    }
+
+    // in key order
+    inline       Iterator begin()       { return       Iterator(m_root); }
+    inline const_Iterator begin() const { return const_Iterator(m_root); }
+    inline       Iterator end()         { return       Iterator(); }
+    inline const_Iterator end()   const { return const_Iterator(); }
+
+    // the entries whose key starts with prefix, in key order
+    inline Range<Iterator>       withPrefix(const KeyRef& prefix)       { return Range<Iterator>{ Iterator(prefixRoot(prefix)), Iterator() }; }
+    inline Range<const_Iterator> withPrefix(const KeyRef& prefix) const { return Range<const_Iterator>{ const_Iterator(prefixRoot(prefix)), const_Iterator() }; }
+
+    // function(const KeyValPair&) on every entry in key order
+    template<typename Function>
+    inline void forEach(const Function& function) const
+    {
+        for (const KeyValPair& pair : *this)
+            function(pair);
+    }
+
+    // function(const KeyValPair&) on the entries whose key starts with prefix, in key order
+    template<typename Function>
+    inline void forEachWithPrefix(const KeyRef& prefix, const Function& function) const
+    {
+        for (const KeyValPair& pair : withPrefix(prefix))
+            function(pair);
+    }
+
+    void clear()
+    {
+        if (m_root != nullptr)
+            deleteNode(m_root);
+        m_root = nullptr;
+        m_size = 0;
+        m_memory = 0;
+    }
+
+    ~RadixTree()
+    {
+        clear();
+    }
+
+private:
+    static constexpr Size s_maxPrefixLength = 10;
+
+    enum class NodeType : byte { node4, node16, node48, node256 };
+
+    struct Node
+    {
+        NodeType type;
+        uint16 childCount;
+        uint32 prefixLength;
+        byte prefix[s_maxPrefixLength]; // the first bytes of the prefix, the others are read in the minimum leaf
+
+        explicit Node(NodeType t) : type(t), childCount(0), prefixLength(0), prefix{} {}
+    };
+
+    // the children of the small nodes are sorted by key byte
+    struct Node4 : Node
+    {
+        byte keys[4] = {};
+        Node* children[4] = {};
+
+        Node4() : Node(NodeType::node4) {}
+    };
+
+    struct Node16 : Node
+    {
+        byte keys[16] = {};
+        Node* children[16] = {};
+
+        Node16() : Node(NodeType::node16) {}
+    };
+
+    struct Node48 : Node
+    {
+        byte childIndex[256] = {}; // 0 for no child, otherwise index + 1 in children
+        Node* children[48] = {};
+
+        Node48() : Node(NodeType::node48) {}
+    };
+
+    struct Node256 : Node
+    {
+        Node* children[256] = {};
+
+        Node256() : Node(NodeType::node256) {}
+    };
+
+    // leaves are stored in the child pointers with the low bit set
+    using Leaf = KeyValPair;
+
+    Node* m_root = nullptr;
+    Size m_size = 0;
+    Size m_memory = 0;
+
+    static inline Size min(Size a, Size b) { return a < b ? a : b; }
+
+    static inline bool isLeaf(const Node* node) { return (reinterpret_cast<uintptr_t>(node) & 1) != 0; }
+    static inline Leaf* asLeaf(const Node* node) { return reinterpret_cast<Leaf*>(reinterpret_cast<uintptr_t>(node) & ~(uintptr_t)1); }
+    static inline Node* tagLeaf(Leaf* leaf) { return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(leaf) | 1); }
+
+    // byte of the key at depth, the terminator at depth == length
+    static inline byte keyByte(const KeyRef& key, Size depth) { return depth < key.length ? (byte)key.data[depth] : 0; }
+    static inline byte keyByte(const Leaf* leaf, Size depth) { return (byte)((const char*)leaf->key)[depth]; }
+
+    static inline bool matches(const Leaf* leaf, const KeyRef& key)
+    {
+        return leaf->key.length() == key.length && std::memcmp((const char*)leaf->key, key.data, key.length) == 0;
+    }
+
+    static inline bool isPrefixOf(const Leaf* leaf, const KeyRef& key)
+    {
+        return leaf->key.length() <= key.length && std::memcmp((const char*)leaf->key, key.data, leaf->key.length()) == 0;
+    }
+
+    static inline String makeKey(const KeyRef& key) { return String(key.data, key.length); }
+
+    // number of stored prefix bytes matching the key, the bytes beyond the stored ones are not checked
+    static Size checkPrefix(const Node* node, const KeyRef& key, Size depth)
+    {
+        Size count = min(min(node->prefixLength, s_maxPrefixLength), key.length + 1 - depth);
+        Size i = 0;
+        while (i < count && node->prefix[i] == keyByte(key, depth + i))
+            i++;
+        return i;
+    }
+
+    // number of prefix bytes matching the key, checking the whole prefix
+    static Size prefixMismatch(const Node* node, const KeyRef& key, Size depth)
+    {
+        Size count = min(min(node->prefixLength, s_maxPrefixLength), key.length + 1 - depth);
+        Size i = 0;
+        while (i < count && node->prefix[i] == keyByte(key, depth + i))
+            i++;
+        if (i < count || node->prefixLength <= s_maxPrefixLength)
+            return i;
+        const Leaf* leaf = minimum(node);
+        count = min(leaf->key.length(), key.length) + 1 - depth;
+        while (i < count && keyByte(leaf, depth + i) == keyByte(key, depth + i))
+            i++;
+        return i;
+    }
+
+    static const Leaf* minimum(const Node* node)
+    {
+        while (isLeaf(node) == false)
+        {
+            switch (node->type)
+            {
+            case NodeType::node4:
+                node = static_cast<const Node4*>(node)->children[0];
+                break;
+            case NodeType::node16:
+                node = static_cast<const Node16*>(node)->children[0];
+                break;
+            case NodeType::node48:
+            {
+                const Node48* n = static_cast<const Node48*>(node);
+                Size c = 0;
+                while (n->childIndex[c] == 0)
+                    c++;
+                node = n->children[n->childIndex[c] - 1];
+                break;
+            }
+            case NodeType::node256:
+            {
+                const Node256* n = static_cast<const Node256*>(node);
+                Size c = 0;
+                while (n->children[c] == nullptr)
+                    c++;
+                node = n->children[c];
+                break;
+            }
+            }
+        }
+        return asLeaf(node);
+    }
+
+    static Node* const* findChild(const Node* node, byte c)
+    {
+        switch (node->type)
+        {
+        case NodeType::node4:
+        {
+            const Node4* n = static_cast<const Node4*>(node);
+            for (Size i = 0; i < n->childCount; i++)
+            {
+                if (n->keys[i] == c)
+                    return &n->children[i];
+            }
+            return nullptr;
+        }
+        case NodeType::node16:
+        {
+            const Node16* n = static_cast<const Node16*>(node);
+#ifdef UTILSCPP_RADIXTREE_SSE2
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)c), _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys)));
+            uint32 mask = (uint32)_mm_movemask_epi8(cmp) & ((1u << n->childCount) - 1);
+            if (mask == 0)
+                return nullptr;
+            Size i = 0;
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                i++;
+            }
+            return &n->children[i];
+#else
+            for (Size i = 0; i < n->childCount; i++)
+            {
+                if (n->keys[i] == c)
+                    return &n->children[i];
+            }
+            return nullptr;
+#endif
+        }
+        case NodeType::node48:
+        {
+            const Node48* n = static_cast<const Node48*>(node);
+            return n->childIndex[c] != 0 ? &n->children[n->childIndex[c] - 1] : nullptr;
+        }
+        case NodeType::node256:
+        {
+            const Node256* n = static_cast<const Node256*>(node);
+            return n->children[c] != nullptr ? &n->children[c] : nullptr;
+        }
+        }
+        UNREACHABLE
+    }
+
+    static inline Node** findChild(Node* node, byte c) { return const_cast<Node**>(findChild(static_cast<const Node*>(node), c)); }
+
+    // first child at position pos or after in key order, pos being the index in the children of the small
+    // nodes and the key byte in the others. nullptr if there is none
+    static Node* nextChild(const Node* node, Size& pos)
+    {
+        switch (node->type)
+        {
+        case NodeType::node4:
+        {
+            const Node4* n = static_cast<const Node4*>(node);
+            return pos < n->childCount ? n->children[pos] : nullptr;
+        }
+        case NodeType::node16:
+        {
+            const Node16* n = static_cast<const Node16*>(node);
+            return pos < n->childCount ? n->children[pos] : nullptr;
+        }
+        case NodeType::node48:
+        {
+            const Node48* n = static_cast<const Node48*>(node);
+            while (pos < 256 && n->childIndex[pos] == 0)
+                pos++;
+            return pos < 256 ? n->children[n->childIndex[pos] - 1] : nullptr;
+        }
+        case NodeType::node256:
+        {
+            const Node256* n = static_cast<const Node256*>(node);
+            while (pos < 256 && n->children[pos] == nullptr)
+                pos++;
+            return pos < 256 ? n->children[pos] : nullptr;
+        }
+        }
+        UNREACHABLE
+    }
+
+    // node (or tagged leaf) holding exactly the entries whose key starts with prefix, nullptr if there is none
+    const Node* prefixRoot(const KeyRef& prefix) const
+    {
+        const Node* node = m_root;
+        Size depth = 0;
+        while (node != nullptr)
+        {
+            if (isLeaf(node))
+            {
+                const Leaf* leaf = asLeaf(node);
+                if (leaf->key.length() >= prefix.length && std::memcmp((const char*)leaf->key, prefix.data, prefix.length) == 0)
+                    return node;
+                return nullptr;
+            }
+            if (depth == prefix.length)
+                return node;
+            if (node->prefixLength > 0)
+            {
+                // all the keys under the node share its prefix, compare it with the minimum leaf when it is not stored whole
+                Size count = min(node->prefixLength, prefix.length - depth);
+                const char* bytes = count <= s_maxPrefixLength ? (const char*)node->prefix : (const char*)minimum(node)->key + depth;
+                if (std::memcmp(bytes, prefix.data + depth, count) != 0)
+                    return nullptr;
+                depth += node->prefixLength;
+                if (depth >= prefix.length)
+                    return node;
+            }
+            Node* const* child = findChild(node, (byte)prefix.data[depth]);
+            node = child != nullptr ? *child : nullptr;
+            depth++;
+        }
+        return nullptr;
+    }
+
+    // position of an iterator: the current leaf and the stack of the inner nodes above it, up to the
+    // root of the iterated subtree, with the position of the child taken in each (see nextChild).
+    // The first s_inlineDepth levels are stored in the cursor, deeper trees use a heap buffer
+    class Cursor
+    {
+    public:
+        Cursor() = default;
+
+        explicit Cursor(const Node* root)
+        {
+            if (root != nullptr)
+                descend(root);
+        }
+
+        Cursor(const Cursor& cp) : m_leaf(cp.m_leaf)
+        {
+            reserve(cp.m_depth);
+            std::memcpy(m_frames, cp.m_frames, sizeof(Frame) * cp.m_depth);
+            m_depth = cp.m_depth;
+        }
+
+        Cursor(Cursor&& mv) noexcept : m_leaf(mv.m_leaf), m_depth(mv.m_depth), m_capacity(mv.m_capacity)
+        {
+            if (mv.m_frames == mv.m_inline)
+                std::memcpy(m_inline, mv.m_inline, sizeof(Frame) * mv.m_depth);
+            else
+                m_frames = mv.m_frames;
+            mv.m_frames = mv.m_inline;
+            mv.m_capacity = s_inlineDepth;
+            mv.m_depth = 0;
+            mv.m_leaf = nullptr;
+        }
+
+        inline Leaf* leaf() const { return m_leaf; }
+
+        // to the next leaf of the subtree, nullptr after the last one
+        void advance()
+        {
+            while (m_depth > 0)
+            {
+                Frame& frame = m_frames[m_depth - 1];
+                Size pos = frame.pos + 1;
+                const Node* child = nextChild(frame.node, pos);
+                if (child != nullptr)
+                {
+                    frame.pos = pos;
+                    return descend(child);
+                }
+                m_depth--;
+            }
+            m_leaf = nullptr;
+        }
+
+        ~Cursor()
+        {
+            if (m_frames != m_inline)
+                operator delete (m_frames);
+        }
+
+    private:
+        static constexpr Size s_inlineDepth = 8;
+
+        struct Frame
+        {
+            const Node* node;
+            Size pos;
+        };
+
+        Leaf* m_leaf = nullptr;
+        Frame m_inline[s_inlineDepth];
+        Frame* m_frames = m_inline;
+        Size m_depth = 0;
+        Size m_capacity = s_inlineDepth;
+
+        // to the minimum leaf under node
+        void descend(const Node* node)
+        {
+            while (isLeaf(node) == false)
+            {
+                Size pos = 0;
+                const Node* child = nextChild(node, pos);
+                reserve(m_depth + 1);
+                m_frames[m_depth++] = Frame{ node, pos };
+                node = child;
+            }
+            m_leaf = asLeaf(node);
+        }
+
+        void reserve(Size depth)
+        {
+            if (depth <= m_capacity)
+                return;
+            Size capacity = m_capacity;
+            while (capacity < depth)
+                capacity *= 2;
+            Frame* frames = (Frame*)operator new (sizeof(Frame) * capacity);
+            std::memcpy(frames, m_frames, sizeof(Frame) * m_depth);
+            if (m_frames != m_inline)
+                operator delete (m_frames);
+            m_frames = frames;
+            m_capacity = capacity;
+        }
+
+    public:
+        Cursor& operator = (const Cursor& cp)
+        {
+            if (this != &cp)
+            {
+                m_depth = 0;
+                reserve(cp.m_depth);
+                std::memcpy(m_frames, cp.m_frames, sizeof(Frame) * cp.m_depth);
+                m_depth = cp.m_depth;
+                m_leaf = cp.m_leaf;
+            }
+            return *this;
+        }
+
+        Cursor& operator = (Cursor&& mv) noexcept
+        {
+            if (this != &mv)
+            {
+                if (m_frames != m_inline)
+                    operator delete (m_frames);
+                m_frames = m_inline;
+                if (mv.m_frames == mv.m_inline)
+                    std::memcpy(m_inline, mv.m_inline, sizeof(Frame) * mv.m_depth);
+                else
+                    m_frames = mv.m_frames;
+                m_leaf = mv.m_leaf;
+                m_depth = mv.m_depth;
+                m_capacity = mv.m_capacity;
+                mv.m_frames = mv.m_inline;
+                mv.m_capacity = s_inlineDepth;
+                mv.m_depth = 0;
+                mv.m_leaf = nullptr;
+            }
+            return *this;
+        }
+    };
+
+    Leaf* findLeaf(const KeyRef& key) const
+    {
+        Node* node = m_root;
+        Size depth = 0;
+        while (node != nullptr)
+        {
+            if (isLeaf(node))
+                return matches(asLeaf(node), key) ? asLeaf(node) : nullptr;
+            if (node->prefixLength > 0)
+            {
+                if (checkPrefix(node, key, depth) != min(node->prefixLength, s_maxPrefixLength))
+                    return nullptr;
+                depth += node->prefixLength;
+            }
+            if (depth > key.length)
+                return nullptr;
+            Node* const* child = findChild(node, keyByte(key, depth));
+            node = child != nullptr ? *child : nullptr;
+            depth++;
+        }
+        return nullptr;
+    }
+
+    template<typename T>
+    T* newNode()
+    {
+        T* node = new T();
+        m_memory += sizeof(T);
+        return node;
+    }
+
+    // nullptr if the allocation failed, only used to shrink nodes which is optional
+    template<typename T>
+    T* tryNewNode()
+    {
+        T* node = new (std::nothrow) T();
+        if (node != nullptr)
+            m_memory += sizeof(T);
+        return node;
+    }
+
+    void freeNode(Node* node)
+    {
+        switch (node->type)
+        {
+        case NodeType::node4:   m_memory -= sizeof(Node4);   delete static_cast<Node4*>(node);   break;
+        case NodeType::node16:  m_memory -= sizeof(Node16);  delete static_cast<Node16*>(node);  break;
+        case NodeType::node48:  m_memory -= sizeof(Node48);  delete static_cast<Node48*>(node);  break;
+        case NodeType::node256: m_memory -= sizeof(Node256); delete static_cast<Node256*>(node); break;
+        }
+    }
+
+    template<typename Make>
+    Leaf* newLeaf(const Make& make)
+    {
+        Leaf* leaf = make();
+        m_memory += sizeof(Leaf) + leaf->key.capacity();
+        m_size++;
+        return leaf;
+    }
+
+    void deleteLeaf(Leaf* leaf)
+    {
+        m_memory -= sizeof(Leaf) + leaf->key.capacity();
+        m_size--;
+        delete leaf;
+    }
+
+    // also deletes the children
+    void deleteNode(Node* node)
+    {
+        if (isLeaf(node))
+            return deleteLeaf(asLeaf(node));
+        switch (node->type)
+        {
+        case NodeType::node4:
+        {
+            Node4* n = static_cast<Node4*>(node);
+            for (Size i = 0; i < n->childCount; i++)
+                deleteNode(n->children[i]);
+            break;
+        }
+        case NodeType::node16:
+        {
+            Node16* n = static_cast<Node16*>(node);
+            for (Size i = 0; i < n->childCount; i++)
+                deleteNode(n->children[i]);
+            break;
+        }
+        case NodeType::node48:
+        {
+            Node48* n = static_cast<Node48*>(node);
+            for (Size i = 0; i < 48; i++)
+            {
+                if (n->children[i] != nullptr)
+                    deleteNode(n->children[i]);
+            }
+            break;
+        }
+        case NodeType::node256:
+        {
+            Node256* n = static_cast<Node256*>(node);
+            for (Size c = 0; c < 256; c++)
+            {
+                if (n->children[c] != nullptr)
+                    deleteNode(n->children[c]);
+            }
+            break;
+        }
+        }
+        freeNode(node);
+    }
+
+    static void copyHeader(Node* dst, const Node* src)
+    {
+        dst->childCount = src->childCount;
+        dst->prefixLength = src->prefixLength;
+        std::memcpy(dst->prefix, src->prefix, min(src->prefixLength, s_maxPrefixLength));
+    }
+
+    // insert in a sorted small node which is not full
+    template<typename N>
+    static void insertSorted(N* node, byte c, Node* child)
+    {
+        Size i = 0;
+        while (i < node->childCount && node->keys[i] < c)
+            i++;
+        std::memmove(node->keys + i + 1, node->keys + i, node->childCount - i);
+        std::memmove(node->children + i + 1, node->children + i, (node->childCount - i) * sizeof(Node*));
+        node->keys[i] = c;
+        node->children[i] = child;
+        node->childCount++;
+    }
+
+    // add a child to node, replacing it (in ref) by a larger node if it is full.
+    // the larger node is allocated before anything is changed
+    void addChild(Node** ref, Node* node, byte c, Node* child)
+    {
+        switch (node->type)
+        {
+        case NodeType::node4:
+        {
+            Node4* n = static_cast<Node4*>(node);
+            if (n->childCount < 4)
+                return insertSorted(n, c, child);
+            Node16* grown = newNode<Node16>();
+            copyHeader(grown, n);
+            std::memcpy(grown->keys, n->keys, 4);
+            std::memcpy(grown->children, n->children, 4 * sizeof(Node*));
+            insertSorted(grown, c, child);
+            *ref = grown;
+            freeNode(n);
+            return;
+        }
+        case NodeType::node16:
+        {
+            Node16* n = static_cast<Node16*>(node);
+            if (n->childCount < 16)
+                return insertSorted(n, c, child);
+            Node48* grown = newNode<Node48>();
+            copyHeader(grown, n);
+            for (Size i = 0; i < 16; i++)
+            {
+                grown->children[i] = n->children[i];
+                grown->childIndex[n->keys[i]] = (byte)(i + 1);
+            }
+            grown->children[16] = child;
+            grown->childIndex[c] = 17;
+            grown->childCount++;
+            *ref = grown;
+            freeNode(n);
+            return;
+        }
+        case NodeType::node48:
+        {
+            Node48* n = static_cast<Node48*>(node);
+            if (n->childCount < 48)
+            {
+                Size i = 0;
+                while (n->children[i] != nullptr)
+                    i++;
+                n->children[i] = child;
+                n->childIndex[c] = (byte)(i + 1);
+                n->childCount++;
+                return;
+            }
+            Node256* grown = newNode<Node256>();
+            copyHeader(grown, n);
+            for (Size b = 0; b < 256; b++)
+            {
+                if (n->childIndex[b] != 0)
+                    grown->children[b] = n->children[n->childIndex[b] - 1];
+            }
+            grown->children[c] = child;
+            grown->childCount++;
+            *ref = grown;
+            freeNode(n);
+            return;
+        }
+        case NodeType::node256:
+        {
+            Node256* n = static_cast<Node256*>(node);
+            n->children[c] = child;
+            n->childCount++;
+            return;
+        }
+        }
+    }
+
+    // remove the child in slot from node, replacing it (in ref) by a smaller node when it gets sparse
+    void removeChild(Node** ref, Node* node, byte c, Node** slot)
+    {
+        switch (node->type)
+        {
+        case NodeType::node4:
+        {
+            Node4* n = static_cast<Node4*>(node);
+            Size i = (Size)(slot - n->children);
+            std::memmove(n->keys + i, n->keys + i + 1, n->childCount - i - 1);
+            std::memmove(n->children + i, n->children + i + 1, (n->childCount - i - 1) * sizeof(Node*));
+            n->childCount--;
+            if (n->childCount == 1)
+            {
+                // the node is a useless branch, merge it with its remaining child
+                Node* child = n->children[0];
+                if (isLeaf(child) == false)
+                {
+                    Size length = n->prefixLength;
+                    if (length < s_maxPrefixLength)
+                        n->prefix[length] = n->keys[0];
+                    length++;
+                    if (length < s_maxPrefixLength)
+                        std::memcpy(n->prefix + length, child->prefix, min(child->prefixLength, s_maxPrefixLength - length));
+                    std::memcpy(child->prefix, n->prefix, min(length + child->prefixLength, s_maxPrefixLength));
+                    child->prefixLength += (uint32)length;
+                }
+                *ref = child;
+                freeNode(n);
+            }
+            return;
+        }
+        case NodeType::node16:
+        {
+            Node16* n = static_cast<Node16*>(node);
+            Size i = (Size)(slot - n->children);
+            std::memmove(n->keys + i, n->keys + i + 1, n->childCount - i - 1);
+            std::memmove(n->children + i, n->children + i + 1, (n->childCount - i - 1) * sizeof(Node*));
+            n->childCount--;
+            if (n->childCount == 3)
+            {
+                Node4* shrunk = tryNewNode<Node4>();
+                if (shrunk == nullptr)
+                    return;
+                copyHeader(shrunk, n);
+                std::memcpy(shrunk->keys, n->keys, 3);
+                std::memcpy(shrunk->children, n->children, 3 * sizeof(Node*));
+                *ref = shrunk;
+                freeNode(n);
+            }
+            return;
+        }
+        case NodeType::node48:
+        {
+            Node48* n = static_cast<Node48*>(node);
+            n->children[n->childIndex[c] - 1] = nullptr;
+            n->childIndex[c] = 0;
+            n->childCount--;
+            if (n->childCount == 12)
+            {
+                Node16* shrunk = tryNewNode<Node16>();
+                if (shrunk == nullptr)
+                    return;
+                copyHeader(shrunk, n);
+                Size count = 0;
+                for (Size b = 0; b < 256; b++)
+                {
+                    if (n->childIndex[b] != 0)
+                    {
+                        shrunk->keys[count] = (byte)b;
+                        shrunk->children[count] = n->children[n->childIndex[b] - 1];
+                        count++;
+                    }
+                }
+                *ref = shrunk;
+                freeNode(n);
+            }
+            return;
+        }
+        case NodeType::node256:
+        {
+            Node256* n = static_cast<Node256*>(node);
+            n->children[c] = nullptr;
+            n->childCount--;
+            if (n->childCount == 37)
+            {
+                Node48* shrunk = tryNewNode<Node48>();
+                if (shrunk == nullptr)
+                    return;
+                copyHeader(shrunk, n);
+                Size count = 0;
+                for (Size b = 0; b < 256; b++)
+                {
+                    if (n->children[b] != nullptr)
+                    {
+                        shrunk->children[count] = n->children[b];
+                        shrunk->childIndex[b] = (byte)(count + 1);
+                        count++;
+                    }
+                }
+                *ref = shrunk;
+                freeNode(n);
+            }
+            return;
+        }
+        }
+    }
+
+    // existing leaf of the key (inserted = false) or the new leaf returned by make()
+    template<typename Make>
+    Leaf* insertLeaf(const KeyRef& key, const Make& make, bool& inserted)
+    {
+        Node** ref = &m_root;
+        Size depth = 0;
+        while (true)
+        {
+            Node* node = *ref;
+            if (node == nullptr)
+            {
+                Leaf* leaf = newLeaf(make);
+                *ref = tagLeaf(leaf);
+                inserted = true;
+                return leaf;
+            }
+
+            if (isLeaf(node))
+            {
+                Leaf* existing = asLeaf(node);
+                if (matches(existing, key))
+                {
+                    inserted = false;
+                    return existing;
+                }
+                // both keys go under a new node holding their common prefix
+                Size common = 0;
+                while (keyByte(existing, depth + common) == keyByte(key, depth + common))
+                    common++;
+                Node4* branch = newNode<Node4>();
+                Leaf* leaf = nullptr;
+                try
+                {
+                    leaf = newLeaf(make);
+                }
+                catch (...)
+                {
+                    freeNode(branch);
+                    throw;
+                }
+                branch->prefixLength = (uint32)common;
+                for (Size i = 0; i < min(common, s_maxPrefixLength); i++)
+                    branch->prefix[i] = keyByte(key, depth + i);
+                insertSorted(branch, keyByte(existing, depth + common), node);
+                insertSorted(branch, keyByte(key, depth + common), tagLeaf(leaf));
+                *ref = branch;
+                inserted = true;
+                return leaf;
+            }
+
+            if (node->prefixLength > 0)
+            {
+                Size matching = prefixMismatch(node, key, depth);
+                if (matching < node->prefixLength)
+                {
+                    // the key leaves the prefix, split it with a new node
+                    Node4* branch = newNode<Node4>();
+                    Leaf* leaf = nullptr;
+                    try
+                    {
+                        leaf = newLeaf(make);
+                    }
+                    catch (...)
+                    {
+                        freeNode(branch);
+                        throw;
+                    }
+                    branch->prefixLength = (uint32)matching;
+                    std::memcpy(branch->prefix, node->prefix, min(matching, s_maxPrefixLength));
+                    if (node->prefixLength <= s_maxPrefixLength)
+                    {
+                        insertSorted(branch, node->prefix[matching], node);
+                        node->prefixLength -= (uint32)(matching + 1);
+                        std::memmove(node->prefix, node->prefix + matching + 1, node->prefixLength);
+                    }
+                    else
+                    {
+                        const Leaf* first = minimum(node);
+                        insertSorted(branch, keyByte(first, depth + matching), node);
+                        node->prefixLength -= (uint32)(matching + 1);
+                        std::memcpy(node->prefix, (const char*)first->key + depth + matching + 1, min(node->prefixLength, s_maxPrefixLength));
+                    }
+                    insertSorted(branch, keyByte(key, depth + matching), tagLeaf(leaf));
+                    *ref = branch;
+                    inserted = true;
+                    return leaf;
+                }
+                depth += node->prefixLength;
+            }
+
+            Node** child = findChild(node, keyByte(key, depth));
+            if (child == nullptr)
+            {
+                Leaf* leaf = newLeaf(make);
+                try
+                {
+                    addChild(ref, node, keyByte(key, depth), tagLeaf(leaf));
+                }
+                catch (...)
+                {
+                    deleteLeaf(leaf);
+                    throw;
+                }
+                inserted = true;
+                return leaf;
+            }
+            ref = child;
+            depth++;
+        }
+    }
+
+    // unlink and return the leaf of the key, nullptr if it is missing
+    Leaf* removeLeaf(Node** ref, Node* node, const KeyRef& key, Size depth)
+    {
+        if (node == nullptr)
+            return nullptr;
+        if (isLeaf(node))
+        {
+            if (matches(asLeaf(node), key) == false)
+                return nullptr;
+            *ref = nullptr;
+            return asLeaf(node);
+        }
+        if (node->prefixLength > 0)
+        {
+            if (checkPrefix(node, key, depth) != min(node->prefixLength, s_maxPrefixLength))
+                return nullptr;
+            depth += node->prefixLength;
+        }
+        if (depth > key.length)
+            return nullptr;
+        byte c = keyByte(key, depth);
+        Node** child = findChild(node, c);
+        if (child == nullptr)
+            return nullptr;
+        if (isLeaf(*child))
+        {
+            Leaf* leaf = asLeaf(*child);
+            if (matches(leaf, key) == false)
+                return nullptr;
+            removeChild(ref, node, c, child);
+            return leaf;
+        }
+        return removeLeaf(child, *child, key, depth + 1);
+    }
+
+public:
+    RadixTree& operator = (const RadixTree& rhs)
+    {
+        if (&rhs != this)
+        {
+            RadixTree copy(rhs);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    RadixTree& operator = (RadixTree&& rhs) noexcept
+    {
+        if (&rhs != this)
+        {
+            clear();
+            m_root = rhs.m_root;
+            m_size = rhs.m_size;
+            m_memory = rhs.m_memory;
+            rhs.m_root = nullptr;
+            rhs.m_size = 0;
+            rhs.m_memory = 0;
+        }
+        return *this;
+    }
+
+    Value& operator [] (const KeyRef& key)
+    {
+        Value* val = find(key);
+        if (val == nullptr)
+            throw KeyNoFoundError();
+        return *val;
+    }
+
+    const Value& operator [] (const KeyRef& key) const
+    {
+        const Value* val = find(key);
+        if (val == nullptr)
+            throw KeyNoFoundError();
+        return *val;
+    }
+
+public:
+    class Iterator
+    {
+    private:
+        friend class RadixTree;
+
+    public:
+        Iterator()                   = default;
+        Iterator(const Iterator& cp) = default;
+        Iterator(Iterator&& mv)      = default;
+
+    private:
+        explicit Iterator(const Node* root) : m_cursor(root) {}
+
+        Cursor m_cursor;
+
+    public:
+        Iterator& operator = (const Iterator& cp) = default;
+        Iterator& operator = (Iterator&& mv)      = default;
+
+        inline KeyValPair& operator  * () const { return *m_cursor.leaf(); };
+        inline KeyValPair* operator -> () const { return  m_cursor.leaf(); };
+
+        inline bool operator == (const Iterator& rhs) const { return m_cursor.leaf() == rhs.m_cursor.leaf(); }
+        inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        inline Iterator& operator ++ ()    { m_cursor.advance(); return *this; }
+        inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+    };
+
+    class const_Iterator
+    {
+    private:
+        friend class RadixTree;
+
+    public:
+        const_Iterator()                         = default;
+        const_Iterator(const const_Iterator& cp) = default;
+        const_Iterator(const_Iterator&& mv)      = default;
+
+        const_Iterator(const Iterator& it) : m_cursor(it.m_cursor) {} // NOLINT(*-explicit-constructor)
+
+    private:
+        explicit const_Iterator(const Node* root) : m_cursor(root) {}
+
+        Cursor m_cursor;
+
+    public:
+        const_Iterator& operator = (const const_Iterator& cp) = default;
+        const_Iterator& operator = (const_Iterator&& mv)      = default;
+
+        inline const KeyValPair& operator  * () const { return *m_cursor.leaf(); };
+        inline const KeyValPair* operator -> () const { return  m_cursor.leaf(); };
+
+        inline bool operator == (const const_Iterator& rhs) const { return m_cursor.leaf() == rhs.m_cursor.leaf(); }
+        inline bool operator != (const const_Iterator& rhs) const { return !(*this == rhs); }
+
+        inline const_Iterator& operator ++ ()    { m_cursor.advance(); return *this; }
+        inline const_Iterator  operator ++ (int) { const_Iterator temp(*this); ++(*this); return temp; }
+    };
+
+    template<typename It>
+    struct Range
+    {
+        It first;
+        It last;
+
+        inline It begin() const { return first; }
+        inline It end()   const { return last; }
+        inline bool isEmpty() const { return first == last; }
+    };
+};
+
+}
+
+#endif // RADIXTREE_HPP
@@ -0,0 +1,76 @@
+/*
+ * ---------------------------------------------------
+ * Rope.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:31:04
+ * ---------------------------------------------------
+ */
+
+#ifndef ROPE_HPP
+# define ROPE_HPP
+
+#include "UtilsCPP/Func.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+
+namespace utils
+{
+
+// Large text stored as a balanced tree of chunks of at most 1KB (an implicit treap, ordered by
+// position): inserting or removing in the middle is O(log n) instead of moving the whole end of
+// the text, and character access is a descent of the tree. Use it for texts edited in place,
+// a String or a StringBuilder is better for texts built once.
+class UTILSCPP_API Rope
+{
+public:
+    using Size  = uint64;
+    using Index = Size;
+
+public:
+    Rope() = default;
+    Rope(const Rope&);
+    Rope(Rope&&) noexcept;
+
+    explicit Rope(StringView text);
+
+    inline Size length() const { return m_root == nullptr ? 0 : total(m_root); }
+    inline bool isEmpty() const { return m_root == nullptr; }
+
+    // pos and the ranges are clamped to the text
+    void insert(Index pos, StringView text);
+    void remove(Index pos, Size length);
+    inline void append(StringView text) { insert(length(), text); }
+
+    String substr(Index pos, Size length) const;
+    String toString() const;
+
+    // call function with the consecutive chunks of the range
+    void forEachChunk(Index pos, Size length, const Func<void(StringView)>& function) const;
+    inline void forEachChunk(const Func<void(StringView)>& function) const { forEachChunk(0, length(), function); }
+
+    void clear();
+
+    ~Rope();
+
+private:
+    struct Node;
+
+    Node* m_root = nullptr;
+    uint32 m_random = 0x9E3779B9; // treap priorities
+
+    static Size total(const Node* node);
+
+public:
+    Rope& operator = (const Rope&);
+    Rope& operator = (Rope&&) noexcept;
+
+    // no bound check
+    char operator [] (Index idx) const;
+};
+
+}
+
+#endif // ROPE_HPP
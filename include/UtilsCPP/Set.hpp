@@ -10,8 +10,11 @@
 #ifndef SET_HPP
 # define SET_HPP
 
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Compare.hpp"
 #include "UtilsCPP/Error.hpp"
 #include "UtilsCPP/Func.hpp"
+#include "UtilsCPP/Macros.hpp"
 #include "UtilsCPP/Types.hpp"
 #include "UtilsCPP/UniquePtr.hpp"
 
@@ -20,11 +23,12 @@
 namespace utils
 {
 
-template<typename T>
+template<typename T, typename Compare = utils::Compare<T>>
 class Set
 {
 public:
     ERROR_DEFF(DuplicateElementError, "Element already in the set");
+    ERROR_DEFF(UnsortedInputError, "Input range is not sorted");
 
 public:
     using Element = T;
@@ -32,11 +36,21 @@ public:
 
     class Iterator;
     class const_Iterator;
+    class NodeHandle;
+    template<typename It> class Reverse;
+    template<typename It> struct Range;
+
+    using ReverseIterator       = Reverse<Iterator>;
+    using const_ReverseIterator = Reverse<const_Iterator>;
 
 public:
     Set() = default;
 
-    Set(const Set& cp)
+    explicit Set(const Compare& compare) : m_compare(compare)
+    {
+    }
+
+    Set(const Set& cp) : m_compare(cp.m_compare)
     {
         Func<UniquePtr<Node>(const UniquePtr<Node>&)> cloneSubTree = [&](const UniquePtr<Node>& src)
         {
@@ -62,6 +76,42 @@ public:
             insert(std::move(elem));
     }
 
+    template<typename InputIt>
+    Set(const InputIt& begin, const InputIt& end, const Compare& compare = Compare()) : m_compare(compare)
+    {
+        Array<Element> elements(begin, end);
+        elements.sort([&](const Element& a, const Element& b) { return m_compare(a, b) < 0; });
+        for (typename Array<Element>::Index i = 1; i < elements.length(); i++)
+        {
+            if (m_compare(elements[i - 1], elements[i]) == 0)
+                throw DuplicateElementError();
+        }
+        m_root = fromSortedArray(std::move(elements)).m_root;
+    }
+
+    template<typename InputIt>
+    static Set fromSorted(const InputIt& begin, const InputIt& end, const Compare& compare = Compare())
+    {
+        Size count = 0;
+        if (begin != end)
+        {
+            InputIt prev = begin;
+            InputIt curr = begin;
+            for (++curr, count = 1; curr != end; ++prev, ++curr, ++count)
+            {
+                int cmp = compare(*prev, *curr);
+                if (cmp > 0)
+                    throw UnsortedInputError();
+                if (cmp == 0)
+                    throw DuplicateElementError();
+            }
+        }
+        Set newSet(compare);
+        InputIt curr = begin;
+        newSet.m_root = buildSubTree([&]() { return Element(*curr++); }, count);
+        return newSet;
+    }
+
     inline bool isEmpty() const { return m_root == false; }
     
     Size size() const
@@ -75,25 +125,26 @@ public:
         return subTreeSize(m_root);
     }
 
-    Iterator begin()
-    {
-        Node* curr = m_root;
-        while (curr != nullptr && curr->left != nullptr)
-            curr = curr->left;
-        return Iterator(curr);
-    }
+    inline       Iterator begin()       { return       Iterator(Node::first(m_root), this); }
+    inline const_Iterator begin() const { return const_Iterator(Node::first(m_root), this); }
 
-    const_Iterator begin() const { return const_Iterator(const_cast<Set*>(this)->begin()); }
+    // end() refers to the set object and not to its nodes (--end() reads the root of the set), moving the set
+    // invalidates it. Iterators to elements stay valid and belong to the set the nodes were moved to
+    inline       Iterator end()         { return       Iterator(nullptr, this); }
+    inline const_Iterator end()   const { return const_Iterator(nullptr, this); }
 
-    inline Iterator end() { return Iterator(nullptr); }
-    inline const_Iterator end() const { return const_Iterator(const_cast<Set*>(this)->end()); }
+    inline       ReverseIterator rbegin()       { return       ReverseIterator(--end()); }
+    inline const_ReverseIterator rbegin() const { return const_ReverseIterator(--end()); }
+    inline       ReverseIterator rend()         { return       ReverseIterator(end()); }
+    inline const_ReverseIterator rend()   const { return const_ReverseIterator(end()); }
 
     Iterator insert(Element&& value)
     {
         Func<Node*(Node*)> insertInSubTree = [&](Node* root) -> Node* {
-            if (root->value == value)
+            int cmp = m_compare(root->value, value);
+            if (cmp == 0)
                 throw DuplicateElementError();
-            if (value < root->value)
+            if (cmp > 0)
             {
                 if (root->left == nullptr)
                     return root->left = makeUnique<Node>(std::move(value), root);
@@ -107,28 +158,72 @@ public:
             }
         };
         if (m_root == nullptr)
-            return Iterator(m_root = makeUnique<Node>(std::move(value), nullptr));
-        return Iterator(insertInSubTree(m_root));
+            return Iterator(m_root = makeUnique<Node>(std::move(value), nullptr), this);
+        return Iterator(insertInSubTree(m_root), this);
     }
 
     // TODO iterator insert
 
     inline Iterator insert(const Element& value) { return insert((Element&&)Element(value)); }
+
+    // Single descent lookup, the element comparing equal to key or, if there is none, the element
+    // returned by make() inserted where key belongs. make() must return an element comparing equal to key.
+    template<typename K, typename Make>
+    Iterator findOrInsert(const K& key, const Make& make, bool* inserted = nullptr)
+    {
+        Node* parent = nullptr;
+        UniquePtr<Node>& link = findLink(key, parent);
+        if (inserted != nullptr)
+            *inserted = link == nullptr;
+        if (link == nullptr)
+            link = makeUnique<Node>(make(), parent);
+        return Iterator(link, this);
+    }
+
+    // relink an extracted node without allocating, the handle is left untouched if the element is already in the set
+    Iterator insert(NodeHandle&& handle)
+    {
+        if (handle.isEmpty())
+            return end();
+        Node* parent = nullptr;
+        UniquePtr<Node>& link = findLink(handle.m_node->value, parent);
+        if (link != nullptr)
+            throw DuplicateElementError();
+        handle.m_node->parent = parent;
+        link = std::move(handle.m_node);
+        return Iterator(link, this);
+    }
+
+    // move the nodes of other whose element is not in this set, the others stay in other
+    void merge(Set& other)
+    {
+        Iterator it = other.begin();
+        while (it != other.end())
+        {
+            Node* node = it.m_node;
+            ++it;
+            Node* parent = nullptr;
+            UniquePtr<Node>& link = findLink(node->value, parent);
+            if (link != nullptr)
+                continue;
+            UniquePtr<Node> detached = other.unlink(node);
+            detached->parent = parent;
+            link = std::move(detached);
+        }
+    }
     
     template<typename Y>
     Iterator find(const Y& value)
     {
-        Func<Node*(Node*)> findInSubTree = [&](Node* root) -> Node* {
-            if (root == nullptr)
-                return nullptr;
-            if (root->value == value)
-                return root;
-            if (root->value < value)
-                return findInSubTree(root->right);
-            else
-                return findInSubTree(root->left);
-        };
-        return Iterator(findInSubTree(m_root));
+        Node* node = m_root;
+        while (node != nullptr)
+        {
+            int cmp = m_compare(node->value, value);
+            if (cmp == 0)
+                break;
+            node = cmp > 0 ? node->left : node->right;
+        }
+        return Iterator(node, this);
     }
 
     template<typename Y>
@@ -137,30 +232,290 @@ public:
     template<typename Y>
     inline bool contain(const Y& value) const { return find(value) != end(); }
 
-    inline bool contain(const Set& other) const
+    // out[i] = find(keys[i]), the searches are interleaved so their cache misses overlap
+    template<typename Y>
+    void findMany(const Y* keys, Size count, Iterator* out)
+    {
+        searchMany(keys, count, [&](Size i, Node* node) { out[i] = Iterator(node, this); });
+    }
+
+    template<typename Y>
+    void findMany(const Y* keys, Size count, const_Iterator* out) const
+    {
+        searchMany(keys, count, [&](Size i, Node* node) { out[i] = const_Iterator(node, this); });
+    }
+
+    template<typename Y>
+    void containMany(const Y* keys, Size count, bool* out) const
+    {
+        searchMany(keys, count, [&](Size i, Node* node) { out[i] = node != nullptr; });
+    }
+
+    template<typename Y>
+    Iterator lowerBound(const Y& value)
+    {
+        Node* curr = m_root;
+        Node* bound = nullptr;
+        while (curr != nullptr)
+        {
+            int cmp = m_compare(curr->value, value);
+            if (cmp == 0)
+                return Iterator(curr, this);
+            if (cmp < 0)
+                curr = curr->right;
+            else
+            {
+                bound = curr;
+                curr = curr->left;
+            }
+        }
+        return Iterator(bound, this);
+    }
+
+    template<typename Y>
+    inline const_Iterator lowerBound(const Y& value) const { return const_Iterator(const_cast<Set*>(this)->lowerBound(value)); }
+
+    template<typename Y>
+    Iterator upperBound(const Y& value)
     {
+        Node* curr = m_root;
+        Node* bound = nullptr;
+        while (curr != nullptr)
+        {
+            if (m_compare(curr->value, value) <= 0)
+                curr = curr->right;
+            else
+            {
+                bound = curr;
+                curr = curr->left;
+            }
+        }
+        return Iterator(bound, this);
+    }
+
+    template<typename Y>
+    inline const_Iterator upperBound(const Y& value) const { return const_Iterator(const_cast<Set*>(this)->upperBound(value)); }
+
+    template<typename Y>
+    Range<Iterator> equalRange(const Y& value)
+    {
+        Iterator it = lowerBound(value);
+        if (it == end() || m_compare(*it, value) != 0)
+            return Range<Iterator>{ it, it };
+        return Range<Iterator>{ it, ++Iterator(it) };
+    }
+
+    template<typename Y>
+    Range<const_Iterator> equalRange(const Y& value) const
+    {
+        Range<Iterator> range = const_cast<Set*>(this)->equalRange(value);
+        return Range<const_Iterator>{ range.first, range.last };
+    }
+
+    // elements in [lo, hi)
+    template<typename Lo, typename Hi>
+    Range<Iterator> iterateRange(const Lo& lo, const Hi& hi)
+    {
+        Iterator first = lowerBound(lo);
+        if (first == end() || m_compare(*first, hi) >= 0)
+            return Range<Iterator>{ first, first };
+        return Range<Iterator>{ first, lowerBound(hi) };
+    }
+
+    template<typename Lo, typename Hi>
+    Range<const_Iterator> iterateRange(const Lo& lo, const Hi& hi) const
+    {
+        Range<Iterator> range = const_cast<Set*>(this)->iterateRange(lo, hi);
+        return Range<const_Iterator>{ range.first, range.last };
+    }
+
+    bool contain(const Set& other) const
+    {
+        const_Iterator curr = begin();
         for (const auto& element : other)
         {
-            if (contain(element) == false)
+            int cmp = -1;
+            while (curr != end() && (cmp = m_compare(*curr, element)) < 0)
+                ++curr;
+            if (cmp != 0)
                 return false;
+            ++curr;
         }
         return true;
     }
 
+    inline Set unionWith(const Set& other) const           { return combine(other, true,  true,  true);  }
+    inline Set intersect(const Set& other) const           { return combine(other, false, false, true);  }
+    inline Set difference(const Set& other) const          { return combine(other, true,  false, false); }
+    inline Set symmetricDifference(const Set& other) const { return combine(other, true,  true,  false); }
+
     inline void clear() { m_root.clear(); }
 
-    void remove(const Iterator& it)
+    inline const Compare& compare() const { return m_compare; }
+
+    inline void remove(const Iterator& it)
+    {
+        if (it != end())
+            unlink(it.m_node);
+    }
+
+    Element pop(const Iterator& it)
+    {
+        Element output = std::move(it.m_node->value);
+        remove(it);
+        return output;
+    }
+
+    // take the node out of the set without freeing it, see insert(NodeHandle&&)
+    inline NodeHandle extract(const Iterator& it) { return it == end() ? NodeHandle() : NodeHandle(unlink(it.m_node)); }
+
+    ~Set() = default;
+
+private:
+    struct Node
+    {        
+        Element value;
+        Node* parent = nullptr;
+        UniquePtr<Node> left;
+        UniquePtr<Node> right;
+     
+        Node() = default;
+        Node(const Element& v, Node* parent = nullptr) : value(v), parent(parent) {}
+        Node(Element&& v, Node* parent = nullptr) : value(std::move(v)), parent(parent) {}
+
+        void setLeft(UniquePtr<Node>&& node)
+        {
+            if (node != nullptr)
+                node->parent = this;
+            left = std::move(node);
+        }
+
+        void setRight(UniquePtr<Node>&& node)
+        {
+            if (node != nullptr)
+                node->parent = this;
+            right = std::move(node);
+        }
+
+        static Node* first(Node* root)
+        {
+            while (root != nullptr && root->left != nullptr)
+                root = root->left;
+            return root;
+        }
+
+        static Node* last(Node* root)
+        {
+            while (root != nullptr && root->right != nullptr)
+                root = root->right;
+            return root;
+        }
+
+        static Node* next(const Node* node)
+        {
+            if (node->right != nullptr)
+                return first(node->right);
+            while (node->parent != nullptr && node->parent->right == node)
+                node = node->parent;
+            return node->parent;
+        }
+
+        static Node* prev(const Node* node)
+        {
+            if (node->left != nullptr)
+                return last(node->left);
+            while (node->parent != nullptr && node->parent->left == node)
+                node = node->parent;
+            return node->parent;
+        }
+    };
+
+    UniquePtr<Node> m_root;
+    Compare m_compare;
+
+    static constexpr Size s_searchBatch = 8;
+
+    // searches of all the keys, s_searchBatch at a time: every round advances each search by one level
+    // and prefetches the next node, a finished search is immediately replaced by the next key.
+    // result(i, node) is called with the node of keys[i] or nullptr
+    template<typename K, typename Result>
+    void searchMany(const K* keys, Size count, const Result& result) const
     {
-        if (it == end())
-            return;
-        UniquePtr<Node>& node = it.m_node->parent == nullptr ? m_root : (it.m_node->parent->right == it.m_node ? it.m_node->parent->right : it.m_node->parent->left);
+        Node* nodes[s_searchBatch] = {};
+        Size indices[s_searchBatch] = {}; // count for an unused slot
+        Size next = 0;
+        Size inFlight = 0;
+        for (Size s = 0; s < s_searchBatch; s++)
+        {
+            nodes[s] = m_root;
+            indices[s] = next < count ? next++ : count;
+            inFlight += indices[s] != count ? 1 : 0;
+        }
+        UTILSCPP_PREFETCH((Node*)m_root);
+        while (inFlight > 0)
+        {
+            for (Size s = 0; s < s_searchBatch; s++)
+            {
+                if (indices[s] == count)
+                    continue;
+                Node* node = nodes[s];
+                int cmp = node == nullptr ? 0 : m_compare(node->value, keys[indices[s]]);
+                if (cmp == 0)
+                {
+                    result(indices[s], node);
+                    if (next < count)
+                    {
+                        indices[s] = next++;
+                        nodes[s] = m_root;
+                    }
+                    else
+                    {
+                        indices[s] = count;
+                        inFlight--;
+                    }
+                    continue;
+                }
+                nodes[s] = cmp > 0 ? node->left : node->right;
+                if (nodes[s] != nullptr)
+                    UTILSCPP_PREFETCH(nodes[s]);
+            }
+        }
+    }
+
+    // the link holding the node comparing equal to key, or the null link where it would be inserted
+    template<typename K>
+    UniquePtr<Node>& findLink(const K& key, Node*& parent)
+    {
+        UniquePtr<Node>* link = &m_root;
+        while (*link != nullptr)
+        {
+            int cmp = m_compare((*link)->value, key);
+            if (cmp == 0)
+                break;
+            parent = *link;
+            link = cmp > 0 ? &parent->left : &parent->right;
+        }
+        return *link;
+    }
+
+    // detach the node from the tree and give back its ownership
+    UniquePtr<Node> unlink(Node* target)
+    {
+        UniquePtr<Node>& node = target->parent == nullptr ? m_root : (target->parent->right == target ? target->parent->right : target->parent->left);
         if (node->left == nullptr && node->right == nullptr)
-            node.clear();
+        {
+            UniquePtr<Node> detached = std::move(node);
+            detached->parent = nullptr;
+            return detached;
+        }
         else if ((node->left == nullptr && node->right != nullptr) || (node->right == nullptr && node->left != nullptr))
         {
             UniquePtr<Node> tmp = std::move(node->left == nullptr ? node->right : node->left);
             tmp->parent = node->parent;
+            UniquePtr<Node> detached = std::move(node);
+            detached->parent = nullptr;
             node = std::move(tmp);
+            return detached;
         }
         else
         {
@@ -205,47 +560,67 @@ public:
                 (*next) = std::move(node);
                 node = std::move(b);
             }
-            remove(it);
+            return unlink(target);
         }
     }
 
-    Element pop(const Iterator& it)
+
+    template<typename Next>
+    static UniquePtr<Node> buildSubTree(const Next& next, Size count)
     {
-        Element output = std::move(it.m_node->value);
-        remove(it);
-        return output;
+        if (count == 0)
+            return UniquePtr<Node>();
+        UniquePtr<Node> left = buildSubTree(next, count / 2);
+        UniquePtr<Node> node = makeUnique<Node>(next());
+        node->setLeft(std::move(left));
+        node->setRight(buildSubTree(next, count - count / 2 - 1));
+        return node;
     }
 
-    ~Set() = default;
-
-private:
-    struct Node
-    {        
-        Element value;
-        Node* parent = nullptr;
-        UniquePtr<Node> left;
-        UniquePtr<Node> right;
-     
-        Node() = default;
-        Node(const Element& v, Node* parent = nullptr) : value(v), parent(parent) {}
-        Node(Element&& v, Node* parent = nullptr) : value(std::move(v)), parent(parent) {}
-
-        void setLeft(UniquePtr<Node>&& node)
-        {
-            if (node != nullptr)
-                node->parent = this;
-            left = std::move(node);
-        }
+    Set fromSortedArray(Array<Element>&& elements) const
+    {
+        Set newSet(m_compare);
+        typename Array<Element>::Iterator curr = elements.begin();
+        newSet.m_root = buildSubTree([&]() { return std::move(*curr++); }, elements.length());
+        return newSet;
+    }
 
-        void setRight(UniquePtr<Node>&& node)
+    Set combine(const Set& other, bool keepThisOnly, bool keepOtherOnly, bool keepCommon, bool throwOnCommon = false) const
+    {
+        Array<Element> output;
+        const_Iterator a = begin();
+        const_Iterator b = other.begin();
+        while (a != end() && b != other.end())
         {
-            if (node != nullptr)
-                node->parent = this;
-            right = std::move(node);
+            int cmp = m_compare(*a, *b);
+            if (cmp < 0)
+            {
+                if (keepThisOnly)
+                    output.append(*a);
+                ++a;
+            }
+            else if (cmp > 0)
+            {
+                if (keepOtherOnly)
+                    output.append(*b);
+                ++b;
+            }
+            else
+            {
+                if (throwOnCommon)
+                    throw DuplicateElementError();
+                if (keepCommon)
+                    output.append(*a);
+                ++a;
+                ++b;
+            }
         }
-    };
-
-    UniquePtr<Node> m_root;
+        for (; keepThisOnly && a != end(); ++a)
+            output.append(*a);
+        for (; keepOtherOnly && b != other.end(); ++b)
+            output.append(*b);
+        return fromSortedArray(std::move(output));
+    }
 
 public:
     Set& operator = (const Set& cp)
@@ -263,7 +638,7 @@ public:
         const_Iterator rhsCurr =   rhs.begin();
         for (; thsCurr != this->end() && rhsCurr != rhs.end(); ++thsCurr, ++rhsCurr)
         {
-            if (*thsCurr != *rhsCurr)
+            if (m_compare(*thsCurr, *rhsCurr) != 0)
                 return false;
         }
         return thsCurr == this->end() && rhsCurr == rhs.end();
@@ -277,8 +652,9 @@ public:
         const_Iterator itB = rhs.begin();
         for (; itA != end() && itB != rhs.end(); ++itA, ++itB)
         {
-            if (*itA != *itB)
-                return *itA < *itB;
+            int cmp = m_compare(*itA, *itB);
+            if (cmp != 0)
+                return cmp < 0;
         }
         if (itA != end())
             return false;
@@ -303,25 +679,43 @@ public:
         return newSet;
     }
 
-    Set& operator += (const Set& rhs)
-    {
-        for (const auto& element : rhs)
-            insert(element);
-        return *this;
-    }
+    inline Set& operator += (const Set& rhs) { return *this = *this + rhs; }
 
-    Set operator + (const Set& rhs) const
+    inline Set operator + (const Set& rhs) const { return combine(rhs, true, true, true, true); }
+
+public:
+    // Owns a node extracted from a Set, the element can be modified before inserting it back.
+    class NodeHandle
     {
-        Set newSet = *this;
-        newSet += rhs;
-        return newSet;
-    }
+    private:
+        friend class Set;
+
+    public:
+        NodeHandle()                  = default;
+        NodeHandle(const NodeHandle&) = delete;
+        NodeHandle(NodeHandle&&)      = default;
+
+    private:
+        explicit NodeHandle(UniquePtr<Node>&& node) : m_node(std::move(node)) {}
+
+        UniquePtr<Node> m_node;
+
+    public:
+        inline bool isEmpty() const { return m_node == nullptr; }
+
+        inline       Element& value()       { return m_node->value; }
+        inline const Element& value() const { return m_node->value; }
+
+    public:
+        NodeHandle& operator = (const NodeHandle&) = delete;
+        NodeHandle& operator = (NodeHandle&&)      = default;
+    };
 
 public:
     class Iterator
     {
     private:
-        friend class Set<T>;
+        friend class Set;
 
     public:
         Iterator()                   = default;
@@ -329,9 +723,10 @@ public:
         Iterator(Iterator&& mv)      = default;
 
     private:
-        Iterator(Node* currNode) : m_node(currNode) {}
+        Iterator(Node* currNode, const Set* set) : m_node(currNode), m_set(set) {}
 
-        Node* m_node = 0x1;
+        Node* m_node = nullptr;
+        const Set* m_set = nullptr;
 
     public:
         Iterator& operator = (const Iterator& cp) = default;
@@ -343,31 +738,17 @@ public:
         inline bool operator == (const Iterator& rhs) const { return m_node == rhs.m_node; }
         inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
 
-        Iterator& operator ++ ()
-        {
-            if (m_node->right == nullptr)
-            {
-                const Node* prev = m_node;
-                do
-                    m_node = m_node->parent;
-                while (m_node != nullptr && m_node->value < prev->value);
-            }
-            else
-            {
-                m_node = m_node->right;
-                while (m_node->left != nullptr)
-                    m_node = m_node->left;
-            }
-            return *this;
-        }
-
+        inline Iterator& operator ++ ()    { m_node = Node::next(m_node); return *this; }
         inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+
+        inline Iterator& operator -- ()    { m_node = m_node == nullptr ? Node::last(m_set->m_root) : Node::prev(m_node); return *this; }
+        inline Iterator  operator -- (int) { Iterator temp(*this); --(*this); return temp; }
     };
 
     class const_Iterator
     {
     private:
-        friend class Set<T>;
+        friend class Set;
 
     public:
         const_Iterator()                         = default;
@@ -375,10 +756,11 @@ public:
         const_Iterator(const_Iterator&& mv)      = default;
 
     private:
-        const_Iterator(const Node* node) : m_node(node) {}
-        const_Iterator(const Iterator& it) : m_node(it.m_node) {}
+        const_Iterator(const Node* node, const Set* set) : m_node(node), m_set(set) {}
+        const_Iterator(const Iterator& it) : m_node(it.m_node), m_set(it.m_set) {}
 
-        const Node* m_node = 0x1;
+        const Node* m_node = nullptr;
+        const Set* m_set = nullptr;
 
     public:
         const_Iterator& operator = (const const_Iterator& cp) = default;
@@ -390,26 +772,47 @@ public:
         inline bool operator == (const const_Iterator& rhs) const { return m_node == rhs.m_node; }
         inline bool operator != (const const_Iterator& rhs) const { return !(*this == rhs); }
 
-        const_Iterator& operator ++ ()
-        {
-            if (m_node->right == nullptr)
-            {
-                const Node* prev = m_node;
-                do
-                    m_node = m_node->parent;
-                while (m_node != nullptr && m_node->value < prev->value);
-            }
-            else
-            {
-                m_node = m_node->right;
-                while (m_node->left != nullptr)
-                    m_node = m_node->left;
-            }
-            return *this;
-        }
-
+        inline const_Iterator& operator ++ ()    { m_node = Node::next(m_node); return *this; }
         inline const_Iterator  operator ++ (int) { const_Iterator temp(*this); ++(*this); return temp; }
 
+        inline const_Iterator& operator -- ()    { m_node = m_node == nullptr ? Node::last(m_set->m_root) : Node::prev(m_node); return *this; }
+        inline const_Iterator  operator -- (int) { const_Iterator temp(*this); --(*this); return temp; }
+    };
+
+    template<typename It>
+    class Reverse : public It
+    {
+    private:
+        friend class Set;
+
+    public:
+        Reverse()                  = default;
+        Reverse(const Reverse& cp) = default;
+        Reverse(Reverse&& mv)      = default;
+
+    private:
+        explicit Reverse(const It& it) : It(it) {}
+
+    public:
+        Reverse& operator = (const Reverse& cp) = default;
+        Reverse& operator = (Reverse&& mv)      = default;
+
+        inline Reverse& operator ++ ()    { It::operator--(); return *this; }
+        inline Reverse  operator ++ (int) { Reverse temp(*this); It::operator--(); return temp; }
+
+        inline Reverse& operator -- ()    { It::operator++(); return *this; }
+        inline Reverse  operator -- (int) { Reverse temp(*this); It::operator++(); return temp; }
+    };
+
+    template<typename It>
+    struct Range
+    {
+        It first;
+        It last;
+
+        inline It begin() const { return first; }
+        inline It end()   const { return last; }
+        inline bool isEmpty() const { return first == last; }
     };
 };
 
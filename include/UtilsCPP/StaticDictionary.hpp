@@ -0,0 +1,299 @@
+/*
+ * ---------------------------------------------------
+ * StaticDictionary.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 21:06:44
+ * ---------------------------------------------------
+ */
+
+#ifndef STATICDICTIONARY_HPP
+# define STATICDICTIONARY_HPP
+
+#include "UtilsCPP/Error.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#ifdef UTILSCPP_CXX14 // the table is built by constexpr loops
+
+namespace utils
+{
+
+namespace staticHash
+{
+
+constexpr uint64 s_k0 = 0x9E3779B97F4A7C15ULL;
+constexpr uint64 s_k1 = 0xBF58476D1CE4E5B9ULL;
+constexpr uint64 s_k2 = 0x94D049BB133111EBULL;
+
+// splitmix64 finalizer
+constexpr uint64 mix(uint64 x)
+{
+    x = (x ^ (x >> 30)) * s_k1;
+    x = (x ^ (x >> 27)) * s_k2;
+    return x ^ (x >> 31);
+}
+
+// little endian reads, written out so the compilers merge them into a single load at runtime
+constexpr uint64 read4(const char* str)
+{
+    return (uint64)(byte)str[0] | ((uint64)(byte)str[1] << 8) | ((uint64)(byte)str[2] << 16) | ((uint64)(byte)str[3] << 24);
+}
+
+constexpr uint64 read8(const char* str)
+{
+    return read4(str) | (read4(str + 4) << 32);
+}
+
+// the last 1 to 8 bytes packed in one word with fixed size (overlapping) reads,
+// two tails of the same length are equal only if the bytes are equal
+constexpr uint64 readTail(const char* str, uint64 length)
+{
+    if (length >= 4)
+        return (read4(str) << 32) | read4(str + length - 4);
+    if (length > 0)
+        return ((uint64)(byte)str[0] << 16) | ((uint64)(byte)str[length >> 1] << 8) | (uint64)(byte)str[length - 1];
+    return 0;
+}
+
+constexpr uint64 hash(const char* str, uint64 length, uint64 seed)
+{
+    uint64 h = seed ^ (length * s_k0);
+    for (; length > 8; str += 8, length -= 8)
+    {
+        h = (h ^ read8(str)) * s_k1;
+        h ^= h >> 29;
+    }
+    return mix(h ^ readTail(str, length));
+}
+
+constexpr uint64 length(const char* str)
+{
+    uint64 length = 0;
+    while (str[length] != '\0')
+        length++;
+    return length;
+}
+
+constexpr bool equal(const char* a, const char* b, uint64 length)
+{
+    for (; length > 8; a += 8, b += 8, length -= 8)
+    {
+        if (read8(a) != read8(b))
+            return false;
+    }
+    return readTail(a, length) == readTail(b, length);
+}
+
+}
+
+template<typename Value>
+struct StaticEntry
+{
+    const char* key;
+    Value val;
+};
+
+// Immutable String keyed dictionary for key sets known at compile time (keywords, command names...).
+// The constructor builds a minimal perfect hash (hash and displace): the keys are split in buckets,
+// and each bucket gets a displacement sending its keys to free slots of a table of exactly N entries.
+// A lookup is one hash, one displacement load and a single key compare.
+// Declared constexpr the whole table is built by the compiler and lands in read-only data:
+//
+//     constexpr auto commands = utils::makeStaticDictionary<Command>({ { "get", Command::get }, { "set", Command::set } });
+//
+// Value must be a literal type. Duplicate keys are a compile error (DuplicateKeyError outside of constexpr).
+// Requires C++14, including the header in C++11 is an error.
+template<typename Value, uint64 N>
+class StaticDictionary
+{
+public:
+    ERROR_DEFF(KeyNoFoundError, "Key not in the dictionary");
+    ERROR_DEFF(DuplicateKeyError, "Key present twice in a static dictionary");
+    ERROR_DEFF(BuildError, "No perfect hash found for the keys of a static dictionary");
+
+public:
+    using Size = uint64;
+
+    struct KeyValPair
+    {
+        const char* key;
+        Size length;
+        Value val;
+    };
+
+    using const_Iterator = const KeyValPair*;
+
+    static_assert(N > 0, "a static dictionary needs at least one key");
+
+public:
+    StaticDictionary() = delete;
+    constexpr StaticDictionary(const StaticDictionary&) = default;
+    constexpr StaticDictionary(StaticDictionary&&)      = default;
+
+    constexpr explicit StaticDictionary(const StaticEntry<Value> (&entries)[N]) : m_entries{}, m_displacements{}, m_seed(0)
+    {
+        for (; m_seed < s_maxSeeds; m_seed++)
+        {
+            if (build(entries))
+                return;
+        }
+        throw BuildError();
+    }
+
+    constexpr Size size() const { return N; }
+
+    // in slot order, not in key order
+    constexpr const_Iterator begin() const { return m_entries; }
+    constexpr const_Iterator end()   const { return m_entries + N; }
+
+    // nullptr if the key is missing
+    constexpr const Value* find(const char* key, Size length) const
+    {
+        Size hash = staticHash::hash(key, length, m_seed);
+        Size displacement = m_displacements[hash % s_bucketCount];
+        const KeyValPair& entry = m_entries[(displacement & s_direct) != 0 ? displacement & ~s_direct : staticHash::mix(hash ^ displacement) % N];
+        return entry.length == length && staticHash::equal(entry.key, key, length) ? &entry.val : nullptr;
+    }
+
+    constexpr const Value* find(const char* key) const { return find(key, staticHash::length(key)); }
+    inline const Value* find(const String& key) const { return find((const char*)key, key.length()); }
+    constexpr const Value* find(StringView key) const { return find(key.data(), key.length()); }
+
+    template<typename K>
+    constexpr bool contain(const K& key) const { return find(key) != nullptr; }
+
+    ~StaticDictionary() = default;
+
+private:
+    static constexpr Size s_bucketCount = N / 2 + 1;
+    static constexpr Size s_direct = Size(1) << 63; // displacement bit of the single key buckets, the other bits are the slot
+    static constexpr Size s_maxDisplacement = 1 << 12;
+    static constexpr Size s_maxSeeds = 64;
+
+    KeyValPair m_entries[N];
+    Size m_displacements[s_bucketCount];
+    Size m_seed;
+
+    // place the largest buckets first while the table is mostly empty, then put the single key
+    // buckets directly in the remaining slots. return false if a bucket can't be placed with this seed
+    constexpr bool build(const StaticEntry<Value> (&entries)[N])
+    {
+        Size lengths[N] = {};
+        Size hashes[N] = {};
+        Size bucketSizes[s_bucketCount] = {};
+        Size maxBucketSize = 0;
+        for (Size i = 0; i < N; i++)
+        {
+            lengths[i] = staticHash::length(entries[i].key);
+            hashes[i] = staticHash::hash(entries[i].key, lengths[i], m_seed);
+            Size bucketSize = ++bucketSizes[hashes[i] % s_bucketCount];
+            if (bucketSize > maxBucketSize)
+                maxBucketSize = bucketSize;
+        }
+
+        // keys sorted by bucket, the keys of bucket b are keys[bucketStarts[b]..bucketStarts[b + 1]]
+        Size bucketStarts[s_bucketCount + 1] = {};
+        for (Size b = 0; b < s_bucketCount; b++)
+            bucketStarts[b + 1] = bucketStarts[b] + bucketSizes[b];
+        Size keys[N] = {};
+        Size filled[s_bucketCount] = {};
+        for (Size i = 0; i < N; i++)
+        {
+            Size b = hashes[i] % s_bucketCount;
+            keys[bucketStarts[b] + filled[b]++] = i;
+        }
+
+        bool occupied[N] = {};
+        Size trials[N] = {}; // trials[slot] == trial when a key of the bucket already took the slot during this trial
+        Size trial = 0;
+        Size slots[N] = {};
+        Size displacements[s_bucketCount] = {};
+        for (Size bucketSize = maxBucketSize; bucketSize >= 2; bucketSize--)
+        {
+            for (Size b = 0; b < s_bucketCount; b++)
+            {
+                if (bucketSizes[b] != bucketSize)
+                    continue;
+                const Size first = bucketStarts[b];
+                const Size last = bucketStarts[b + 1];
+                for (Size i = first; i < last; i++)
+                {
+                    for (Size j = i + 1; j < last; j++)
+                    {
+                        if (lengths[keys[i]] == lengths[keys[j]] && staticHash::equal(entries[keys[i]].key, entries[keys[j]].key, lengths[keys[i]]))
+                            throw DuplicateKeyError();
+                    }
+                }
+                Size displacement = 1;
+                for (;; displacement++)
+                {
+                    if (displacement > s_maxDisplacement)
+                        return false;
+                    trial++;
+                    bool placed = true;
+                    for (Size i = first; i < last && placed; i++)
+                    {
+                        Size slot = staticHash::mix(hashes[keys[i]] ^ displacement) % N;
+                        placed = occupied[slot] == false && trials[slot] != trial;
+                        trials[slot] = trial;
+                        slots[keys[i]] = slot;
+                    }
+                    if (placed)
+                        break;
+                }
+                for (Size i = first; i < last; i++)
+                    occupied[slots[keys[i]]] = true;
+                displacements[b] = displacement;
+            }
+        }
+
+        Size freeSlot = 0;
+        for (Size b = 0; b < s_bucketCount; b++)
+        {
+            if (bucketSizes[b] != 1)
+                continue;
+            while (occupied[freeSlot])
+                freeSlot++;
+            occupied[freeSlot] = true;
+            slots[keys[bucketStarts[b]]] = freeSlot;
+            displacements[b] = s_direct | freeSlot;
+        }
+
+        for (Size i = 0; i < N; i++)
+            m_entries[slots[i]] = KeyValPair{entries[i].key, lengths[i], entries[i].val};
+        for (Size b = 0; b < s_bucketCount; b++)
+            m_displacements[b] = displacements[b];
+        return true;
+    }
+
+public:
+    StaticDictionary& operator = (const StaticDictionary&) = delete;
+    StaticDictionary& operator = (StaticDictionary&&)      = delete;
+
+    template<typename K>
+    constexpr const Value& operator [] (const K& key) const
+    {
+        const Value* val = find(key);
+        if (val == nullptr)
+            throw KeyNoFoundError();
+        return *val;
+    }
+};
+
+template<typename Value, uint64 N>
+constexpr StaticDictionary<Value, N> makeStaticDictionary(const StaticEntry<Value> (&entries)[N])
+{
+    return StaticDictionary<Value, N>(entries);
+}
+
+}
+
+#else
+
+#error "StaticDictionary requires C++14 (its table is built by constexpr loops)"
+
+#endif // UTILSCPP_CXX14
+
+#endif // STATICDICTIONARY_HPP
@@ -12,76 +12,305 @@
 
 #include "UtilsCPP/Types.hpp"
 #include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Hash.hpp"
 #include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include <cstddef>
+#include <cstring>
 #include <istream>
 
+#ifdef UTILSCPP_STRING_HASH_CACHE
+    #include <atomic>
+#endif
+
 #define SAFECPY(dst) safecpy(dst, sizeof(dst))
 
 namespace utils
 {
 
+// Null-terminated character string. Strings of up to 23 characters are stored in the object itself
+// and don't allocate. String::literal (or the _s suffix) makes a non-owning string on a buffer living
+// as long as the program (a string literal, a static table): copies share the buffer and nothing is
+// copied until the string is modified. Only the explicitly mutable accesses (non-const operator [],
+// mutableData, mutableBegin / mutableEnd) count as a modification, reading a non-const string through
+// its const char* conversion or begin / end never copies it.
+// When UTILSCPP_STRING_HASH_CACHE is defined (CMake option of the same name) the hash of the characters
+// is computed once and kept until the next modification, so lookups with the same key object in hash
+// containers don't hash it again. This grows String from 40 to 48 bytes, so it is off by default.
 class UTILSCPP_API String
 {
+public:
+    using OutOfBoundError = Array<char>::OutOfBoundError;
+
 public:
     using Size  = uint64;
     using Index = Size;
 
-    using Iterator       = Array<char>::Iterator;
-    using const_Iterator = Array<char>::const_Iterator;
+    using Iterator       = char*;
+    using const_Iterator = const char*;
 
 public:
-    String();
-    String(const String&)     = default;
-    String(String&&) noexcept = default;
+    inline String() : m_data(m_inline), m_length(0) { m_inline[0] = '\0'; }
+    String(const String&);
 
-    String(const char* literal);
+    inline String(String&& mv) noexcept : m_data(mv.m_data), m_length(mv.m_length)
+    {
+        setCachedHash(mv.cachedHash());
+        steal(mv);
+    }
+
+    String(const char* str);
+    String(const char* str, Size length);
     explicit String(Size length, char c = '\0');
-    
+    explicit String(StringView view) : String(view.data(), view.length()) {}
+
+    // str must outlive the string and all its copies, and str[length] must be '\0'
+    static String literal(const char* str);
+    static String literal(const char* str, Size length);
+
+    // the rest of the stream, read in one call when its size is known (a file) or by blocks of 64 KB
     static String contentOf(std::istream&);
     static String contentOfFile(const String& path);
-    static String fromUInt(uint32);
 
-    inline Size length()   const { return m_characters.length() - 1; }
-    inline Size capacity() const { return m_characters.capacity(); } // capacity include the \0 character 
-    inline bool isEmpty()  const { return (m_characters.length() - 1) == 0; }
+    // same but in output, replacing its content and reusing its buffer when it is large enough
+    static void contentOf(std::istream&, String& output);
+    static void contentOfFile(const String& path, String& output);
 
-    inline       Iterator begin()       { return   m_characters.begin(); }
-    inline const_Iterator begin() const { return   m_characters.begin(); }
-    inline       Iterator end()         { return --m_characters.end();   }
-    inline const_Iterator end()   const { return --m_characters.end();   }
+    static String fromInt(long long);
+    static String fromUInt(unsigned long long);
+    static String fromDouble(double); // shortest representation reading back to the same value
+
+    inline Size length()    const { return m_length; }
+    inline bool isEmpty()   const { return m_length == 0; }
+    inline bool isLiteral() const { return m_data != m_inline && m_capacity == 0; }
+
+    // capacity include the \0 character
+    inline Size capacity() const { return m_data == m_inline ? s_inlineCapacity + 1 : (m_capacity == 0 ? m_length + 1 : m_capacity); }
+
+    inline const_Iterator begin() const { return m_data; }
+    inline const_Iterator end()   const { return m_data + m_length; }
+
+    // writable characters, owning them (a literal is copied) and dropping the cached hash
+    inline char*    mutableData()  { detach(); return m_data; }
+    inline Iterator mutableBegin() { detach(); return m_data; }
+    inline Iterator mutableEnd()   { detach(); return m_data + m_length; }
 
     void append(char c);
+    void append(StringView str);
+
+    inline int compare(StringView rhs) const { return StringView(*this).compare(rhs); }
+
+    // Hash<String>() of the string (hashBytes without seed), with UTILSCPP_STRING_HASH_CACHE computed on
+    // the first call only. A pointer from mutableData or mutableBegin obtained before the call must not be
+    // written through after it, the write would not drop the cached hash
+    inline uint64 hash() const
+    {
+        uint64 hash = cachedHash();
+        if (hash == 0)
+        {
+            hash = hashBytes(m_data, m_length);
+            setCachedHash(hash);
+        }
+        return hash;
+    }
 
-    Index lastIndexOf(char c) const;
-    String substr(Index start, Size len) const;
+    // StringView::npos when nothing is found, see StringView
+    inline Index indexOf(char c, Index from = 0) const           { return StringView(*this).indexOf(c, from); }
+    inline Index indexOf(StringView str, Index from = 0) const   { return StringView(*this).indexOf(str, from); }
+    inline Index lastIndexOf(char c) const                       { return StringView(*this).lastIndexOf(c); }
+    inline Index lastIndexOf(StringView str) const               { return StringView(*this).lastIndexOf(str); }
+    inline Size count(char c) const                              { return StringView(*this).count(c); }
+    inline Size count(StringView str) const                      { return StringView(*this).count(str); }
+    inline Index findAnyOf(StringView set, Index from = 0) const { return StringView(*this).findAnyOf(set, from); }
+    inline bool contain(char c) const                            { return StringView(*this).contain(c); }
+    inline bool contain(StringView str) const                    { return StringView(*this).contain(str); }
+
+    // views of the fields, see StringView::split. Not available on a temporary that would leave them dangling
+    inline StringSplit<split::Character> split(char delimiter) const &         { return StringView(*this).split(delimiter); }
+    inline StringSplit<split::Substring> split(StringView delimiter) const &   { return StringView(*this).split(delimiter); }
+    inline StringSplit<split::AnyOf> splitAny(StringView delimiters) const &   { return StringView(*this).splitAny(delimiters); }
+    inline StringSplit<split::Line> lines() const &                            { return StringView(*this).lines(); }
+    inline StringSplit<split::Token> tokens() const &                          { return StringView(*this).tokens(); }
+    inline StringSplit<split::Token> tokens(StringView whitespaces) const &    { return StringView(*this).tokens(whitespaces); }
+    StringSplit<split::Character> split(char delimiter) const &&         = delete;
+    StringSplit<split::Substring> split(StringView delimiter) const &&   = delete;
+    StringSplit<split::AnyOf> splitAny(StringView delimiters) const &&   = delete;
+    StringSplit<split::Line> lines() const &&                            = delete;
+    StringSplit<split::Token> tokens() const &&                          = delete;
+    StringSplit<split::Token> tokens(StringView whitespaces) const &&    = delete;
+
+    inline void splitInto(char delimiter, Array<StringView>& fields) const       { StringView(*this).splitInto(delimiter, fields); }
+    inline void splitInto(StringView delimiter, Array<StringView>& fields) const { StringView(*this).splitInto(delimiter, fields); }
+
+    // a view of the characters, or a new String when called on a temporary that would leave the view dangling
+    inline StringView substr(Index start, Size len) const & { return StringView(*this).substr(start, len); }
+    inline String     substr(Index start, Size len) &&     { return String(StringView(*this).substr(start, len)); }
 
     void safecpy(char* dst, uint64 buffSize) const;
 
-    ~String() = default;
+    inline ~String()
+    {
+        if (isHeap())
+            operator delete (m_data);
+    }
 
 #ifdef GOOGLETEST_INCLUDE_GTEST_GTEST_H_
 public:
 #else
 private:
 #endif
-    Array<char> m_characters;
+    static constexpr Size s_inlineCapacity = 23;
+
+    char* m_data; // m_inline, a heap buffer or a literal
+    Size m_length;
+    union
+    {
+        Size m_capacity; // of the heap buffer, 0 for a literal
+        char m_inline[s_inlineCapacity + 1];
+    };
+#ifdef UTILSCPP_STRING_HASH_CACHE
+    mutable std::atomic<uint64> m_hash{0}; // 0 until hash() is called, atomic as const strings can be shared by threads
+#endif
+
+private:
+#ifdef UTILSCPP_STRING_HASH_CACHE
+    inline uint64 cachedHash() const { return m_hash.load(std::memory_order_relaxed); }
+    inline void setCachedHash(uint64 hash) const { m_hash.store(hash, std::memory_order_relaxed); }
+#else
+    inline uint64 cachedHash() const { return 0; }
+    inline void setCachedHash(uint64) const {}
+#endif
+
+    inline bool isHeap() const { return m_data != m_inline && m_capacity != 0; }
+
+    // before any modification, owns the characters and drops the hash
+    inline void detach()
+    {
+        if (isLiteral())
+            reserve(m_length + 1);
+        setCachedHash(0);
+    }
+
+    // set m_data to a buffer of length + 1 bytes holding str (left uninitialized if str is nullptr)
+    void init(const char* str, Size length);
+
+    // own a buffer of at least capacity bytes, copying a literal
+    void reserve(Size capacity);
+
+    // append the rest of the stream
+    void read(std::istream&);
+
+    // take the buffer of mv (m_data and m_length already copied), mv becomes empty
+    inline void steal(String& mv) noexcept
+    {
+        if (mv.m_data == mv.m_inline)
+        {
+            std::memcpy(m_inline, mv.m_inline, sizeof(m_inline));
+            m_data = m_inline;
+        }
+        else
+            m_capacity = mv.m_capacity;
+        mv.m_data = mv.m_inline;
+        mv.m_length = 0;
+        mv.m_inline[0] = '\0';
+        mv.setCachedHash(0);
+    }
 
 public:
-    String& operator = (const String&)     = default;
-    String& operator = (String&&) noexcept = default;
+    String& operator = (const String&);
+
+    inline String& operator = (String&& mv) noexcept
+    {
+        if (this != &mv)
+        {
+            if (isHeap())
+                operator delete (m_data);
+            m_data = mv.m_data;
+            m_length = mv.m_length;
+            setCachedHash(mv.cachedHash());
+            steal(mv);
+        }
+        return *this;
+    }
 
-    inline bool operator == (const String& rhs) const { return m_characters == rhs.m_characters; }
-    inline bool operator != (const String& rhs) const { return m_characters != rhs.m_characters; };
+    // the lengths first, then memcmp. The cached hashes are not compared, they can be stale (see hash())
+    inline bool operator == (const String& rhs) const
+    {
+        return m_length == rhs.m_length && std::memcmp(m_data, rhs.m_data, m_length) == 0;
+    }
+    inline bool operator != (const String& rhs) const { return !operator==(rhs); }
 
-    inline bool operator < (const String& rhs) const { return m_characters < rhs.m_characters; }
+    inline bool operator  < (const String& rhs) const { return compare(rhs)  < 0; }
+    inline bool operator <= (const String& rhs) const { return compare(rhs) <= 0; }
+    inline bool operator  > (const String& rhs) const { return compare(rhs)  > 0; }
+    inline bool operator >= (const String& rhs) const { return compare(rhs) >= 0; }
 
-    inline       char& operator [] (Index idx)       { return m_characters[idx]; };
-    inline const char& operator [] (Index idx) const { return m_characters[idx]; };
+    // idx can be length() to access the \0 character
+    inline char& operator [] (Index idx)
+    {
+        if (idx > m_length)
+            throw OutOfBoundError();
+        detach();
+        return m_data[idx];
+    }
 
-    inline operator       char* ()       { return (      char*)m_characters; }
-    inline operator const char* () const { return (const char*)m_characters; }
+    inline const char& operator [] (Index idx) const
+    {
+        if (idx > m_length)
+            throw OutOfBoundError();
+        return m_data[idx];
+    }
+
+    inline operator const char* () const { return m_data; }
 
     friend UTILSCPP_API String operator + (const String& s1, const String& s2);
+    friend UTILSCPP_API String operator + (String&& s1, const String& s2); // appends in the buffer of s1, a + b + c copies a once
+
+    friend class StringBuilder;
+};
+
+inline StringView::StringView(const String& str) : m_data(str), m_length(str.length())
+{
+}
+
+inline namespace literals
+{
+
+// "abc"_s is a literal String, see String::literal
+inline String operator "" _s(const char* str, std::size_t length) { return String::literal(str, length); }
+
+}
+
+template<>
+struct Compare<String>
+{
+    inline int operator () (const String& a, const String& b) const { return a.compare(b); }
+    inline int operator () (const String& a, const char* b)   const { return a.compare(b); }
+    inline int operator () (const char* a, const String& b)   const { return -b.compare(a); }
+    inline int operator () (const String& a, StringView b)    const { return a.compare(b); }
+    inline int operator () (StringView a, const String& b)    const { return -b.compare(a); }
+};
+
+template<>
+struct Equal<String>
+{
+    inline bool operator () (const String& a, const String& b) const { return a == b; }
+    inline bool operator () (const String& a, const char* b)   const { return a.compare(b) == 0; }
+    inline bool operator () (const String& a, StringView b)    const { return StringView(a) == b; }
+};
+
+template<>
+struct Hash<String>
+{
+    uint64 seed = 0;
+
+    Hash() = default;
+    explicit Hash(uint64 s) : seed(s) {}
+
+    inline uint64 operator () (const String& str) const { return seed == 0 ? str.hash() : hashBytes((const char*)str, str.length(), seed); }
+    inline uint64 operator () (const char* str)   const { return hashBytes(str, std::strlen(str), seed); }
+    inline uint64 operator () (StringView str)    const { return hashBytes(str.data(), str.length(), seed); }
 };
 
 }
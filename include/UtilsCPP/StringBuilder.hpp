@@ -0,0 +1,96 @@
+/*
+ * ---------------------------------------------------
+ * StringBuilder.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:15:36
+ * ---------------------------------------------------
+ */
+
+#ifndef STRINGBUILDER_HPP
+# define STRINGBUILDER_HPP
+
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+// Builds a String from many parts in a single growable buffer (doubling its capacity), the result
+// is moved out of the builder without copy. Give a capacity hint when the final size is known.
+//
+//     String payload = StringBuilder(256).append("{\"id\":").append(id).append('}').build();
+class UTILSCPP_API StringBuilder
+{
+public:
+    using Size = String::Size;
+
+public:
+    StringBuilder()                     = default;
+    StringBuilder(const StringBuilder&) = default;
+    StringBuilder(StringBuilder&&)      = default;
+
+    explicit StringBuilder(Size capacity) { reserve(capacity); }
+
+    inline Size length() const { return m_string.length(); }
+    inline bool isEmpty() const { return m_string.isEmpty(); }
+    inline Size capacity() const { return m_string.capacity() - 1; } // in characters, without the \0
+
+    // the characters appended so far, invalidated by the next append
+    inline StringView view() const { return m_string; }
+
+    inline void reserve(Size capacity) { m_string.reserve(capacity + 1); }
+
+    inline StringBuilder& append(char c)        { m_string.append(c); return *this; }
+    inline StringBuilder& append(StringView str) { m_string.append(str); return *this; }
+    StringBuilder& append(char c, Size count);
+
+    // decimal representation of the integers
+    inline StringBuilder& append(int value)                { return appendSigned(value); }
+    inline StringBuilder& append(long value)               { return appendSigned(value); }
+    inline StringBuilder& append(long long value)          { return appendSigned(value); }
+    inline StringBuilder& append(unsigned int value)       { return appendUnsigned(value); }
+    inline StringBuilder& append(unsigned long value)      { return appendUnsigned(value); }
+    inline StringBuilder& append(unsigned long long value) { return appendUnsigned(value); }
+
+    // shortest representation reading back to the same value, see formatDouble
+    inline StringBuilder& append(double value) { return written(formatDouble(space(maxNumberLength), value)); }
+    inline StringBuilder& append(float value)  { return written(formatFloat(space(maxNumberLength), value)); }
+
+    // lowercase digits without prefix, padded with zeros to minDigits
+    inline StringBuilder& appendHex(unsigned long long value, Size minDigits = 1)    { return written(formatHex(space(maxNumberLength), value, minDigits)); }
+    inline StringBuilder& appendBinary(unsigned long long value, Size minDigits = 1) { return written(formatBinary(space(maxNumberLength), value, minDigits)); }
+
+    // keep the buffer
+    void clear();
+
+    // move the characters into a String, the builder is left empty
+    inline String build() { return std::move(m_string); }
+
+    ~StringBuilder() = default;
+
+private:
+    String m_string;
+
+    inline StringBuilder& appendSigned(long long value)            { return written(formatInt(space(maxNumberLength), value)); }
+    inline StringBuilder& appendUnsigned(unsigned long long value) { return written(formatUInt(space(maxNumberLength), value)); }
+
+    // room for count more characters, return where they go
+    char* space(Size count);
+
+    // count characters were written in the space
+    StringBuilder& written(Size count);
+
+public:
+    StringBuilder& operator = (const StringBuilder&) = default;
+    StringBuilder& operator = (StringBuilder&&)      = default;
+};
+
+}
+
+#endif // STRINGBUILDER_HPP
@@ -0,0 +1,149 @@
+/*
+ * ---------------------------------------------------
+ * StringPool.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 05:41:09
+ * ---------------------------------------------------
+ */
+
+#ifndef STRINGPOOL_HPP
+# define STRINGPOOL_HPP
+
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+
+namespace utils
+{
+
+class StringPool;
+
+namespace stringPool
+{
+
+// header of the characters in the pool arena, followed by the null-terminated characters
+struct Entry
+{
+    uint64 hash;
+    uint64 length;
+    uint32 id;
+
+    inline const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+};
+
+}
+
+// Handle to a string stored once in a StringPool, the size of a pointer. Handles of the same pool are
+// equal when their strings are equal, so comparisons are a pointer comparison and the hash is stored
+// with the characters. Handles must only be compared with handles of the same pool and must not outlive it.
+// The empty string is the default constructed handle, the same for all the pools.
+class InternedString
+{
+private:
+    friend class StringPool;
+
+public:
+    using Size = uint64;
+
+public:
+    InternedString()                         = default;
+    InternedString(const InternedString& cp) = default;
+
+    inline StringView view()  const { return m_entry == nullptr ? StringView() : StringView(m_entry->data(), m_entry->length); }
+    inline const char* data() const { return m_entry == nullptr ? "" : m_entry->data(); } // null-terminated
+    inline Size length()      const { return m_entry == nullptr ? 0 : m_entry->length; }
+    inline bool isEmpty()     const { return m_entry == nullptr; }
+
+    // position of the string in the pool, from 1 in interning order, 0 for the empty string
+    inline uint32 id() const { return m_entry == nullptr ? 0 : m_entry->id; }
+
+    // Hash<StringView>()(view()), computed when the string was interned
+    inline uint64 hash() const { return m_entry == nullptr ? hashBytes("", 0) : m_entry->hash; }
+
+    inline operator StringView () const { return view(); } // NOLINT(google-explicit-constructor)
+
+    ~InternedString() = default;
+
+private:
+    explicit InternedString(const stringPool::Entry* entry) : m_entry(entry) {}
+
+    const stringPool::Entry* m_entry = nullptr;
+
+public:
+    InternedString& operator = (const InternedString& cp) = default;
+
+    // ordered by id, not alphabetically
+    inline bool operator == (const InternedString& rhs) const { return m_entry == rhs.m_entry; }
+    inline bool operator != (const InternedString& rhs) const { return m_entry != rhs.m_entry; }
+    inline bool operator  < (const InternedString& rhs) const { return id()  < rhs.id(); }
+    inline bool operator <= (const InternedString& rhs) const { return id() <= rhs.id(); }
+    inline bool operator  > (const InternedString& rhs) const { return id()  > rhs.id(); }
+    inline bool operator >= (const InternedString& rhs) const { return id() >= rhs.id(); }
+};
+
+// Thread safe interning table: each distinct string is stored once, in blocks of memory owned by the
+// pool and never moved or freed before the pool is destroyed. The table is split in independently
+// locked shards like ConcurrentHashMap, and looking up a string already interned never locks.
+// With threadCache, each thread also remembers the last strings it interned in a small direct
+// mapped cache checked before the shared table.
+class UTILSCPP_API StringPool
+{
+public:
+    using Size = uint64;
+
+public:
+    explicit StringPool(bool threadCache = false);
+    StringPool(const StringPool&) = delete;
+    StringPool(StringPool&&)      = delete;
+
+    // the handle of str, adding str to the pool if it is not in it yet
+    InternedString intern(StringView str);
+
+    // the handle of str if it is in the pool, the empty handle otherwise
+    InternedString find(StringView str) const;
+
+    // exact when there is no concurrent intern
+    inline Size size() const { return m_nextId.load(std::memory_order_relaxed) - 1; }
+
+    // bytes allocated for the characters and the tables
+    Size memoryUsage() const;
+
+    // must not run concurrently with any other access, invalidates all the handles
+    ~StringPool();
+
+private:
+    struct Table;
+    struct Shard;
+
+    static constexpr uint32 s_shardBits = 4;
+
+    Shard* m_shards;
+    uint64 m_poolId;
+    bool m_threadCache;
+    std::atomic<uint32> m_nextId{1};
+
+    const stringPool::Entry* lookup(StringView str, uint64 hash) const;
+
+public:
+    StringPool& operator = (const StringPool&) = delete;
+    StringPool& operator = (StringPool&&)      = delete;
+};
+
+template<>
+struct Hash<InternedString>
+{
+    uint64 seed = 0;
+
+    Hash() = default;
+    explicit Hash(uint64 s) : seed(s) {}
+
+    inline uint64 operator () (const InternedString& str) const { return seed == 0 ? str.hash() : hashCombine(seed, str.hash()); }
+};
+
+}
+
+#endif // STRINGPOOL_HPP
@@ -0,0 +1,343 @@
+/*
+ * ---------------------------------------------------
+ * StringView.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 01:34:18
+ * ---------------------------------------------------
+ */
+
+#ifndef STRINGVIEW_HPP
+# define STRINGVIEW_HPP
+
+#include "UtilsCPP/Compare.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Macros.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstring>
+
+namespace utils
+{
+
+class String;
+template<typename T> class Array;
+template<typename Delimiter> class StringSplit;
+
+namespace split
+{
+struct Character;
+struct Substring;
+struct AnyOf;
+struct Line;
+struct Token;
+}
+
+// Non-owning slice of characters (a pointer and a length), not null-terminated. Slicing, trimming
+// and searching never copy, the viewed characters must outlive the view. String and C strings
+// convert to it implicitly so a function taking a StringView accepts all of them without copy.
+class UTILSCPP_API StringView
+{
+public:
+    using Size           = uint64;
+    using Index          = Size;
+    using const_Iterator = const char*;
+
+    static constexpr Size npos = ~Size(0); // index returned by the searches that find nothing
+
+public:
+    constexpr StringView() : m_data(""), m_length(0) {}
+    constexpr StringView(const StringView&) = default;
+    constexpr StringView(StringView&&)      = default;
+
+    constexpr StringView(const char* data, Size length) : m_data(data), m_length(length) {}
+    StringView(const char* str) : m_data(str), m_length(std::strlen(str)) {} // NOLINT(google-explicit-constructor)
+    inline StringView(const String& str); // NOLINT(google-explicit-constructor), defined in String.hpp
+
+    constexpr const char* data() const { return m_data; }
+    constexpr Size length()      const { return m_length; }
+    constexpr bool isEmpty()     const { return m_length == 0; }
+
+    constexpr const_Iterator begin() const { return m_data; }
+    constexpr const_Iterator end()   const { return m_data + m_length; }
+
+    // clamped to the view, never out of bound
+    inline StringView substr(Index start, Size length = npos) const
+    {
+        if (start > m_length)
+            start = m_length;
+        return StringView(m_data + start, length < m_length - start ? length : m_length - start);
+    }
+
+    inline bool startsWith(StringView prefix) const { return prefix.m_length <= m_length && equal(m_data, prefix.m_data, prefix.m_length); }
+    inline bool endsWith(StringView suffix) const { return suffix.m_length <= m_length && equal(m_data + m_length - suffix.m_length, suffix.m_data, suffix.m_length); }
+
+    // index of the first occurrence at or after from, npos if there is none.
+    // Characters use memchr, substrings compare only the positions where both their first and last
+    // characters match (32 positions at a time with SSE2) and switch to the Two-Way algorithm when
+    // too many of these candidates fail, so the search stays linear on repetitive texts
+    inline Index indexOf(char c, Index from = 0) const
+    {
+        if (from >= m_length)
+            return npos;
+        const void* found = std::memchr(m_data + from, c, m_length - from);
+        return found == nullptr ? npos : (Index)(static_cast<const char*>(found) - m_data);
+    }
+
+    Index indexOf(StringView str, Index from = 0) const;
+
+    // index of the last occurrence, npos if there is none
+    Index lastIndexOf(char c) const;
+    Index lastIndexOf(StringView str) const;
+
+    // number of occurrences, non-overlapping for a substring ("aa" is once in "aaa"), 0 for an empty str
+    Size count(char c) const;
+    Size count(StringView str) const;
+
+    // index of the first character at or after from that is one of the characters of set, npos if there is none
+    Index findAnyOf(StringView set, Index from = 0) const;
+
+    // Lazy ranges of views of the fields separated by a delimiter, each step searches the next
+    // delimiter and nothing is allocated. split and splitAny keep the empty fields ("a,,b" has 3
+    // fields, "" has 1), lines removes the '\r' of "\r\n" and has no empty last line after a final
+    // '\n', tokens only gives the non empty fields between whitespaces.
+    inline StringSplit<split::Character> split(char delimiter) const;
+    inline StringSplit<split::Substring> split(StringView delimiter) const;
+    inline StringSplit<split::AnyOf> splitAny(StringView delimiters) const;
+    inline StringSplit<split::Line> lines() const;
+    inline StringSplit<split::Token> tokens(StringView whitespaces = StringView(" \t\n\v\f\r", 6)) const;
+
+    // the fields of split(delimiter) replacing the content of fields, keeping its capacity
+    void splitInto(char delimiter, Array<StringView>& fields) const;
+    void splitInto(StringView delimiter, Array<StringView>& fields) const;
+
+    inline bool contain(char c) const { return indexOf(c) != npos; }
+    inline bool contain(StringView str) const { return indexOf(str) != npos; }
+
+    // without the leading and / or trailing whitespaces (' ', \t, \n, \v, \f, \r)
+    inline StringView trimStart() const
+    {
+        Index start = 0;
+        while (start < m_length && isSpace(m_data[start]))
+            start++;
+        return StringView(m_data + start, m_length - start);
+    }
+
+    inline StringView trimEnd() const
+    {
+        Size length = m_length;
+        while (length > 0 && isSpace(m_data[length - 1]))
+            length--;
+        return StringView(m_data, length);
+    }
+
+    inline StringView trim() const { return trimStart().trimEnd(); }
+
+    int compare(StringView rhs) const
+    {
+        Size length = m_length < rhs.m_length ? m_length : rhs.m_length;
+        int cmp = length > 0 ? std::memcmp(m_data, rhs.m_data, length) : 0;
+        if (cmp != 0)
+            return cmp < 0 ? -1 : 1;
+        if (m_length == rhs.m_length)
+            return 0;
+        return m_length < rhs.m_length ? -1 : 1;
+    }
+
+    ~StringView() = default;
+
+private:
+    const char* m_data;
+    Size m_length;
+
+    static inline bool equal(const char* a, const char* b, Size length) { return length == 0 || std::memcmp(a, b, length) == 0; }
+    static inline bool isSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+public:
+    StringView& operator = (const StringView&) = default;
+    StringView& operator = (StringView&&)      = default;
+
+    constexpr const char& operator [] (Index idx) const { return m_data[idx]; }
+
+    friend inline bool operator == (StringView lhs, StringView rhs) { return lhs.m_length == rhs.m_length && equal(lhs.m_data, rhs.m_data, lhs.m_length); }
+    friend inline bool operator != (StringView lhs, StringView rhs) { return !(lhs == rhs); }
+    friend inline bool operator  < (StringView lhs, StringView rhs) { return lhs.compare(rhs)  < 0; }
+    friend inline bool operator <= (StringView lhs, StringView rhs) { return lhs.compare(rhs) <= 0; }
+    friend inline bool operator  > (StringView lhs, StringView rhs) { return lhs.compare(rhs)  > 0; }
+    friend inline bool operator >= (StringView lhs, StringView rhs) { return lhs.compare(rhs) >= 0; }
+};
+
+namespace split
+{
+
+// delimiters of StringSplit: find returns the position of the next delimiter in text and its length
+// in length, the flags select which fields are given
+
+struct Character
+{
+    static constexpr bool s_skipEmpty = false, s_skipLastEmpty = false, s_trimCarriageReturn = false;
+
+    char delimiter;
+
+    inline StringView::Index find(StringView text, StringView::Size& length) const { length = 1; return text.indexOf(delimiter); }
+};
+
+struct Substring
+{
+    static constexpr bool s_skipEmpty = false, s_skipLastEmpty = false, s_trimCarriageReturn = false;
+
+    StringView delimiter; // an empty delimiter gives the whole text
+
+    inline StringView::Index find(StringView text, StringView::Size& length) const
+    {
+        length = delimiter.length();
+        return delimiter.isEmpty() ? StringView::npos : text.indexOf(delimiter);
+    }
+};
+
+struct AnyOf
+{
+    static constexpr bool s_skipEmpty = false, s_skipLastEmpty = false, s_trimCarriageReturn = false;
+
+    StringView delimiters;
+
+    inline StringView::Index find(StringView text, StringView::Size& length) const { length = 1; return text.findAnyOf(delimiters); }
+};
+
+struct Line
+{
+    static constexpr bool s_skipEmpty = false, s_skipLastEmpty = true, s_trimCarriageReturn = true;
+
+    inline StringView::Index find(StringView text, StringView::Size& length) const { length = 1; return text.indexOf('\n'); }
+};
+
+struct Token
+{
+    static constexpr bool s_skipEmpty = true, s_skipLastEmpty = true, s_trimCarriageReturn = false;
+
+    StringView whitespaces;
+
+    inline StringView::Index find(StringView text, StringView::Size& length) const { length = 1; return text.findAnyOf(whitespaces); }
+};
+
+}
+
+// Range returned by StringView::split, splitAny, lines and tokens. The views point in the split text,
+// which must outlive the range and its iterators.
+template<typename Delimiter>
+class StringSplit
+{
+public:
+    class Iterator
+    {
+    private:
+        friend class StringSplit;
+
+    public:
+        Iterator()                   = default;
+        Iterator(const Iterator& cp) = default;
+
+    private:
+        Iterator(StringView text, const Delimiter& delimiter) : m_rest(text), m_delimiter(delimiter), m_isEnd(false)
+        {
+            next();
+        }
+
+        StringView m_field;
+        StringView m_rest;
+        Delimiter m_delimiter = Delimiter();
+        bool m_isEnd = true;
+        bool m_isLast = false; // m_rest had no delimiter left, m_field is the last field
+
+        void next()
+        {
+            do
+            {
+                if (m_isLast)
+                {
+                    m_isEnd = true;
+                    return;
+                }
+                StringView::Size length = 0;
+                StringView::Index pos = m_delimiter.find(m_rest, length);
+                if (pos == StringView::npos)
+                {
+                    m_field = m_rest;
+                    m_isLast = true;
+                    if (Delimiter::s_skipLastEmpty && m_field.isEmpty())
+                    {
+                        m_isEnd = true;
+                        return;
+                    }
+                }
+                else
+                {
+                    m_field = StringView(m_rest.data(), pos);
+                    m_rest = StringView(m_rest.data() + pos + length, m_rest.length() - pos - length);
+                }
+            }
+            while (Delimiter::s_skipEmpty && m_field.isEmpty());
+
+            if (Delimiter::s_trimCarriageReturn && m_field.endsWith("\r"))
+                m_field = StringView(m_field.data(), m_field.length() - 1);
+        }
+
+    public:
+        Iterator& operator = (const Iterator& cp) = default;
+
+        inline const StringView& operator  * () const { return  m_field; }
+        inline const StringView* operator -> () const { return &m_field; }
+
+        inline bool operator == (const Iterator& rhs) const
+        {
+            return m_isEnd == rhs.m_isEnd && (m_isEnd || (m_rest.data() == rhs.m_rest.data() && m_isLast == rhs.m_isLast));
+        }
+        inline bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        inline Iterator& operator ++ ()    { next(); return *this; }
+        inline Iterator  operator ++ (int) { Iterator temp(*this); ++(*this); return temp; }
+    };
+
+public:
+    StringSplit(StringView text, const Delimiter& delimiter) : m_text(text), m_delimiter(delimiter) {}
+
+    inline Iterator begin() const { return Iterator(m_text, m_delimiter); }
+    inline Iterator end()   const { return Iterator(); }
+
+private:
+    StringView m_text;
+    Delimiter m_delimiter;
+};
+
+inline StringSplit<split::Character> StringView::split(char delimiter) const { return StringSplit<split::Character>(*this, split::Character{delimiter}); }
+inline StringSplit<split::Substring> StringView::split(StringView delimiter) const { return StringSplit<split::Substring>(*this, split::Substring{delimiter}); }
+inline StringSplit<split::AnyOf> StringView::splitAny(StringView delimiters) const { return StringSplit<split::AnyOf>(*this, split::AnyOf{delimiters}); }
+inline StringSplit<split::Line> StringView::lines() const { return StringSplit<split::Line>(*this, split::Line{}); }
+inline StringSplit<split::Token> StringView::tokens(StringView whitespaces) const { return StringSplit<split::Token>(*this, split::Token{whitespaces}); }
+
+template<>
+struct Compare<StringView>
+{
+    inline int operator () (StringView a, StringView b) const { return a.compare(b); }
+};
+
+template<>
+struct Equal<StringView>
+{
+    inline bool operator () (StringView a, StringView b) const { return a == b; }
+};
+
+template<>
+struct Hash<StringView>
+{
+    uint64 seed = 0;
+
+    Hash() = default;
+    explicit Hash(uint64 s) : seed(s) {}
+
+    inline uint64 operator () (StringView str) const { return hashBytes(str.data(), str.length(), seed); }
+};
+
+}
+
+#endif // STRINGVIEW_HPP
@@ -0,0 +1,194 @@
+/*
+ * ---------------------------------------------------
+ * Epoch.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 13:24:02
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/Epoch.hpp"
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace utils
+{
+
+namespace
+{
+
+struct Retired
+{
+    void* ptr;
+    void (*deleter)(void*);
+    uint64 epoch;
+};
+
+// record state is (epoch << 1) | ACTIVE_BIT while the thread holds a guard, 0 otherwise
+constexpr uint64 ACTIVE_BIT = 1;
+constexpr uint64 COLLECT_INTERVAL = 64;
+
+struct ThreadRecord
+{
+    std::atomic<uint64> state{0};
+    std::atomic<bool> inUse{false};
+    ThreadRecord* next = nullptr;
+};
+
+std::atomic<uint64> globalEpoch(0);
+std::atomic<ThreadRecord*> records(nullptr); // records are never freed, only reused by new threads
+
+// retired by threads that exited before they could be deleted
+struct Orphans
+{
+    Array<Retired> list;
+
+    // no thread is reading anymore at static destruction
+    ~Orphans()
+    {
+        for (const Retired& entry : list)
+            entry.deleter(entry.ptr);
+    }
+};
+
+std::mutex orphansMutex;
+Orphans orphans;
+
+ThreadRecord* acquireRecord()
+{
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        bool expected = false;
+        if (record->inUse.load(std::memory_order_relaxed) == false && record->inUse.compare_exchange_strong(expected, true))
+            return record;
+    }
+    auto* record = new ThreadRecord(); // NOLINT(cppcoreguidelines-owning-memory)
+    record->inUse.store(true, std::memory_order_relaxed);
+    ThreadRecord* head = records.load(std::memory_order_relaxed);
+    do
+        record->next = head;
+    while (records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed) == false);
+    return record;
+}
+
+bool tryAdvance()
+{
+    uint64 epoch = globalEpoch.load();
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        uint64 state = record->state.load();
+        if ((state & ACTIVE_BIT) != 0 && (state >> 1) != epoch)
+            return false;
+    }
+    return globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void reclaim(Array<Retired>& retired)
+{
+    uint64 epoch = globalEpoch.load();
+    Array<Retired> pending = std::move(retired);
+    retired = Array<Retired>(); // a deleter may retire again
+    for (const Retired& entry : pending)
+    {
+        if (entry.epoch + 2 <= epoch)
+            entry.deleter(entry.ptr);
+        else
+            retired.append(entry);
+    }
+}
+
+struct ThreadState
+{
+    ThreadRecord* record = acquireRecord();
+    uint32 nesting = 0;
+    uint64 retireCount = 0;
+    Array<Retired> retired;
+
+    ~ThreadState()
+    {
+        if (retired.isEmpty() == false)
+        {
+            std::lock_guard<std::mutex> lock(orphansMutex);
+            for (const Retired& entry : retired)
+                orphans.list.append(entry);
+        }
+        record->state.store(0, std::memory_order_release);
+        record->inUse.store(false, std::memory_order_release);
+    }
+};
+
+ThreadState& threadState()
+{
+    static thread_local ThreadState state;
+    return state;
+}
+
+void reclaimOrphans()
+{
+    Array<Retired> pending;
+    {
+        std::unique_lock<std::mutex> lock(orphansMutex, std::try_to_lock);
+        if (lock.owns_lock() == false || orphans.list.isEmpty())
+            return;
+        pending = std::move(orphans.list);
+        orphans.list = Array<Retired>();
+    }
+    reclaim(pending);
+    if (pending.isEmpty() == false)
+    {
+        std::lock_guard<std::mutex> lock(orphansMutex);
+        for (const Retired& entry : pending)
+            orphans.list.append(entry);
+    }
+}
+
+}
+
+Epoch::Guard::Guard()
+{
+    ThreadState& state = threadState();
+    if (state.nesting++ == 0)
+    {
+        state.record->state.store((globalEpoch.load(std::memory_order_relaxed) << 1) | ACTIVE_BIT, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+Epoch::Guard::Guard(const Guard&) : Guard()
+{
+}
+
+Epoch::Guard::~Guard()
+{
+    ThreadState& state = threadState();
+    if (--state.nesting == 0)
+        state.record->state.store(0, std::memory_order_release);
+}
+
+void Epoch::retire(void* ptr, void (*deleter)(void*))
+{
+    ThreadState& state = threadState();
+    state.retired.append(Retired{ptr, deleter, globalEpoch.load()});
+    if (++state.retireCount % COLLECT_INTERVAL == 0)
+    {
+        tryAdvance();
+        reclaim(state.retired);
+        reclaimOrphans();
+    }
+}
+
+void Epoch::collect()
+{
+    ThreadState& state = threadState();
+    int advances = 0;
+    while (advances < 3 && tryAdvance())
+        advances++;
+    reclaim(state.retired);
+    reclaimOrphans();
+}
+
+}
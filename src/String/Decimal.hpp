@@ -0,0 +1,54 @@
+/*
+ * ---------------------------------------------------
+ * Decimal.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:08:51
+ * ---------------------------------------------------
+ */
+
+#ifndef DECIMAL_HPP
+# define DECIMAL_HPP
+
+#include "UtilsCPP/Types.hpp"
+
+#include <cstring>
+
+namespace utils
+{
+
+namespace decimal
+{
+
+constexpr uint64 s_maxDigits = 20; // of a uint64
+
+// "00" "01" ... "99"
+constexpr char s_digitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// write the digits of value ending just before end, two at a time, return the first digit
+inline char* write(char* end, unsigned long long value)
+{
+    while (value >= 100)
+    {
+        end -= 2;
+        std::memcpy(end, s_digitPairs + (value % 100) * 2, 2);
+        value /= 100;
+    }
+    if (value >= 10)
+    {
+        end -= 2;
+        std::memcpy(end, s_digitPairs + value * 2, 2);
+        return end;
+    }
+    *--end = (char)('0' + value);
+    return end;
+}
+
+}
+
+}
+
+#endif // DECIMAL_HPP
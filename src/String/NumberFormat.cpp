@@ -0,0 +1,482 @@
+/*
+ * ---------------------------------------------------
+ * NumberFormat.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 03:31:08
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/Types.hpp"
+#include "String/Decimal.hpp"
+#include "String/RyuTables.hpp"
+#include "String/UInt128.hpp"
+
+#include <cstring>
+
+namespace utils
+{
+
+namespace
+{
+
+constexpr char s_hexDigits[17] = "0123456789abcdef";
+
+// value = mantissa * 10^exponent
+struct FloatingDecimal
+{
+    uint64 mantissa;
+    int exponent;
+};
+
+constexpr int s_doubleMantissaBits = 52;
+constexpr int s_doubleBias = 1023;
+constexpr int s_doublePow5InvBitCount = 125;
+constexpr int s_doublePow5BitCount = 125;
+
+constexpr int s_floatMantissaBits = 23;
+constexpr int s_floatBias = 127;
+constexpr int s_floatPow5InvBitCount = 59;
+constexpr int s_floatPow5BitCount = 61;
+
+// bit length of 5^e, exact for e in [0, 3528]
+inline int pow5bits(int e) { return (int)(((uint32)e * 1217359) >> 19) + 1; }
+
+// floor(log10(2^e)) for e in [0, 1650], floor(log10(5^e)) for e in [0, 2620]
+inline uint32 log10Pow2(int e) { return ((uint32)e * 78913) >> 18; }
+inline uint32 log10Pow5(int e) { return ((uint32)e * 732923) >> 20; }
+
+inline bool multipleOfPowerOf5(uint64 value, uint32 p)
+{
+    uint32 count = 0;
+    while (value % 5 == 0)
+    {
+        value /= 5;
+        count++;
+    }
+    return count >= p;
+}
+
+inline bool multipleOfPowerOf2(uint64 value, uint32 p) { return (value & ((uint64(1) << p) - 1)) == 0; }
+
+// (m * mul) >> j, mul being a 128 bits table entry and j in (64, 128)
+inline uint64 mulShift64(uint64 m, const uint64* mul, int j)
+{
+    uint64 high0, high1;
+    uint128::multiply(m, mul[0], high0);
+    uint64 sum = uint128::multiply(m, mul[1], high1) + high0;
+    if (sum < high0)
+        high1++;
+    int shift = j - 64;
+    return (high1 << (64 - shift)) | (sum >> shift);
+}
+
+inline uint32 mulShift32(uint32 m, uint64 factor, int shift)
+{
+    uint64 low = (uint64)m * (uint32)factor;
+    uint64 high = (uint64)m * (uint32)(factor >> 32);
+    return (uint32)(((low >> 32) + high) >> (shift - 32));
+}
+
+// Ryu: compute the decimal bounds of the interval of values rounding to the double, then remove
+// digits while the bounds differ, tracking whether the removed digits were all zeros for the ties
+FloatingDecimal doubleToDecimal(uint64 ieeeMantissa, uint32 ieeeExponent)
+{
+    int e2;
+    uint64 m2;
+    if (ieeeExponent == 0)
+    {
+        e2 = 1 - s_doubleBias - s_doubleMantissaBits - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = (int)ieeeExponent - s_doubleBias - s_doubleMantissaBits - 2;
+        m2 = (uint64(1) << s_doubleMantissaBits) | ieeeMantissa;
+    }
+    const bool acceptBounds = (m2 & 1) == 0;
+
+    // the interval is [mm, mp] around mv, all three multiplied by 4 to stay integers
+    const uint64 mv = 4 * m2;
+    const uint32 mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+
+    uint64 vr, vp, vm;
+    int e10;
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    if (e2 >= 0)
+    {
+        const uint32 q = log10Pow2(e2) - (e2 > 3);
+        e10 = (int)q;
+        const int k = s_doublePow5InvBitCount + pow5bits((int)q) - 1;
+        const int i = -e2 + (int)q + k;
+        vr = mulShift64(4 * m2, ryu::s_doublePow5InvSplit[q], i);
+        vp = mulShift64(4 * m2 + 2, ryu::s_doublePow5InvSplit[q], i);
+        vm = mulShift64(4 * m2 - 1 - mmShift, ryu::s_doublePow5InvSplit[q], i);
+        if (q <= 21)
+        {
+            // only one of mp, mv and mm can be a multiple of 5
+            if (mv % 5 == 0)
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            else if (acceptBounds)
+                vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q);
+            else
+                vp -= multipleOfPowerOf5(mv + 2, q);
+        }
+    }
+    else
+    {
+        const uint32 q = log10Pow5(-e2) - (-e2 > 1);
+        e10 = (int)q + e2;
+        const int i = -e2 - (int)q;
+        const int k = pow5bits(i) - s_doublePow5BitCount;
+        const int j = (int)q - k;
+        vr = mulShift64(4 * m2, ryu::s_doublePow5Split[i], j);
+        vp = mulShift64(4 * m2 + 2, ryu::s_doublePow5Split[i], j);
+        vm = mulShift64(4 * m2 - 1 - mmShift, ryu::s_doublePow5Split[i], j);
+        if (q <= 1)
+        {
+            // mv = 4 * m2 has at least two trailing zero bits
+            vrIsTrailingZeros = true;
+            if (acceptBounds)
+                vmIsTrailingZeros = mmShift == 1;
+            else
+                vp--;
+        }
+        else if (q < 63)
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+    }
+
+    int removed = 0;
+    uint32 lastRemovedDigit = 0;
+    uint64 output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        // rare general case
+        while (vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint32)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint32)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+            lastRemovedDigit = 4; // exactly halfway, round to even
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    }
+    else
+    {
+        bool roundUp = false;
+        if (vp / 100 > vm / 100)
+        {
+            // most of the time two digits can be removed at once
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10)
+        {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || roundUp);
+    }
+
+    FloatingDecimal result;
+    result.mantissa = output;
+    result.exponent = e10 + removed;
+    return result;
+}
+
+// same with 32 bits arithmetic
+FloatingDecimal floatToDecimal(uint32 ieeeMantissa, uint32 ieeeExponent)
+{
+    int e2;
+    uint32 m2;
+    if (ieeeExponent == 0)
+    {
+        e2 = 1 - s_floatBias - s_floatMantissaBits - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = (int)ieeeExponent - s_floatBias - s_floatMantissaBits - 2;
+        m2 = (1U << s_floatMantissaBits) | ieeeMantissa;
+    }
+    const bool acceptBounds = (m2 & 1) == 0;
+
+    const uint32 mv = 4 * m2;
+    const uint32 mp = 4 * m2 + 2;
+    const uint32 mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+    const uint32 mm = 4 * m2 - 1 - mmShift;
+
+    uint32 vr, vp, vm;
+    int e10;
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    uint32 lastRemovedDigit = 0;
+    if (e2 >= 0)
+    {
+        const uint32 q = log10Pow2(e2);
+        e10 = (int)q;
+        const int k = s_floatPow5InvBitCount + pow5bits((int)q) - 1;
+        const int i = -e2 + (int)q + k;
+        vr = mulShift32(mv, ryu::s_floatPow5InvSplit[q], i);
+        vp = mulShift32(mp, ryu::s_floatPow5InvSplit[q], i);
+        vm = mulShift32(mm, ryu::s_floatPow5InvSplit[q], i);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            // the loop below won't run, the removed digit is computed directly
+            const int l = s_floatPow5InvBitCount + pow5bits((int)(q - 1)) - 1;
+            lastRemovedDigit = mulShift32(mv, ryu::s_floatPow5InvSplit[q - 1], -e2 + (int)q - 1 + l) % 10;
+        }
+        if (q <= 9)
+        {
+            if (mv % 5 == 0)
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            else if (acceptBounds)
+                vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+            else
+                vp -= multipleOfPowerOf5(mp, q);
+        }
+    }
+    else
+    {
+        const uint32 q = log10Pow5(-e2);
+        e10 = (int)q + e2;
+        const int i = -e2 - (int)q;
+        const int k = pow5bits(i) - s_floatPow5BitCount;
+        int j = (int)q - k;
+        vr = mulShift32(mv, ryu::s_floatPow5Split[i], j);
+        vp = mulShift32(mp, ryu::s_floatPow5Split[i], j);
+        vm = mulShift32(mm, ryu::s_floatPow5Split[i], j);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            j = (int)q - 1 - (pow5bits(i + 1) - s_floatPow5BitCount);
+            lastRemovedDigit = mulShift32(mv, ryu::s_floatPow5Split[i + 1], j) % 10;
+        }
+        if (q <= 1)
+        {
+            vrIsTrailingZeros = true;
+            if (acceptBounds)
+                vmIsTrailingZeros = mmShift == 1;
+            else
+                vp--;
+        }
+        else if (q < 31)
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+    }
+
+    int removed = 0;
+    uint32 output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        while (vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+            lastRemovedDigit = 4;
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    }
+    else
+    {
+        while (vp / 10 > vm / 10)
+        {
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || lastRemovedDigit >= 5);
+    }
+
+    FloatingDecimal result;
+    result.mantissa = output;
+    result.exponent = e10 + removed;
+    return result;
+}
+
+// fixed notation when the value is in [1e-6, 1e21), scientific otherwise
+uint64 writeDecimal(char* buffer, FloatingDecimal value)
+{
+    char digits[decimal::s_maxDigits];
+    char* first = decimal::write(digits + sizeof(digits), value.mantissa);
+    int length = (int)(digits + sizeof(digits) - first);
+    int point = value.exponent + length; // value = 0.digits * 10^point
+
+    char* out = buffer;
+    if (point >= length && point <= 21)
+    {
+        std::memcpy(out, first, (uint64)length);
+        std::memset(out + length, '0', (uint64)(point - length));
+        out += point;
+    }
+    else if (point > 0 && point <= 21)
+    {
+        std::memcpy(out, first, (uint64)point);
+        out[point] = '.';
+        std::memcpy(out + point + 1, first + point, (uint64)(length - point));
+        out += length + 1;
+    }
+    else if (point > -6 && point <= 0)
+    {
+        *out++ = '0';
+        *out++ = '.';
+        std::memset(out, '0', (uint64)-point);
+        std::memcpy(out - point, first, (uint64)length);
+        out += length - point;
+    }
+    else
+    {
+        *out++ = first[0];
+        if (length > 1)
+        {
+            *out++ = '.';
+            std::memcpy(out, first + 1, (uint64)(length - 1));
+            out += length - 1;
+        }
+        *out++ = 'e';
+        *out++ = point - 1 < 0 ? '-' : '+';
+        char exponent[3];
+        char* exponentFirst = decimal::write(exponent + sizeof(exponent), (uint64)(point - 1 < 0 ? 1 - point : point - 1));
+        std::memcpy(out, exponentFirst, (uint64)(exponent + sizeof(exponent) - exponentFirst));
+        out += exponent + sizeof(exponent) - exponentFirst;
+    }
+    return (uint64)(out - buffer);
+}
+
+// nan, inf, zero, return 0 when the value is finite and not zero
+uint64 writeSpecial(char* buffer, bool sign, bool allExponentBits, bool zeroMantissa)
+{
+    if (allExponentBits && zeroMantissa == false)
+    {
+        std::memcpy(buffer, "nan", 3);
+        return 3;
+    }
+    char* out = buffer;
+    if (sign)
+        *out++ = '-';
+    if (allExponentBits)
+    {
+        std::memcpy(out, "inf", 3);
+        return (uint64)(out + 3 - buffer);
+    }
+    *out++ = '0';
+    return (uint64)(out - buffer);
+}
+
+}
+
+uint64 formatInt(char* buffer, long long value)
+{
+    if (value >= 0)
+        return formatUInt(buffer, (unsigned long long)value);
+    *buffer = '-';
+    return formatUInt(buffer + 1, 0ULL - (unsigned long long)value) + 1;
+}
+
+uint64 formatUInt(char* buffer, unsigned long long value)
+{
+    char digits[decimal::s_maxDigits];
+    char* first = decimal::write(digits + sizeof(digits), value);
+    uint64 length = (uint64)(digits + sizeof(digits) - first);
+    std::memcpy(buffer, first, length);
+    return length;
+}
+
+uint64 formatHex(char* buffer, unsigned long long value, uint64 minDigits)
+{
+    uint64 length = 1;
+    while (length < 16 && (value >> (length * 4)) != 0)
+        length++;
+    if (length < minDigits)
+        length = minDigits < 16 ? minDigits : 16;
+    for (uint64 i = 0; i < length; i++)
+        buffer[length - 1 - i] = s_hexDigits[(value >> (i * 4)) & 0xF];
+    return length;
+}
+
+uint64 formatBinary(char* buffer, unsigned long long value, uint64 minDigits)
+{
+    uint64 length = 1;
+    while (length < 64 && (value >> length) != 0)
+        length++;
+    if (length < minDigits)
+        length = minDigits < 64 ? minDigits : 64;
+    for (uint64 i = 0; i < length; i++)
+        buffer[length - 1 - i] = (char)('0' + ((value >> i) & 1));
+    return length;
+}
+
+uint64 formatDouble(char* buffer, double value)
+{
+    uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bool sign = (bits >> 63) != 0;
+    uint64 ieeeMantissa = bits & ((uint64(1) << s_doubleMantissaBits) - 1);
+    uint32 ieeeExponent = (uint32)((bits >> s_doubleMantissaBits) & 0x7FF);
+
+    if (ieeeExponent == 0x7FF || (ieeeExponent == 0 && ieeeMantissa == 0))
+        return writeSpecial(buffer, sign, ieeeExponent == 0x7FF, ieeeMantissa == 0);
+    if (sign)
+        *buffer = '-';
+    return writeDecimal(buffer + sign, doubleToDecimal(ieeeMantissa, ieeeExponent)) + sign;
+}
+
+uint64 formatFloat(char* buffer, float value)
+{
+    uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bool sign = (bits >> 31) != 0;
+    uint32 ieeeMantissa = bits & ((1U << s_floatMantissaBits) - 1);
+    uint32 ieeeExponent = (bits >> s_floatMantissaBits) & 0xFF;
+
+    if (ieeeExponent == 0xFF || (ieeeExponent == 0 && ieeeMantissa == 0))
+        return writeSpecial(buffer, sign, ieeeExponent == 0xFF, ieeeMantissa == 0);
+    if (sign)
+        *buffer = '-';
+    return writeDecimal(buffer + sign, floatToDecimal(ieeeMantissa, ieeeExponent)) + sign;
+}
+
+}
@@ -0,0 +1,738 @@
+/*
+ * ---------------------------------------------------
+ * NumberParse.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 04:21:47
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/NumberParse.hpp"
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Types.hpp"
+#include "String/PowersOfFive.hpp"
+#include "String/UInt128.hpp"
+
+#include <cfloat>
+#include <cstring>
+#include <limits>
+
+namespace utils
+{
+
+namespace
+{
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool s_swarDigits = false;
+#else
+constexpr bool s_swarDigits = true; // the digits are read as a little endian integer
+#endif
+
+// float arithmetic is exact enough for the fast path only when not evaluated in a wider type (x87)
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+constexpr bool s_exactArithmetic = true;
+#else
+constexpr bool s_exactArithmetic = false;
+#endif
+
+constexpr uint64 s_nineteenDigits = 1000000000000000000ULL; // smallest 19 digits number
+
+inline bool isDigit(char c) { return (unsigned char)(c - '0') < 10; }
+
+inline bool isSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+inline uint64 readEight(const char* p)
+{
+    uint64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// each byte is in '0'..'9': its high nibble is 3 and adding 6 doesn't carry into it
+inline bool isEightDigits(uint64 value)
+{
+    return ((value & 0xF0F0F0F0F0F0F0F0ULL) | (((value + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// combine the digits in pairs, then the pairs in groups of four, with multiplications
+inline uint64 parseEightDigits(uint64 value)
+{
+    const uint64 mask = 0x000000FF000000FFULL;
+    const uint64 mul1 = 0x000F424000000064ULL; // 100 + (1000000 << 32)
+    const uint64 mul2 = 0x0000271000000001ULL; // 1 + (10000 << 32)
+    value -= 0x3030303030303030ULL;
+    value = (value * 10) + (value >> 8);
+    return (((value & mask) * mul1) + (((value >> 16) & mask) * mul2)) >> 32;
+}
+
+// accumulate the digits starting at p (wrapping on overflow), return the end of the digits
+inline const char* readDigits(const char* p, const char* end, uint64& value)
+{
+    if (s_swarDigits)
+    {
+        while (end - p >= 8 && isEightDigits(readEight(p)))
+        {
+            value = value * 100000000 + parseEightDigits(readEight(p));
+            p += 8;
+        }
+    }
+    while (p != end && isDigit(*p))
+    {
+        value = value * 10 + (uint64)(*p - '0');
+        p++;
+    }
+    return p;
+}
+
+// magnitude of an unsigned decimal number, outOfRange above max
+ParseResult parseMagnitude(const char* first, const char* end, uint64 max, uint64& value)
+{
+    const char* p = first;
+    while (p != end && *p == '0')
+        p++;
+    const char* significant = p;
+    uint64 magnitude = 0;
+    p = readDigits(p, end, magnitude);
+    ParseResult result = { (uint64)(p - first), ParseError::none };
+    if (p == first)
+        result.error = ParseError::invalid;
+    else if (p - significant > 20)
+        result.error = ParseError::outOfRange;
+    else if (p - significant == 20)
+    {
+        // the accumulation may have wrapped, redo it checking the last digit
+        magnitude = 0;
+        for (const char* c = significant; c != p - 1; c++)
+            magnitude = magnitude * 10 + (uint64)(*c - '0');
+        uint64 last = (uint64)(p[-1] - '0');
+        if (magnitude > (~uint64(0) - last) / 10)
+            result.error = ParseError::outOfRange;
+        else
+            magnitude = magnitude * 10 + last;
+    }
+    if (result.error == ParseError::none && magnitude > max)
+        result.error = ParseError::outOfRange;
+    if (result.error == ParseError::none)
+        value = magnitude;
+    return result;
+}
+
+struct DoubleFormat
+{
+    using Float = double;
+    using Bits  = uint64;
+
+    static constexpr int mantissaBits = 52;
+    static constexpr int exponentBits = 11;
+    static constexpr int minimumExponent = -1023;
+    static constexpr int infinitePower = 0x7FF;
+    static constexpr int smallestPowerOfTen = -342;
+    static constexpr int largestPowerOfTen = 308;
+    static constexpr int minExponentRoundToEven = -4;
+    static constexpr int maxExponentRoundToEven = 23;
+    static constexpr int maxExactPowerOfTen = 22;
+    static constexpr uint64 maxExactMantissa = uint64(1) << 53;
+
+    static inline double exactPowerOfTen(int exponent)
+    {
+        static constexpr double powers[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        return powers[exponent];
+    }
+};
+
+struct FloatFormat
+{
+    using Float = float;
+    using Bits  = uint32;
+
+    static constexpr int mantissaBits = 23;
+    static constexpr int exponentBits = 8;
+    static constexpr int minimumExponent = -127;
+    static constexpr int infinitePower = 0xFF;
+    static constexpr int smallestPowerOfTen = -65;
+    static constexpr int largestPowerOfTen = 38;
+    static constexpr int minExponentRoundToEven = -17;
+    static constexpr int maxExponentRoundToEven = 10;
+    static constexpr int maxExactPowerOfTen = 10;
+    static constexpr uint64 maxExactMantissa = uint64(1) << 24;
+
+    static inline float exactPowerOfTen(int exponent)
+    {
+        static constexpr float powers[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        return powers[exponent];
+    }
+};
+
+// the binary float as its explicit mantissa bits and its biased exponent
+struct AdjustedMantissa
+{
+    uint64 mantissa;
+    int power2;
+
+    inline bool operator == (const AdjustedMantissa& rhs) const { return mantissa == rhs.mantissa && power2 == rhs.power2; }
+};
+
+inline int leadingZeros(uint64 value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    while ((value & (uint64(1) << 63)) == 0)
+    {
+        value <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+// Eisel-Lemire: the 64 bits decimal mantissa w (normalized) times the 128 bits truncated 5^q gives
+// enough bits of w * 10^q to round correctly, the power of two comes from a log approximation
+template<typename Format>
+AdjustedMantissa computeFloat(long long q, uint64 w)
+{
+    AdjustedMantissa answer;
+    if (w == 0 || q < Format::smallestPowerOfTen)
+    {
+        answer.mantissa = 0;
+        answer.power2 = 0;
+        return answer;
+    }
+    if (q > Format::largestPowerOfTen)
+    {
+        answer.mantissa = 0;
+        answer.power2 = Format::infinitePower;
+        return answer;
+    }
+
+    int lz = leadingZeros(w);
+    w <<= lz;
+
+    const uint64* power = eiselLemire::s_powersOfFive[q - eiselLemire::s_smallestPowerOfFive];
+    uint64 high;
+    uint64 low = uint128::multiply(w, power[0], high);
+    const uint64 precisionMask = ~uint64(0) >> (Format::mantissaBits + 3);
+    if ((high & precisionMask) == precisionMask)
+    {
+        // the bits below the rounding one may carry, the low half of 5^q settles it
+        uint64 secondHigh;
+        uint128::multiply(w, power[1], secondHigh);
+        low += secondHigh;
+        if (secondHigh > low)
+            high++;
+    }
+
+    int upperBit = (int)(high >> 63);
+    int shift = upperBit + 64 - Format::mantissaBits - 3;
+    answer.mantissa = high >> shift;
+    answer.power2 = (int)((((152170 + 65536) * q) >> 16) + 63) + upperBit - lz - Format::minimumExponent;
+
+    if (answer.power2 <= 0)
+    {
+        // subnormal
+        if (-answer.power2 + 1 >= 64)
+        {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+        answer.power2 = answer.mantissa < (uint64(1) << Format::mantissaBits) ? 0 : 1;
+        return answer;
+    }
+
+    // exactly halfway between two floats: round to even instead of up
+    if (low <= 1 && q >= Format::minExponentRoundToEven && q <= Format::maxExponentRoundToEven
+        && (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == high)
+        answer.mantissa &= ~uint64(1);
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (uint64(2) << Format::mantissaBits))
+    {
+        answer.mantissa = uint64(1) << Format::mantissaBits;
+        answer.power2++;
+    }
+    answer.mantissa &= ~(uint64(1) << Format::mantissaBits);
+    if (answer.power2 >= Format::infinitePower)
+    {
+        answer.mantissa = 0;
+        answer.power2 = Format::infinitePower;
+    }
+    return answer;
+}
+
+// Exact decimal with up to 800 significant digits, value = 0.d1d2d3... * 10^point. Used when Eisel-Lemire
+// can't decide with the first 19 digits: the value is scaled by powers of two to [0.5, 1) then the
+// mantissa bits are shifted out and rounded using all the digits.
+class BigDecimal
+{
+public:
+    BigDecimal(const char* intFirst, const char* intLast, const char* fracFirst, const char* fracLast, long long exponent)
+    {
+        read(intFirst, intLast, true);
+        read(fracFirst, fracLast, false);
+        trim();
+        if (m_count > 0)
+            m_point += (int)(exponent > 100000 ? 100000 : (exponent < -100000 ? -100000 : exponent));
+    }
+
+    template<typename Format>
+    AdjustedMantissa toFloat()
+    {
+        static constexpr int powers[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+        static constexpr int powerCount = sizeof(powers) / sizeof(powers[0]);
+        const int bias = Format::minimumExponent;
+
+        AdjustedMantissa answer;
+        answer.mantissa = 0;
+        answer.power2 = 0;
+        if (m_count == 0 || m_point < -330)
+            return answer;
+        if (m_point > 310)
+        {
+            answer.power2 = Format::infinitePower;
+            return answer;
+        }
+
+        int exponent = 0;
+        while (m_point > 0)
+        {
+            int n = m_point >= powerCount ? 27 : powers[m_point];
+            shift(-n);
+            exponent += n;
+        }
+        while (m_point < 0 || (m_point == 0 && m_digits[0] < 5))
+        {
+            int n = -m_point >= powerCount ? 27 : powers[-m_point];
+            shift(n);
+            exponent -= n;
+        }
+        exponent--; // [0.5, 1) to [1, 2)
+
+        if (exponent < bias + 1)
+        {
+            shift(-(bias + 1 - exponent));
+            exponent = bias + 1;
+        }
+        if (exponent - bias >= Format::infinitePower)
+        {
+            answer.power2 = Format::infinitePower;
+            return answer;
+        }
+
+        shift(1 + Format::mantissaBits);
+        uint64 mantissa = roundedInteger();
+        if (mantissa == (uint64(2) << Format::mantissaBits))
+        {
+            mantissa >>= 1;
+            exponent++;
+            if (exponent - bias >= Format::infinitePower)
+            {
+                answer.power2 = Format::infinitePower;
+                return answer;
+            }
+        }
+        if ((mantissa & (uint64(1) << Format::mantissaBits)) == 0)
+            exponent = bias; // subnormal
+        answer.mantissa = mantissa & ((uint64(1) << Format::mantissaBits) - 1);
+        answer.power2 = exponent - bias;
+        return answer;
+    }
+
+private:
+    static constexpr int s_maxDigits = 800;
+    static constexpr uint32 s_maxShift = 60; // 9 << 60 and its carry fit in a uint64
+
+    uint8 m_digits[s_maxDigits];
+    int m_count = 0;
+    int m_point = 0;
+    bool m_truncated = false; // non zero digits were dropped
+
+    void read(const char* first, const char* last, bool integerPart)
+    {
+        for (const char* c = first; c != last; c++)
+        {
+            uint8 digit = (uint8)(*c - '0');
+            if (m_count == 0 && digit == 0)
+            {
+                if (integerPart == false)
+                    m_point--;
+                continue;
+            }
+            if (m_count < s_maxDigits)
+                m_digits[m_count++] = digit;
+            else if (digit != 0)
+                m_truncated = true;
+            if (integerPart)
+                m_point++;
+        }
+    }
+
+    void trim()
+    {
+        while (m_count > 0 && m_digits[m_count - 1] == 0)
+            m_count--;
+        if (m_count == 0)
+            m_point = 0;
+    }
+
+    void shift(int k)
+    {
+        while (k > 0)
+        {
+            uint32 n = k < (int)s_maxShift ? (uint32)k : s_maxShift;
+            leftShift(n);
+            k -= (int)n;
+        }
+        while (k < 0)
+        {
+            uint32 n = -k < (int)s_maxShift ? (uint32)-k : s_maxShift;
+            rightShift(n);
+            k += (int)n;
+        }
+    }
+
+    // multiply by 2^k, from the last digit to the first into a larger buffer
+    void leftShift(uint32 k)
+    {
+        uint8 shifted[s_maxDigits + 20];
+        int write = s_maxDigits + 20;
+        uint64 n = 0;
+        for (int read = m_count - 1; read >= 0; read--)
+        {
+            n += (uint64)m_digits[read] << k;
+            uint64 quotient = n / 10;
+            shifted[--write] = (uint8)(n - quotient * 10);
+            n = quotient;
+        }
+        while (n > 0)
+        {
+            uint64 quotient = n / 10;
+            shifted[--write] = (uint8)(n - quotient * 10);
+            n = quotient;
+        }
+        int count = s_maxDigits + 20 - write;
+        m_point += count - m_count;
+        if (count > s_maxDigits)
+        {
+            for (int i = s_maxDigits; i < count; i++)
+                m_truncated |= shifted[write + i] != 0;
+            count = s_maxDigits;
+        }
+        std::memcpy(m_digits, shifted + write, (uint64)count);
+        m_count = count;
+        trim();
+    }
+
+    // divide by 2^k, from the first digit to the last
+    void rightShift(uint32 k)
+    {
+        int read = 0;
+        int write = 0;
+        uint64 n = 0;
+        for (; (n >> k) == 0; read++)
+        {
+            if (read >= m_count)
+            {
+                if (n == 0)
+                {
+                    m_count = 0;
+                    return;
+                }
+                while ((n >> k) == 0)
+                {
+                    n *= 10;
+                    read++;
+                }
+                break;
+            }
+            n = n * 10 + m_digits[read];
+        }
+        m_point -= read - 1;
+
+        const uint64 mask = (uint64(1) << k) - 1;
+        for (; read < m_count; read++)
+        {
+            uint64 digit = n >> k;
+            n &= mask;
+            m_digits[write++] = (uint8)digit;
+            n = n * 10 + m_digits[read];
+        }
+        while (n > 0)
+        {
+            uint64 digit = n >> k;
+            n &= mask;
+            if (write < s_maxDigits)
+                m_digits[write++] = (uint8)digit;
+            else if (digit > 0)
+                m_truncated = true;
+            n *= 10;
+        }
+        m_count = write;
+        trim();
+    }
+
+    // the integer part, rounded half to even on all the digits
+    uint64 roundedInteger() const
+    {
+        if (m_point > 20)
+            return ~uint64(0);
+        uint64 n = 0;
+        int i = 0;
+        for (; i < m_point && i < m_count; i++)
+            n = n * 10 + m_digits[i];
+        for (; i < m_point; i++)
+            n *= 10;
+        if (m_point >= 0 && m_point < m_count)
+        {
+            bool halfway = m_digits[m_point] == 5 && m_point + 1 == m_count;
+            if (halfway ? (m_truncated || (m_point > 0 && m_digits[m_point - 1] % 2 == 1)) : m_digits[m_point] >= 5)
+                n++;
+        }
+        return n;
+    }
+};
+
+inline bool matchesWord(const char* p, const char* end, const char* word)
+{
+    for (; *word != '\0'; p++, word++)
+    {
+        if (p == end || (*p | 0x20) != *word)
+            return false;
+    }
+    return true;
+}
+
+template<typename Format>
+ParseResult parseFloating(StringView text, typename Format::Float& value)
+{
+    using Float = typename Format::Float;
+    using Bits = typename Format::Bits;
+
+    const char* first = text.data();
+    const char* end = first + text.length();
+    const char* p = first;
+    bool negative = p != end && *p == '-';
+    if (negative)
+        p++;
+
+    if (p != end && isDigit(*p) == false && *p != '.')
+    {
+        ParseResult result = { 0, ParseError::none };
+        if (matchesWord(p, end, "nan"))
+        {
+            result.length = (uint64)(p + 3 - first);
+            value = negative ? -std::numeric_limits<Float>::quiet_NaN() : std::numeric_limits<Float>::quiet_NaN();
+        }
+        else if (matchesWord(p, end, "inf"))
+        {
+            result.length = (uint64)(p + (matchesWord(p, end, "infinity") ? 8 : 3) - first);
+            value = negative ? -std::numeric_limits<Float>::infinity() : std::numeric_limits<Float>::infinity();
+        }
+        else
+            result.error = ParseError::invalid;
+        return result;
+    }
+
+    uint64 mantissa = 0;
+    const char* intFirst = p;
+    p = readDigits(p, end, mantissa);
+    const char* intLast = p;
+    const char* fracFirst = p;
+    const char* fracLast = p;
+    if (p != end && *p == '.')
+    {
+        fracFirst = ++p;
+        p = readDigits(p, end, mantissa);
+        fracLast = p;
+    }
+    uint64 digitCount = (uint64)((intLast - intFirst) + (fracLast - fracFirst));
+    if (digitCount == 0)
+        return ParseResult{ 0, ParseError::invalid };
+
+    // an 'e' not followed by an exponent is not part of the number
+    long long explicitExponent = 0;
+    if (p != end && (*p | 0x20) == 'e')
+    {
+        const char* e = p + 1;
+        bool negativeExponent = e != end && *e == '-';
+        if (e != end && (*e == '-' || *e == '+'))
+            e++;
+        if (e != end && isDigit(*e))
+        {
+            for (; e != end && isDigit(*e); e++)
+            {
+                if (explicitExponent < 0x10000)
+                    explicitExponent = explicitExponent * 10 + (*e - '0');
+            }
+            if (negativeExponent)
+                explicitExponent = -explicitExponent;
+            p = e;
+        }
+    }
+    ParseResult result = { (uint64)(p - first), ParseError::none };
+    long long exponent = explicitExponent - (fracLast - fracFirst);
+
+    // only the first 19 significant digits fit in the mantissa, the others are truncated
+    bool truncated = false;
+    if (digitCount > 19)
+    {
+        for (const char* c = intFirst; c != fracLast && (*c == '0' || *c == '.'); c++)
+            digitCount -= *c == '0';
+        if (digitCount > 19)
+        {
+            truncated = true;
+            mantissa = 0;
+            const char* c = intFirst;
+            for (; mantissa < s_nineteenDigits && c != intLast; c++)
+                mantissa = mantissa * 10 + (uint64)(*c - '0');
+            if (mantissa >= s_nineteenDigits)
+                exponent = (intLast - c) + explicitExponent;
+            else
+            {
+                for (c = fracFirst; mantissa < s_nineteenDigits && c != fracLast; c++)
+                    mantissa = mantissa * 10 + (uint64)(*c - '0');
+                exponent = (fracFirst - c) + explicitExponent;
+            }
+        }
+    }
+
+    // Clinger: both the mantissa and the power of ten are exact, one rounding
+    if (s_exactArithmetic && truncated == false && mantissa <= Format::maxExactMantissa
+        && exponent >= -Format::maxExactPowerOfTen && exponent <= Format::maxExactPowerOfTen)
+    {
+        Float number = (Float)mantissa;
+        if (exponent < 0)
+            number = number / Format::exactPowerOfTen((int)-exponent);
+        else
+            number = number * Format::exactPowerOfTen((int)exponent);
+        value = negative ? -number : number;
+        return result;
+    }
+
+    AdjustedMantissa answer = computeFloat<Format>(exponent, mantissa);
+    // the value is between mantissa and mantissa + 1 times 10^exponent, decided when both round the same
+    if (truncated && (answer == computeFloat<Format>(exponent, mantissa + 1)) == false)
+        answer = BigDecimal(intFirst, intLast, fracFirst, fracLast, explicitExponent).template toFloat<Format>();
+
+    if (answer.power2 == Format::infinitePower)
+    {
+        result.error = ParseError::outOfRange;
+        return result;
+    }
+    Bits bits = (Bits)(answer.mantissa | ((uint64)answer.power2 << Format::mantissaBits));
+    if (negative)
+        bits |= (Bits)1 << (Format::mantissaBits + Format::exponentBits);
+    std::memcpy(&value, &bits, sizeof(value));
+    return result;
+}
+
+template<typename T, typename Parse>
+ParseResult parseValues(StringView text, char delimiter, Array<T>& values, Parse parse)
+{
+    const char* first = text.data();
+    const char* end = first + text.length();
+
+    // one allocation for all the values
+    uint64 count = 1;
+    for (const char* c = first; (c = (const char*)std::memchr(c, delimiter, (uint64)(end - c))) != nullptr; c++)
+        count++;
+    if (values.capacity() < values.length() + count)
+        values.setCapacity(values.length() + count);
+
+    const char* p = first;
+    while (p != end && isSpace(*p))
+        p++;
+    if (p == end)
+        return ParseResult{ text.length(), ParseError::none };
+    p = first;
+    for (;;)
+    {
+        while (p != end && isSpace(*p) && *p != delimiter)
+            p++;
+        T value;
+        ParseResult result = parse(StringView(p, (uint64)(end - p)), value);
+        if (result.error != ParseError::none)
+        {
+            result.length = (uint64)(p - first);
+            return result;
+        }
+        p += result.length;
+        while (p != end && isSpace(*p) && *p != delimiter)
+            p++;
+        if (p != end && *p != delimiter)
+            return ParseResult{ (uint64)(p - first), ParseError::invalid };
+        values.append(value);
+        if (p == end)
+            return ParseResult{ text.length(), ParseError::none };
+        p++;
+    }
+}
+
+}
+
+ParseResult parseInt(StringView text, long long& value)
+{
+    const char* first = text.data();
+    const char* end = first + text.length();
+    bool negative = first != end && *first == '-';
+    uint64 max = negative ? uint64(1) << 63 : (uint64(1) << 63) - 1;
+    uint64 magnitude = 0;
+    ParseResult result = parseMagnitude(first + negative, end, max, magnitude);
+    if (result.error == ParseError::invalid)
+        return ParseResult{ 0, ParseError::invalid };
+    result.length += negative;
+    if (result.error == ParseError::none)
+        value = negative ? (long long)(0 - magnitude) : (long long)magnitude;
+    return result;
+}
+
+ParseResult parseUInt(StringView text, unsigned long long& value)
+{
+    uint64 magnitude = 0;
+    ParseResult result = parseMagnitude(text.data(), text.data() + text.length(), ~uint64(0), magnitude);
+    if (result.error == ParseError::none)
+        value = magnitude;
+    return result;
+}
+
+ParseResult parseDouble(StringView text, double& value)
+{
+    return parseFloating<DoubleFormat>(text, value);
+}
+
+ParseResult parseFloat(StringView text, float& value)
+{
+    return parseFloating<FloatFormat>(text, value);
+}
+
+ParseResult parseDelimited(StringView text, char delimiter, Array<long long>& values)
+{
+    return parseValues(text, delimiter, values, [](StringView str, long long& value) { return parseInt(str, value); });
+}
+
+ParseResult parseDelimited(StringView text, char delimiter, Array<unsigned long long>& values)
+{
+    return parseValues(text, delimiter, values, [](StringView str, unsigned long long& value) { return parseUInt(str, value); });
+}
+
+ParseResult parseDelimited(StringView text, char delimiter, Array<double>& values)
+{
+    return parseValues(text, delimiter, values, [](StringView str, double& value) { return parseDouble(str, value); });
+}
+
+ParseResult parseDelimited(StringView text, char delimiter, Array<float>& values)
+{
+    return parseValues(text, delimiter, values, [](StringView str, float& value) { return parseFloat(str, value); });
+}
+
+}
@@ -0,0 +1,317 @@
+/*
+ * ---------------------------------------------------
+ * Rope.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:31:17
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/Rope.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <utility>
+
+namespace utils
+{
+
+namespace
+{
+
+constexpr Rope::Size s_chunkSize = 1024;
+
+}
+
+struct Rope::Node
+{
+    String chunk;
+    Size total; // characters in the subtree
+    uint32 priority;
+    Node* left;
+    Node* right;
+
+    static inline Size totalOf(const Node* node) { return node == nullptr ? 0 : node->total; }
+
+    static inline void update(Node* node) { node->total = totalOf(node->left) + node->chunk.length() + totalOf(node->right); }
+
+    static uint32 nextPriority(uint32& random)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        return random;
+    }
+
+    static Node* makeNode(StringView text, uint32& random)
+    {
+        return new Node{String(text), text.length(), nextPriority(random), nullptr, nullptr};
+    }
+
+    static void destroy(Node* node)
+    {
+        if (node == nullptr)
+            return;
+        destroy(node->left);
+        destroy(node->right);
+        delete node;
+    }
+
+    static Node* clone(const Node* node)
+    {
+        if (node == nullptr)
+            return nullptr;
+        Node* copy = new Node{node->chunk, node->total, node->priority, nullptr, nullptr};
+        try
+        {
+            copy->left = clone(node->left);
+            copy->right = clone(node->right);
+        }
+        catch (...)
+        {
+            destroy(copy);
+            throw;
+        }
+        return copy;
+    }
+
+    // all the characters of a before the ones of b
+    static Node* merge(Node* a, Node* b)
+    {
+        if (a == nullptr)
+            return b;
+        if (b == nullptr)
+            return a;
+        if (a->priority > b->priority)
+        {
+            a->right = merge(a->right, b);
+            update(a);
+            return a;
+        }
+        b->left = merge(a, b->left);
+        update(b);
+        return b;
+    }
+
+    // the first pos characters in left, the others in right. A chunk containing pos is cut in two nodes
+    static void split(Node* node, Size pos, Node*& left, Node*& right, uint32& random)
+    {
+        if (node == nullptr)
+        {
+            left = right = nullptr;
+            return;
+        }
+        Size leftTotal = totalOf(node->left);
+        Size chunkEnd = leftTotal + node->chunk.length();
+        if (pos <= leftTotal)
+        {
+            split(node->left, pos, left, node->left, random);
+            update(node);
+            right = node;
+        }
+        else if (pos >= chunkEnd)
+        {
+            split(node->right, pos - chunkEnd, node->right, right, random);
+            update(node);
+            left = node;
+        }
+        else
+        {
+            StringView chunk = node->chunk;
+            Node* cut = makeNode(chunk.substr(pos - leftTotal), random);
+            node->chunk = String(chunk.substr(0, pos - leftTotal));
+            right = merge(cut, node->right);
+            node->right = nullptr;
+            update(node);
+            left = node;
+        }
+    }
+
+    // append text to the last chunk if it fits, updating the totals along the right spine
+    static bool appendToLast(Node* node, StringView text)
+    {
+        if (node->right != nullptr)
+        {
+            if (appendToLast(node->right, text) == false)
+                return false;
+        }
+        else if (node->chunk.length() + text.length() <= s_chunkSize)
+            node->chunk.append(text);
+        else
+            return false;
+        node->total += text.length();
+        return true;
+    }
+
+    static Node* build(StringView text, uint32& random)
+    {
+        Node* root = nullptr;
+        for (Size pos = 0; pos < text.length(); pos += s_chunkSize)
+            root = merge(root, makeNode(text.substr(pos, s_chunkSize), random));
+        return root;
+    }
+
+    static void forEach(const Node* node, Size pos, Size end, const Func<void(StringView)>& function)
+    {
+        while (node != nullptr && pos < end)
+        {
+            Size leftTotal = totalOf(node->left);
+            if (pos < leftTotal)
+                forEach(node->left, pos, end < leftTotal ? end : leftTotal, function);
+            Size chunkEnd = leftTotal + node->chunk.length();
+            if (end > leftTotal && pos < chunkEnd)
+            {
+                Size first = pos > leftTotal ? pos - leftTotal : 0;
+                Size last = (end < chunkEnd ? end : chunkEnd) - leftTotal;
+                function(StringView(node->chunk).substr(first, last - first));
+            }
+            if (end <= chunkEnd)
+                return;
+            pos = pos > chunkEnd ? pos - chunkEnd : 0;
+            end -= chunkEnd;
+            node = node->right;
+        }
+    }
+};
+
+Rope::Rope(const Rope& cp) : m_root(Node::clone(cp.m_root)), m_random(cp.m_random)
+{
+}
+
+Rope::Rope(Rope&& mv) noexcept : m_root(mv.m_root), m_random(mv.m_random)
+{
+    mv.m_root = nullptr;
+}
+
+Rope::Rope(StringView text) : m_root(nullptr)
+{
+    m_root = Node::build(text, m_random);
+}
+
+void Rope::insert(Index pos, StringView text)
+{
+    if (text.isEmpty())
+        return;
+    Size size = length();
+    if (pos > size)
+        pos = size;
+    Node* left = nullptr;
+    Node* right = nullptr;
+    Node::split(m_root, pos, left, right, m_random);
+    if (left == nullptr || Node::appendToLast(left, text) == false)
+    {
+        Node* middle = nullptr;
+        try
+        {
+            middle = Node::build(text, m_random);
+        }
+        catch (...)
+        {
+            m_root = Node::merge(left, right);
+            throw;
+        }
+        left = Node::merge(left, middle);
+    }
+    m_root = Node::merge(left, right);
+}
+
+void Rope::remove(Index pos, Size length)
+{
+    Size size = this->length();
+    if (pos >= size || length == 0)
+        return;
+    if (length > size - pos)
+        length = size - pos;
+    Node* left = nullptr;
+    Node* middle = nullptr;
+    Node* right = nullptr;
+    Node::split(m_root, pos, left, right, m_random);
+    Node::split(right, length, middle, right, m_random);
+    Node::destroy(middle);
+    m_root = Node::merge(left, right);
+}
+
+String Rope::substr(Index pos, Size length) const
+{
+    Size size = this->length();
+    if (pos > size)
+        pos = size;
+    if (length > size - pos)
+        length = size - pos;
+    StringBuilder builder(length);
+    Node::forEach(m_root, pos, pos + length, [&](StringView chunk) { builder.append(chunk); });
+    return builder.build();
+}
+
+String Rope::toString() const
+{
+    return substr(0, length());
+}
+
+void Rope::forEachChunk(Index pos, Size length, const Func<void(StringView)>& function) const
+{
+    Size size = this->length();
+    if (pos > size)
+        pos = size;
+    if (length > size - pos)
+        length = size - pos;
+    Node::forEach(m_root, pos, pos + length, function);
+}
+
+void Rope::clear()
+{
+    Node::destroy(m_root);
+    m_root = nullptr;
+}
+
+Rope::~Rope()
+{
+    Node::destroy(m_root);
+}
+
+Rope::Size Rope::total(const Node* node)
+{
+    return Node::totalOf(node);
+}
+
+Rope& Rope::operator = (const Rope& cp)
+{
+    if (this != &cp)
+    {
+        Node* root = Node::clone(cp.m_root);
+        Node::destroy(m_root);
+        m_root = root;
+    }
+    return *this;
+}
+
+Rope& Rope::operator = (Rope&& mv) noexcept
+{
+    if (this != &mv)
+    {
+        Node::destroy(m_root);
+        m_root = mv.m_root;
+        mv.m_root = nullptr;
+    }
+    return *this;
+}
+
+char Rope::operator [] (Index idx) const
+{
+    const Node* node = m_root;
+    for (;;)
+    {
+        Size leftTotal = Node::totalOf(node->left);
+        if (idx < leftTotal)
+            node = node->left;
+        else if (idx < leftTotal + node->chunk.length())
+            return node->chunk[idx - leftTotal];
+        else
+        {
+            idx -= leftTotal + node->chunk.length();
+            node = node->right;
+        }
+    }
+}
+
+}
@@ -8,91 +8,238 @@
  */
 
 #include "UtilsCPP/String.hpp"
+#include "UtilsCPP/NumberFormat.hpp"
 #include "UtilsCPP/Types.hpp"
 
 #include <cstring>
 #include <istream>
 #include <fstream>
+#include <utility>
 
 namespace utils
 {
 
-String::String() : m_characters(1, '\0')
+constexpr StringView::Size StringView::npos;
+
+String::String(const String& cp) : m_data(cp.m_data), m_length(cp.m_length)
 {
+    setCachedHash(cp.cachedHash());
+    if (cp.isLiteral())
+        m_capacity = 0;
+    else
+        init(cp.m_data, cp.m_length);
 }
 
-String::String(const char* literal) : m_characters(literal, literal + (std::strlen(literal) + 1))
+String::String(const char* str) : String(str, std::strlen(str))
 {
 }
 
-String::String(Size length, char c) : m_characters(length + 1, c)
+String::String(const char* str, Size length) : m_data(nullptr), m_length(length)
 {
-    m_characters.last() = '\0';
+    init(str, length);
 }
 
-String String::contentOf(std::istream& istream)
+String::String(Size length, char c) : m_data(nullptr), m_length(length)
 {
-    String output;
+    init(nullptr, length);
+    std::memset(m_data, c, length);
+}
 
-    char c = (char)istream.get();
-    while (c != std::istream::traits_type::eof())
-    {
-        output.append(c);
-        c = (char)istream.get();
-    }
+String String::literal(const char* str)
+{
+    return String::literal(str, std::strlen(str));
+}
 
+String String::literal(const char* str, Size length)
+{
+    String output;
+    output.m_data = const_cast<char*>(str); // never written, non-const accesses copy it first
+    output.m_length = length;
+    output.m_capacity = 0;
+    return output;
+}
+
+String String::contentOf(std::istream& istream)
+{
+    String output;
+    output.read(istream);
     return output;
 }
 
 String String::contentOfFile(const String& path)
 {
-    std::ifstream ifstream(std::string((const char*)path));
-    return String::contentOf(ifstream);
+    String output;
+    String::contentOfFile(path, output);
+    return output;
 }
 
-String String::fromUInt(uint32 nbr) // NOLINT(misc-no-recursion)
+void String::contentOf(std::istream& istream, String& output)
 {
-    if (nbr / 10 == 0) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
-        return String(1, (char)(nbr + '0'));
-    return String::fromUInt(nbr / 10) + String(1, (char)(nbr % 10 + '0')); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    output.detach();
+    output.m_length = 0;
+    output.m_data[0] = '\0';
+    output.read(istream);
 }
 
-void String::append(char c)
+void String::contentOfFile(const String& path, String& output)
 {
-    m_characters.last() = c;
-    m_characters.append('\0');
+    std::ifstream ifstream((const char*)path);
+    String::contentOf(ifstream, output);
 }
 
-String::Index String::lastIndexOf(char c) const
+String String::fromInt(long long nbr)
 {
-    Index idx = length() - 1;
-    while (m_characters[idx] != c)
-        idx--;
-    return idx;
+    char buffer[maxNumberLength];
+    return String(buffer, formatInt(buffer, nbr));
 }
 
-String String::substr(Index start, Size len) const // NOLINT(bugprone-easily-swappable-parameters)
+String String::fromUInt(unsigned long long nbr)
 {
-    String newStr(len, '\0');
-    for (Index idx = 0; idx < len; idx++)
-        newStr[idx] = m_characters[start + idx];
-    return newStr;
+    char buffer[maxNumberLength];
+    return String(buffer, formatUInt(buffer, nbr));
+}
+
+String String::fromDouble(double nbr)
+{
+    char buffer[maxNumberLength];
+    return String(buffer, formatDouble(buffer, nbr));
+}
+
+void String::append(char c)
+{
+    setCachedHash(0);
+    if (isLiteral() || m_length + 1 >= capacity())
+        reserve(m_length + 2);
+    m_data[m_length++] = c;
+    m_data[m_length] = '\0';
+}
+
+void String::append(StringView str)
+{
+    if (str.isEmpty())
+        return;
+    setCachedHash(0);
+    if (isLiteral() || m_length + str.length() >= capacity())
+    {
+        if (str.data() >= m_data && str.data() <= m_data + m_length)
+            return append(StringView(String(str))); // str is a slice of this string, reserve could free it
+        reserve(m_length + str.length() + 1);
+    }
+    std::memcpy(m_data + m_length, str.data(), str.length());
+    m_length += str.length();
+    m_data[m_length] = '\0';
 }
 
 void String::safecpy(char* dst, uint64 buffSize) const
 {
     uint64 i = 0;
     for (; i < buffSize - 1 && i < length(); i++)
-        dst[i] = m_characters[i];
+        dst[i] = m_data[i];
     dst[i] = '\0';
 }
 
 String operator + (const String& s1, const String& s2)
 {
     String output(s1.length() + s2.length());
-    std::memcpy(&output[0],           (const char*)s1, s1.length());
-    std::memcpy(&output[s1.length()], (const char*)s2, s2.length());
+    std::memcpy(output.m_data,               s1.m_data, s1.length());
+    std::memcpy(output.m_data + s1.length(), s2.m_data, s2.length());
     return output;
 }
 
+String operator + (String&& s1, const String& s2)
+{
+    s1.append(s2);
+    return std::move(s1);
+}
+
+String& String::operator = (const String& cp)
+{
+    if (this == &cp)
+        return *this;
+    if (cp.isLiteral() == false && isLiteral() == false && cp.m_length < capacity())
+    {
+        std::memcpy(m_data, cp.m_data, cp.m_length + 1);
+        m_length = cp.m_length;
+        setCachedHash(cp.cachedHash());
+        return *this;
+    }
+    return *this = String(cp);
+}
+
+void String::init(const char* str, Size length)
+{
+    if (length <= s_inlineCapacity)
+        m_data = m_inline;
+    else
+    {
+        m_data = (char*)operator new (length + 1);
+        m_capacity = length + 1;
+    }
+    if (str != nullptr)
+        std::memcpy(m_data, str, length);
+    m_data[length] = '\0';
+}
+
+void String::reserve(Size capacity)
+{
+    if (isLiteral() == false && capacity <= this->capacity())
+        return;
+    if (capacity <= s_inlineCapacity + 1)
+    {
+        // only a literal can get here, its characters are not in m_inline
+        std::memcpy(m_inline, m_data, m_length);
+        m_inline[m_length] = '\0';
+        m_data = m_inline;
+        return;
+    }
+    if (isLiteral() == false && capacity < this->capacity() * 2)
+        capacity = this->capacity() * 2;
+    char* buffer = (char*)operator new (capacity);
+    std::memcpy(buffer, m_data, m_length);
+    buffer[m_length] = '\0';
+    if (isHeap())
+        operator delete (m_data);
+    m_data = buffer;
+    m_capacity = capacity;
+}
+
+void String::read(std::istream& istream)
+{
+    using traits = std::istream::traits_type;
+    constexpr Size blockSize = 1 << 16;
+
+    std::streambuf* buffer = istream.rdbuf();
+    if (buffer == nullptr || istream.good() == false)
+        return;
+
+    // the remaining size is known for a file, one allocation and a single read then
+    std::streampos current = buffer->pubseekoff(0, std::ios::cur, std::ios::in);
+    if (current != std::streampos(-1))
+    {
+        std::streampos end = buffer->pubseekoff(0, std::ios::end, std::ios::in);
+        buffer->pubseekpos(current, std::ios::in);
+        if (end != std::streampos(-1) && end > current)
+            reserve(m_length + (Size)(end - current) + 1);
+    }
+
+    for (;;)
+    {
+        Size room = isLiteral() ? 0 : capacity() - m_length - 1;
+        if (room == 0)
+        {
+            // don't grow a buffer that is exactly filled by the stream
+            if (traits::eq_int_type(buffer->sgetc(), traits::eof()))
+                break;
+            reserve(m_length + blockSize + 1);
+            room = capacity() - m_length - 1;
+        }
+        std::streamsize count = buffer->sgetn(m_data + m_length, (std::streamsize)room);
+        m_length += (Size)count;
+        m_data[m_length] = '\0';
+        if ((Size)count < room)
+            break;
+    }
+    istream.setstate(std::ios::eofbit);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+ * ---------------------------------------------------
+ * StringBuilder.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:15:49
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstring>
+
+namespace utils
+{
+
+StringBuilder& StringBuilder::append(char c, Size count)
+{
+    std::memset(space(count), c, count);
+    return written(count);
+}
+
+void StringBuilder::clear()
+{
+    m_string.detach();
+    m_string.m_length = 0;
+    m_string.m_data[0] = '\0';
+}
+
+char* StringBuilder::space(Size count)
+{
+    reserve(m_string.m_length + count);
+    return m_string.m_data + m_string.m_length;
+}
+
+StringBuilder& StringBuilder::written(Size count)
+{
+    m_string.m_length += count;
+    m_string.m_data[m_string.m_length] = '\0';
+    return *this;
+}
+
+}
@@ -0,0 +1,250 @@
+/*
+ * ---------------------------------------------------
+ * StringPool.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 05:47:33
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/StringPool.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace utils
+{
+
+namespace
+{
+
+using stringPool::Entry;
+
+constexpr uint64 s_blockSize = 64 * 1024;
+constexpr uint64 s_initialSlotCount = 64;
+
+constexpr uint64 s_cacheSize = 256;
+
+// a thread cache slot only matches the pool with its pool id, ids are never reused
+struct CacheSlot
+{
+    uint64 poolId;
+    const Entry* entry;
+};
+
+thread_local CacheSlot t_cache[s_cacheSize];
+
+std::atomic<uint64> s_nextPoolId(1);
+
+inline bool matches(const Entry* entry, StringView str, uint64 hash)
+{
+    return entry->hash == hash && entry->length == str.length() && std::memcmp(entry->data(), str.data(), str.length()) == 0;
+}
+
+}
+
+// open addressing table of entry pointers, at most half full. Slots are only ever filled, so the
+// readers probe it without lock, the tables replaced by a larger one are kept until the pool is destroyed
+struct StringPool::Table
+{
+    uint64 mask;
+    Table* previous;
+    std::atomic<const Entry*>* slots;
+
+    Table(uint64 slotCount, Table* prev) : mask(slotCount - 1), previous(prev), slots(new std::atomic<const Entry*>[slotCount])
+    {
+        for (uint64 i = 0; i < slotCount; i++)
+            slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~Table() { delete[] slots; }
+
+    const Entry* find(StringView str, uint64 hash) const
+    {
+        for (uint64 i = hash & mask;; i = (i + 1) & mask)
+        {
+            const Entry* entry = slots[i].load(std::memory_order_acquire);
+            if (entry == nullptr || matches(entry, str, hash))
+                return entry;
+        }
+    }
+
+    // writers only
+    void insert(const Entry* entry, std::memory_order order)
+    {
+        uint64 i = entry->hash & mask;
+        while (slots[i].load(std::memory_order_relaxed) != nullptr)
+            i = (i + 1) & mask;
+        slots[i].store(entry, order);
+    }
+};
+
+struct StringPool::Shard
+{
+    // characters arena: blocks linked by their first bytes, entries bump allocated in the last one
+    struct Block
+    {
+        Block* next;
+        uint64 size;
+    };
+
+    std::mutex mutex;
+    std::atomic<Table*> table{nullptr};
+    uint64 count = 0;
+    Block* blocks = nullptr;
+    byte* cursor = nullptr;
+    uint64 remaining = 0;
+    uint64 allocated = 0;
+    byte padding[64]; // keep the shards on separate cache lines
+
+    Entry* allocate(uint64 size)
+    {
+        size = (size + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+        if (size > remaining)
+        {
+            // a large string gets its own block instead of wasting the rest of the current one
+            uint64 blockSize = size > s_blockSize / 4 ? size : s_blockSize;
+            Block* block = static_cast<Block*>(operator new (sizeof(Block) + blockSize));
+            block->next = blocks;
+            block->size = blockSize;
+            blocks = block;
+            allocated += sizeof(Block) + blockSize;
+            if (blockSize != s_blockSize)
+                return reinterpret_cast<Entry*>(block + 1);
+            cursor = reinterpret_cast<byte*>(block + 1);
+            remaining = blockSize;
+        }
+        Entry* entry = reinterpret_cast<Entry*>(cursor);
+        cursor += size;
+        remaining -= size;
+        return entry;
+    }
+
+    // the current table, first replaced by a larger one when it has no room for one more entry
+    Table* tableForInsert()
+    {
+        Table* current = table.load(std::memory_order_relaxed);
+        if (current != nullptr && (count + 1) * 2 <= current->mask + 1)
+            return current;
+        Table* grown = new Table(current == nullptr ? s_initialSlotCount : (current->mask + 1) * 2, current);
+        if (current != nullptr)
+        {
+            for (uint64 i = 0; i <= current->mask; i++)
+            {
+                const Entry* moved = current->slots[i].load(std::memory_order_relaxed);
+                if (moved != nullptr)
+                    grown->insert(moved, std::memory_order_relaxed);
+            }
+        }
+        table.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    ~Shard()
+    {
+        Table* current = table.load(std::memory_order_relaxed);
+        while (current != nullptr)
+        {
+            Table* previous = current->previous;
+            delete current;
+            current = previous;
+        }
+        while (blocks != nullptr)
+        {
+            Block* next = blocks->next;
+            operator delete (blocks);
+            blocks = next;
+        }
+    }
+};
+
+StringPool::StringPool(bool threadCache)
+    : m_shards(new Shard[uint64(1) << s_shardBits]),
+      m_poolId(s_nextPoolId.fetch_add(1, std::memory_order_relaxed)),
+      m_threadCache(threadCache)
+{
+}
+
+InternedString StringPool::intern(StringView str)
+{
+    if (str.isEmpty())
+        return InternedString();
+    uint64 hash = hashBytes(str.data(), str.length());
+
+    CacheSlot* cached = nullptr;
+    if (m_threadCache)
+    {
+        cached = &t_cache[(hash >> s_shardBits) & (s_cacheSize - 1)];
+        if (cached->poolId == m_poolId && matches(cached->entry, str, hash))
+            return InternedString(cached->entry);
+    }
+
+    const Entry* entry = lookup(str, hash);
+    if (entry == nullptr)
+    {
+        Shard& shard = m_shards[hash >> (64 - s_shardBits)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        entry = table == nullptr ? nullptr : table->find(str, hash);
+        if (entry == nullptr)
+        {
+            table = shard.tableForInsert();
+            Entry* newEntry = shard.allocate(sizeof(Entry) + str.length() + 1);
+            newEntry->hash = hash;
+            newEntry->length = str.length();
+            newEntry->id = m_nextId.fetch_add(1, std::memory_order_relaxed);
+            char* data = reinterpret_cast<char*>(newEntry + 1);
+            std::memcpy(data, str.data(), str.length());
+            data[str.length()] = '\0';
+            table->insert(newEntry, std::memory_order_release); // publishes the characters written above
+            shard.count++;
+            entry = newEntry;
+        }
+    }
+
+    if (cached != nullptr)
+    {
+        cached->poolId = m_poolId;
+        cached->entry = entry;
+    }
+    return InternedString(entry);
+}
+
+InternedString StringPool::find(StringView str) const
+{
+    if (str.isEmpty())
+        return InternedString();
+    return InternedString(lookup(str, hashBytes(str.data(), str.length())));
+}
+
+StringPool::Size StringPool::memoryUsage() const
+{
+    Size size = 0;
+    for (uint64 i = 0; i < (uint64(1) << s_shardBits); i++)
+    {
+        Shard& shard = m_shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.allocated;
+        for (const Table* table = shard.table.load(std::memory_order_relaxed); table != nullptr; table = table->previous)
+            size += (table->mask + 1) * sizeof(std::atomic<const Entry*>);
+    }
+    return size;
+}
+
+StringPool::~StringPool()
+{
+    delete[] m_shards;
+}
+
+const stringPool::Entry* StringPool::lookup(StringView str, uint64 hash) const
+{
+    // the shard uses the high bits of the hash and the table slots the low ones
+    const Table* table = m_shards[hash >> (64 - s_shardBits)].table.load(std::memory_order_acquire);
+    return table == nullptr ? nullptr : table->find(str, hash);
+}
+
+}
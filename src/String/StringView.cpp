@@ -0,0 +1,404 @@
+/*
+ * ---------------------------------------------------
+ * StringView.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 05:08:26
+ * ---------------------------------------------------
+ */
+
+#include "UtilsCPP/StringView.hpp"
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Types.hpp"
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define UTILSCPP_STRINGVIEW_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace utils
+{
+
+namespace
+{
+
+#ifdef UTILSCPP_STRINGVIEW_SSE2
+constexpr uint64 s_blockSize = 16;
+
+inline __m128i load(const char* ptr) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+inline uint32 matchMask(__m128i block, __m128i c) { return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, c)); }
+#endif
+
+inline uint32 lowestBit(uint32 mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long idx = 0;
+    _BitScanForward(&idx, mask);
+    return (uint32)idx;
+#else
+    uint32 idx = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        idx++;
+    }
+    return idx;
+#endif
+}
+
+inline uint32 highestBit(uint32 mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - (uint32)__builtin_clz(mask);
+#elif defined(_MSC_VER)
+    unsigned long idx = 0;
+    _BitScanReverse(&idx, mask);
+    return (uint32)idx;
+#else
+    uint32 idx = 0;
+    while (mask >>= 1)
+        idx++;
+    return idx;
+#endif
+}
+
+// the candidates rejected by the first / last character filter cost up to a pattern length each,
+// past s_verifyBudget compared characters per text character the search switches to Two-Way
+constexpr uint64 s_verifyBudget = 4;
+
+inline bool overBudget(uint64 rejected, uint64 patternLength, uint64 scanned)
+{
+    return rejected * patternLength > s_verifyBudget * (scanned + 64);
+}
+
+// Two-Way (Crochemore and Perrin): the pattern is split at its critical factorization, the right
+// part is compared first and the shifts use the pattern period, so a search compares each text
+// character a bounded number of times whatever the pattern and the text. Pattern of 2 characters or more.
+const char* twoWay(const char* text, uint64 length, const char* pattern, uint64 patternLength)
+{
+    const unsigned char* txt = reinterpret_cast<const unsigned char*>(text);
+    const unsigned char* pat = reinterpret_cast<const unsigned char*>(pattern);
+    const unsigned char* end = txt + length;
+
+    // bad character shifts, only read for the characters of the pattern
+    bool inPattern[256] = {};
+    uint64 shift[256];
+    for (uint64 i = 0; i < patternLength; i++)
+    {
+        inPattern[pat[i]] = true;
+        shift[pat[i]] = i + 1;
+    }
+
+    // maximal suffix for the two orderings of the characters, the longest one is the critical
+    // factorization, ip wraps from ~0 like in the reference algorithm
+    uint64 ip = ~uint64(0), jp = 0, k = 1, p = 1;
+    while (jp + k < patternLength)
+    {
+        if (pat[ip + k] == pat[jp + k])
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+                k++;
+        }
+        else if (pat[ip + k] > pat[jp + k])
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    uint64 criticalPos = ip;
+    uint64 period = p;
+
+    ip = ~uint64(0), jp = 0, k = 1, p = 1;
+    while (jp + k < patternLength)
+    {
+        if (pat[ip + k] == pat[jp + k])
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+                k++;
+        }
+        else if (pat[ip + k] < pat[jp + k])
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    if (ip + 1 > criticalPos + 1)
+    {
+        criticalPos = ip;
+        period = p;
+    }
+
+    // a periodic pattern remembers the prefix already matched after a shift by its period
+    uint64 memory = 0, periodMemory;
+    if (std::memcmp(pat, pat + period, criticalPos + 1) != 0)
+    {
+        period = (criticalPos > patternLength - criticalPos - 1 ? criticalPos : patternLength - criticalPos - 1) + 1;
+        periodMemory = 0;
+    }
+    else
+        periodMemory = patternLength - period;
+
+    while ((uint64)(end - txt) >= patternLength)
+    {
+        unsigned char lastChar = txt[patternLength - 1];
+        if (inPattern[lastChar] == false)
+        {
+            txt += patternLength;
+            memory = 0;
+            continue;
+        }
+        k = patternLength - shift[lastChar];
+        if (k != 0)
+        {
+            txt += k < memory ? memory : k;
+            memory = 0;
+            continue;
+        }
+
+        for (k = criticalPos + 1 > memory ? criticalPos + 1 : memory; k < patternLength && pat[k] == txt[k]; k++)
+            ;
+        if (k < patternLength)
+        {
+            txt += k - criticalPos;
+            memory = 0;
+            continue;
+        }
+
+        for (k = criticalPos + 1; k > memory && pat[k - 1] == txt[k - 1]; k--)
+            ;
+        if (k <= memory)
+            return reinterpret_cast<const char*>(txt);
+        txt += period;
+        memory = periodMemory;
+    }
+    return nullptr;
+}
+
+// pattern of 2 characters or more, no longer than the text
+const char* search(const char* text, uint64 length, const char* pattern, uint64 patternLength)
+{
+    const char first = pattern[0];
+    const char last = pattern[patternLength - 1];
+    const uint64 lastStart = length - patternLength;
+    uint64 rejected = 0;
+    uint64 pos = 0;
+
+#ifdef UTILSCPP_STRINGVIEW_SSE2
+    // the candidates of 32 positions (two blocks) at a time, the loads shifted by patternLength - 1
+    // read the characters matching the last one of the pattern
+    const __m128i firsts = _mm_set1_epi8(first);
+    const __m128i lasts = _mm_set1_epi8(last);
+    for (; pos + 2 * s_blockSize <= lastStart + 1; pos += 2 * s_blockSize)
+    {
+        const char* block = text + pos;
+        __m128i low = _mm_and_si128(_mm_cmpeq_epi8(load(block), firsts), _mm_cmpeq_epi8(load(block + patternLength - 1), lasts));
+        __m128i high = _mm_and_si128(_mm_cmpeq_epi8(load(block + s_blockSize), firsts), _mm_cmpeq_epi8(load(block + s_blockSize + patternLength - 1), lasts));
+        uint32 mask = (uint32)_mm_movemask_epi8(_mm_or_si128(low, high));
+        if (mask == 0)
+            continue;
+        mask = (uint32)_mm_movemask_epi8(low) | (uint32)_mm_movemask_epi8(high) << 16;
+        while (mask != 0)
+        {
+            uint64 candidate = pos + lowestBit(mask);
+            if (std::memcmp(text + candidate + 1, pattern + 1, patternLength - 2) == 0)
+                return text + candidate;
+            rejected++;
+            mask &= mask - 1;
+        }
+        if (overBudget(rejected, patternLength, pos))
+            return twoWay(text + pos + 2 * s_blockSize, length - pos - 2 * s_blockSize, pattern, patternLength);
+    }
+#endif
+
+    while (pos <= lastStart)
+    {
+        const void* found = std::memchr(text + pos, first, lastStart - pos + 1);
+        if (found == nullptr)
+            return nullptr;
+        pos = (uint64)(static_cast<const char*>(found) - text);
+        if (text[pos + patternLength - 1] == last && std::memcmp(text + pos + 1, pattern + 1, patternLength - 2) == 0)
+            return text + pos;
+        pos++;
+        if (overBudget(++rejected, patternLength, pos))
+            return twoWay(text + pos, length - pos, pattern, patternLength);
+    }
+    return nullptr;
+}
+
+inline uint64 reverseFind(const char* data, uint64 length, char c)
+{
+#ifdef UTILSCPP_STRINGVIEW_SSE2
+    const __m128i cs = _mm_set1_epi8(c);
+    for (; length >= s_blockSize; length -= s_blockSize)
+    {
+        uint32 mask = matchMask(load(data + length - s_blockSize), cs);
+        if (mask != 0)
+            return length - s_blockSize + highestBit(mask);
+    }
+#endif
+    while (length > 0)
+    {
+        if (data[--length] == c)
+            return length;
+    }
+    return StringView::npos;
+}
+
+}
+
+StringView::Index StringView::indexOf(StringView str, Index from) const
+{
+    if (str.m_length == 0)
+        return from <= m_length ? from : npos;
+    if (from > m_length || str.m_length > m_length - from)
+        return npos;
+    if (str.m_length == 1)
+        return indexOf(str.m_data[0], from);
+    const char* found = search(m_data + from, m_length - from, str.m_data, str.m_length);
+    return found == nullptr ? npos : (Index)(found - m_data);
+}
+
+StringView::Index StringView::lastIndexOf(char c) const
+{
+    return reverseFind(m_data, m_length, c);
+}
+
+StringView::Index StringView::lastIndexOf(StringView str) const
+{
+    if (str.m_length > m_length)
+        return npos;
+    if (str.m_length == 0)
+        return m_length;
+    // the candidates are the occurrences of the last character of str
+    Size end = m_length;
+    while (end >= str.m_length)
+    {
+        end = reverseFind(m_data + str.m_length - 1, end - str.m_length + 1, str.m_data[str.m_length - 1]);
+        if (end == npos)
+            return npos;
+        if (equal(m_data + end, str.m_data, str.m_length - 1))
+            return end;
+        end += str.m_length - 1;
+    }
+    return npos;
+}
+
+StringView::Size StringView::count(char c) const
+{
+    Size count = 0;
+    Index idx = 0;
+#ifdef UTILSCPP_STRINGVIEW_SSE2
+    // the matches (-1 bytes) are subtracted from 16 byte counters, summed before they can overflow
+    const __m128i cs = _mm_set1_epi8(c);
+    const __m128i zero = _mm_setzero_si128();
+    while (m_length - idx >= s_blockSize)
+    {
+        __m128i counters = zero;
+        for (int i = 0; i < 255 && m_length - idx >= s_blockSize; i++, idx += s_blockSize)
+            counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(load(m_data + idx), cs));
+        __m128i sums = _mm_sad_epu8(counters, zero);
+        count += (Size)_mm_extract_epi16(sums, 0) + (Size)_mm_extract_epi16(sums, 4);
+    }
+#endif
+    for (; idx < m_length; idx++)
+        count += m_data[idx] == c;
+    return count;
+}
+
+StringView::Size StringView::count(StringView str) const
+{
+    if (str.m_length == 0)
+        return 0;
+    if (str.m_length == 1)
+        return count(str.m_data[0]);
+    Size count = 0;
+    for (Index idx = indexOf(str); idx != npos; idx = indexOf(str, idx + str.m_length))
+        count++;
+    return count;
+}
+
+StringView::Index StringView::findAnyOf(StringView set, Index from) const
+{
+    if (from >= m_length || set.m_length == 0)
+        return npos;
+    if (set.m_length == 1)
+        return indexOf(set.m_data[0], from);
+
+    Index idx = from;
+#ifdef UTILSCPP_STRINGVIEW_SSE2
+    // small sets (delimiters, whitespaces) compare the blocks with each character of the set
+    constexpr Size maxVectorSet = 8;
+    if (set.m_length <= maxVectorSet)
+    {
+        __m128i cs[maxVectorSet];
+        for (Size i = 0; i < set.m_length; i++)
+            cs[i] = _mm_set1_epi8(set.m_data[i]);
+        for (; m_length - idx >= s_blockSize; idx += s_blockSize)
+        {
+            __m128i block = load(m_data + idx);
+            __m128i matches = _mm_cmpeq_epi8(block, cs[0]);
+            for (Size i = 1; i < set.m_length; i++)
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, cs[i]));
+            uint32 mask = (uint32)_mm_movemask_epi8(matches);
+            if (mask != 0)
+                return idx + lowestBit(mask);
+        }
+    }
+#endif
+    bool inSet[256] = {};
+    for (char c : set)
+        inSet[(unsigned char)c] = true;
+    for (; idx < m_length; idx++)
+    {
+        if (inSet[(unsigned char)m_data[idx]])
+            return idx;
+    }
+    return npos;
+}
+
+void StringView::splitInto(char delimiter, Array<StringView>& fields) const
+{
+    fields.truncate(0);
+    for (StringView field : split(delimiter))
+        fields.append(field);
+}
+
+void StringView::splitInto(StringView delimiter, Array<StringView>& fields) const
+{
+    fields.truncate(0);
+    for (StringView field : split(delimiter))
+        fields.append(field);
+}
+
+}
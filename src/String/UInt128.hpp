@@ -0,0 +1,44 @@
+/*
+ * ---------------------------------------------------
+ * UInt128.hpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 04:12:33
+ * ---------------------------------------------------
+ */
+
+#ifndef UINT128_HPP
+# define UINT128_HPP
+
+#include "UtilsCPP/Types.hpp"
+
+namespace utils
+{
+
+namespace uint128
+{
+
+// full 64 x 64 bits product, return the low 64 bits and write the high ones in high
+inline uint64 multiply(uint64 a, uint64 b, uint64& high)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using type = unsigned __int128;
+    type product = (type)a * b;
+    high = (uint64)(product >> 64);
+    return (uint64)product;
+#else
+    uint64 aLow = (uint32)a, aHigh = a >> 32;
+    uint64 bLow = (uint32)b, bHigh = b >> 32;
+    uint64 b00 = aLow * bLow, b01 = aLow * bHigh, b10 = aHigh * bLow, b11 = aHigh * bHigh;
+    uint64 mid1 = b10 + (b00 >> 32);
+    uint64 mid2 = b01 + (uint32)mid1;
+    high = b11 + (mid1 >> 32) + (mid2 >> 32);
+    return (mid2 << 32) | (uint32)b00;
+#endif
+}
+
+}
+
+}
+
+#endif // UINT128_HPP
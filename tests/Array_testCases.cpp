@@ -393,6 +393,24 @@ TYPED_TEST(ArrayTest, clear) { this->test([this]()
     ASSERT_NE(this->m_array.m_buffer,   nullptr);
 });}
 
+TYPED_TEST(ArrayTest, truncate) { this->test([this]()
+{
+    using Size = typename Array<TypeParam>::Size;
+
+    Size capacity = this->m_array.m_capacity;
+    Size length = this->m_array.m_length / 2;
+    this->m_array.truncate(length);
+    this->m_vector.resize((std::size_t)length);
+
+    ASSERT_EQ(this->m_array.m_length,   length);
+    ASSERT_EQ(this->m_array.m_capacity, capacity);
+    for (Size i = 0; i < length; i++)
+        ASSERT_EQ(this->m_array.m_buffer[i], this->m_vector[i]);
+
+    this->m_array.truncate(length + 1);
+    ASSERT_EQ(this->m_array.m_length, length);
+});}
+
 TYPED_TEST(ArrayTest, copyAssignementOperator) { this->test([this]() 
 {
     using Array   = Array<TypeParam>;
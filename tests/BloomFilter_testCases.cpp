@@ -0,0 +1,118 @@
+/*
+ * ---------------------------------------------------
+ * BloomFilter_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 00:15:24
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <utility>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/BloomFilter.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::BloomFilter;
+
+TEST(BloomFilterTest, noFalseNegative)
+{
+    BloomFilter<int> filter(10000);
+    for (int i = 0; i < 10000; i++)
+        filter.insert(i * 7);
+    EXPECT_EQ(filter.size(), 10000);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_TRUE(filter.mayContain(i * 7));
+}
+
+TEST(BloomFilterTest, falsePositiveRate)
+{
+    BloomFilter<int> filter(10000, 0.01);
+    for (int i = 0; i < 10000; i++)
+        filter.insert(i);
+    int falsePositives = 0;
+    for (int i = 10000; i < 110000; i++)
+        falsePositives += filter.mayContain(i) ? 1 : 0;
+    EXPECT_LT(falsePositives, 2000); // 1% expected, the blocked layout costs a little
+}
+
+TEST(BloomFilterTest, bulkBuild)
+{
+    utils::Array<utils::String> keys = { "one", "two", "three", "four", "five" };
+    BloomFilter<utils::String> filter(keys);
+    EXPECT_EQ(filter.size(), 5);
+    for (const utils::String& key : keys)
+        EXPECT_TRUE(filter.mayContain(key));
+    EXPECT_TRUE(filter.mayContain("three"));
+
+    utils::Array<int> values;
+    for (int i = 0; i < 1000; i++)
+        values.append(i * 3);
+    BloomFilter<int> intFilter(values, 0.001);
+    for (int i = 0; i < 1000; i++)
+        EXPECT_TRUE(intFilter.mayContain(i * 3));
+}
+
+TEST(BloomFilterTest, clearReset)
+{
+    BloomFilter<int> filter(100);
+    filter.insert(42);
+    filter.clear();
+    EXPECT_TRUE(filter.isEmpty());
+    EXPECT_FALSE(filter.mayContain(42));
+
+    filter.insert(42);
+    filter.reset(100000);
+    EXPECT_EQ(filter.capacity(), 100000);
+    EXPECT_FALSE(filter.mayContain(42));
+    filter.insert(42);
+    EXPECT_TRUE(filter.mayContain(42));
+}
+
+TEST(BloomFilterTest, copyMove)
+{
+    BloomFilter<int> filter(100);
+    filter.insert(1);
+
+    BloomFilter<int> copy(filter);
+    copy.insert(2);
+    EXPECT_TRUE(copy.mayContain(1));
+    EXPECT_EQ(filter.size(), 1);
+
+    BloomFilter<int> moved(std::move(copy));
+    EXPECT_TRUE(moved.mayContain(1));
+    EXPECT_TRUE(moved.mayContain(2));
+
+    filter = moved;
+    EXPECT_TRUE(filter.mayContain(2));
+    EXPECT_EQ(filter.size(), 2);
+}
+
+TEST(BloomFilterTest, movedFrom)
+{
+    BloomFilter<int> filter(100);
+    filter.insert(1);
+    BloomFilter<int> moved(std::move(filter));
+
+    EXPECT_EQ(filter.capacity(), 0);
+    EXPECT_TRUE(filter.isEmpty());
+    EXPECT_FALSE(filter.mayContain(1));
+    filter.clear();
+    BloomFilter<int> copy(filter);
+    EXPECT_FALSE(copy.mayContain(1));
+
+    filter.insert(2);
+    EXPECT_TRUE(filter.mayContain(2));
+    copy = std::move(moved);
+    int keys[] = { 3, 4 };
+    moved.insertMany(keys, 2);
+    EXPECT_TRUE(moved.mayContain(3));
+    EXPECT_TRUE(moved.mayContain(4));
+    EXPECT_TRUE(copy.mayContain(1));
+}
+
+}
@@ -0,0 +1,152 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentCache_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 20:37:50
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "UtilsCPP/ConcurrentCache.hpp"
+#include "UtilsCPP/LfuCache.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::ConcurrentCache;
+
+TEST(ConcurrentCacheTest, getPut)
+{
+    ConcurrentCache<utils::String, int> cache(64, 4);
+    EXPECT_EQ(cache.shardCount(), 4);
+    EXPECT_TRUE(cache.isEmpty());
+
+    cache.put("one", 1);
+    cache.put("two", 2);
+    int val = 0;
+    EXPECT_TRUE(cache.tryGet("one", val));
+    EXPECT_EQ(val, 1);
+    EXPECT_FALSE(cache.tryGet("three", val));
+    EXPECT_TRUE(cache.contain("two"));
+    EXPECT_EQ(cache.size(), 2);
+
+    EXPECT_TRUE(cache.remove("one"));
+    EXPECT_FALSE(cache.remove("one"));
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+
+    cache.clear();
+    EXPECT_TRUE(cache.isEmpty());
+}
+
+TEST(ConcurrentCacheTest, capacityIsSplitBetweenShards)
+{
+    ConcurrentCache<int, int, utils::Hash<int>, utils::LfuCache<int, int>> cache(64, 8);
+    std::atomic<int> evicted(0);
+    cache.setEvictionCallback([&](const int&, int&) { evicted++; });
+    for (int i = 0; i < 1000; i++)
+        cache.put(i, i);
+    EXPECT_LE(cache.size(), 64);
+    EXPECT_EQ(cache.size() + (utils::uint64)evicted.load(), 1000);
+    EXPECT_EQ(cache.stats().evictions, (utils::uint64)evicted.load());
+}
+
+TEST(ConcurrentCacheTest, totalNeverExceedsCapacity)
+{
+    for (utils::uint64 capacity : { 1, 3, 10, 17, 100 })
+    {
+        ConcurrentCache<int, int> cache(capacity);
+        EXPECT_LE(cache.shardCount(), capacity);
+        EXPECT_EQ(cache.capacity(), capacity);
+        for (int i = 0; i < 1000; i++)
+        {
+            cache.put(i, i);
+            ASSERT_LE(cache.size(), capacity);
+        }
+    }
+
+    ConcurrentCache<int, int> weighted(10, 4, [](const int&, const int& val) -> utils::uint64 { return (utils::uint64)val; });
+    EXPECT_EQ(weighted.capacity(), 10);
+    for (int i = 0; i < 1000; i++)
+        weighted.put(i, 1 + i % 3);
+    EXPECT_LE(weighted.size(), 10);
+
+    ConcurrentCache<int, int> empty(0);
+    EXPECT_EQ(empty.shardCount(), 1);
+    empty.put(1, 1);
+    EXPECT_TRUE(empty.isEmpty());
+}
+
+namespace
+{
+
+// no utils::Hash specialization, only a custom hasher counting its calls
+struct Point
+{
+    int x;
+    int y;
+
+    inline bool operator == (const Point& rhs) const { return x == rhs.x && y == rhs.y; }
+};
+
+struct PointHash
+{
+    std::atomic<int>* calls = nullptr;
+
+    inline utils::uint64 operator () (const Point& point) const
+    {
+        if (calls != nullptr)
+            (*calls)++;
+        return utils::hashValues(0, point.x, point.y);
+    }
+};
+
+}
+
+TEST(ConcurrentCacheTest, customHash)
+{
+    std::atomic<int> calls(0);
+    ConcurrentCache<Point, int, PointHash> cache(64, 4, ConcurrentCache<Point, int, PointHash>::Weigher(), PointHash{&calls});
+    cache.put(Point{1, 2}, 3);
+    int val = 0;
+    EXPECT_TRUE(cache.tryGet(Point{1, 2}, val));
+    EXPECT_EQ(val, 3);
+    EXPECT_FALSE(cache.contain(Point{2, 1}));
+    EXPECT_GT(calls.load(), 3); // the shard caches use the given hash too
+}
+
+TEST(ConcurrentCacheTest, concurrentAccess)
+{
+    ConcurrentCache<int, int> cache(256);
+    std::vector<std::thread> threads;
+    std::atomic<int> wrongValues(0);
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 20000; i++)
+            {
+                int key = (i * 7 + t) % 512;
+                int val = 0;
+                if (cache.tryGet(key, val))
+                {
+                    if (val != key * 2)
+                        wrongValues++;
+                }
+                else
+                    cache.put(key, key * 2);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(wrongValues.load(), 0);
+    EXPECT_LE(cache.size(), 256);
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentDictionary_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 15:02:44
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "UtilsCPP/ConcurrentDictionary.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::ConcurrentDictionary;
+
+TEST(ConcurrentDictionaryTest, insertGet)
+{
+    ConcurrentDictionary<utils::String, int> dict;
+    EXPECT_TRUE(dict.insert("one", 1));
+    EXPECT_TRUE(dict.insert("two", 2));
+    EXPECT_FALSE(dict.insert("one", 10));
+
+    int val = 0;
+    EXPECT_TRUE(dict.tryGet("one", val));
+    EXPECT_EQ(val, 1);
+    EXPECT_FALSE(dict.tryGet("three", val));
+    EXPECT_EQ(val, 1);
+
+    EXPECT_TRUE(dict.remove("one"));
+    EXPECT_FALSE(dict.contain("one"));
+    EXPECT_EQ(dict.size(), 1);
+    EXPECT_EQ(dict.find("two")->val, 2);
+}
+
+TEST(ConcurrentDictionaryTest, iterateRange)
+{
+    ConcurrentDictionary<int, int> dict;
+    for (int i = 0; i < 10; i++)
+        dict.insert(i, i * i);
+
+    int expected = 3;
+    for (const auto& pair : dict.iterateRange(3, 6))
+    {
+        EXPECT_EQ(pair.key, expected);
+        EXPECT_EQ(pair.val, expected * expected);
+        expected++;
+    }
+    EXPECT_EQ(expected, 6);
+}
+
+TEST(ConcurrentDictionaryTest, threads)
+{
+    constexpr int threadCount = 4;
+    constexpr int perThread = 1000;
+
+    ConcurrentDictionary<int, int> dict;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&dict, t]() {
+            for (int i = 0; i < perThread; i++)
+                dict.insert(i * threadCount + t, t);
+            for (int i = 0; i < perThread * threadCount; i++)
+            {
+                int val = -1;
+                if (dict.tryGet(i, val))
+                {
+                    EXPECT_EQ(val, i % threadCount);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(dict.size(), threadCount * perThread);
+}
+
+}
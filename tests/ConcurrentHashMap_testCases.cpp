@@ -0,0 +1,155 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentHashMap_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 19:05:48
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "UtilsCPP/ConcurrentHashMap.hpp"
+#include "UtilsCPP/Epoch.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::ConcurrentHashMap;
+
+TEST(ConcurrentHashMapTest, insertGet)
+{
+    ConcurrentHashMap<utils::String, int> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_TRUE(map.insert("one", 1));
+    EXPECT_TRUE(map.insert("two", 2));
+    EXPECT_FALSE(map.insert("one", 10));
+    EXPECT_EQ(map.size(), 2);
+
+    int val = 0;
+    EXPECT_TRUE(map.tryGet("one", val));
+    EXPECT_EQ(val, 1);
+    EXPECT_FALSE(map.tryGet("three", val));
+    EXPECT_TRUE(map.contain("two"));
+
+    map.insertOrAssign("one", 11);
+    map.insertOrAssign("three", 3);
+    EXPECT_TRUE(map.tryGet("one", val));
+    EXPECT_EQ(val, 11);
+    EXPECT_EQ(map.size(), 3);
+
+    EXPECT_TRUE(map.remove("one"));
+    EXPECT_FALSE(map.remove("one"));
+    EXPECT_FALSE(map.contain("one"));
+    EXPECT_EQ(map.size(), 2);
+}
+
+TEST(ConcurrentHashMapTest, grow)
+{
+    ConcurrentHashMap<int, int> map(4);
+    EXPECT_EQ(map.shardCount(), 4);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_TRUE(map.insert(i, i * 3));
+    EXPECT_EQ(map.size(), 10000);
+    for (int i = 0; i < 10000; i++)
+    {
+        int val = -1;
+        EXPECT_TRUE(map.tryGet(i, val));
+        EXPECT_EQ(val, i * 3);
+    }
+
+    int count = 0;
+    map.forEach([&](const ConcurrentHashMap<int, int>::KeyValPair& pair) {
+        EXPECT_EQ(pair.val, pair.key * 3);
+        count++;
+    });
+    EXPECT_EQ(count, 10000);
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contain(5));
+}
+
+TEST(ConcurrentHashMapTest, getOrInsertUpdate)
+{
+    ConcurrentHashMap<int, int> map;
+    int calls = 0;
+    EXPECT_EQ(map.getOrInsert(1, [&]() { calls++; return 10; }), 10);
+    EXPECT_EQ(map.getOrInsert(1, [&]() { calls++; return 20; }), 10);
+    EXPECT_EQ(calls, 1);
+
+    EXPECT_TRUE(map.update(1, [](int val) { return val + 5; }));
+    EXPECT_FALSE(map.update(2, [](int val) { return val + 5; }));
+    int val = 0;
+    EXPECT_TRUE(map.tryGet(1, val));
+    EXPECT_EQ(val, 15);
+}
+
+TEST(ConcurrentHashMapTest, concurrentCounters)
+{
+    constexpr int threadCount = 4;
+    constexpr int increments = 5000;
+
+    ConcurrentHashMap<int, int> map;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&map]() {
+            for (int i = 0; i < increments; i++)
+            {
+                int key = i % 100;
+                map.getOrInsert(key, []() { return 0; });
+                map.update(key, [](int val) { return val + 1; });
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(map.size(), 100);
+    int total = 0;
+    map.forEach([&](const ConcurrentHashMap<int, int>::KeyValPair& pair) { total += pair.val; });
+    EXPECT_EQ(total, threadCount * increments);
+}
+
+TEST(ConcurrentHashMapTest, readersDuringWrites)
+{
+    ConcurrentHashMap<int, utils::String> map(8);
+    for (int i = 0; i < 1000; i++)
+        map.insert(i, utils::String::fromUInt(i));
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; t++)
+    {
+        readers.emplace_back([&]() {
+            while (stop.load() == false)
+            {
+                for (int i = 0; i < 1000; i++)
+                {
+                    utils::String val;
+                    EXPECT_TRUE(map.tryGet(i, val));
+                    EXPECT_EQ(val, utils::String::fromUInt(i));
+                }
+            }
+        });
+    }
+    // grows the shards and replaces values while readers look up the first keys
+    for (int i = 1000; i < 20000; i++)
+        map.insert(i, utils::String::fromUInt(i));
+    for (int i = 0; i < 1000; i++)
+        map.insertOrAssign(i, utils::String::fromUInt(i));
+    for (int i = 1000; i < 20000; i++)
+        map.remove(i);
+    stop.store(true);
+    for (auto& thread : readers)
+        thread.join();
+
+    EXPECT_EQ(map.size(), 1000);
+}
+
+}
@@ -0,0 +1,221 @@
+/*
+ * ---------------------------------------------------
+ * ConcurrentSet_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 14:45:19
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "UtilsCPP/ConcurrentSet.hpp"
+#include "UtilsCPP/Epoch.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::ConcurrentSet;
+using utils::Epoch;
+
+struct Tracked
+{
+    static std::atomic<int> s_alive;
+
+    int value;
+
+    Tracked(int v) : value(v) { s_alive++; }
+    Tracked(const Tracked& cp) : value(cp.value) { s_alive++; }
+    ~Tracked() { s_alive--; }
+
+    inline bool operator == (const Tracked& rhs) const { return value == rhs.value; }
+    inline bool operator  < (const Tracked& rhs) const { return value  < rhs.value; }
+};
+
+std::atomic<int> Tracked::s_alive(0);
+
+TEST(ConcurrentSetTest, insertRemove)
+{
+    ConcurrentSet<int> set;
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(2));
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contain(2));
+    EXPECT_FALSE(set.contain(4));
+
+    EXPECT_TRUE(set.remove(2));
+    EXPECT_FALSE(set.remove(2));
+    EXPECT_FALSE(set.contain(2));
+    EXPECT_EQ(set.size(), 2);
+
+    int expected[] = { 1, 3 };
+    int i = 0;
+    for (int element : set)
+        EXPECT_EQ(element, expected[i++]);
+    EXPECT_EQ(i, 2);
+}
+
+TEST(ConcurrentSetTest, order)
+{
+    ConcurrentSet<int> set;
+    for (int i = 0; i < 1000; i++)
+        set.insert((i * 7919) % 1000);
+
+    int expected = 0;
+    for (int element : set)
+        EXPECT_EQ(element, expected++);
+    EXPECT_EQ(expected, 1000);
+
+    EXPECT_EQ(*set.lowerBound(500), 500);
+    EXPECT_EQ(*set.find(999), 999);
+    EXPECT_EQ(set.find(1000), set.end());
+    EXPECT_EQ(set.lowerBound(1000), set.end());
+}
+
+TEST(ConcurrentSetTest, iterateRange)
+{
+    ConcurrentSet<int> set = { 1, 3, 5, 7, 9 };
+
+    int expected[] = { 3, 5, 7 };
+    int i = 0;
+    for (int element : set.iterateRange(2, 9))
+        EXPECT_EQ(element, expected[i++]);
+    EXPECT_EQ(i, 3);
+
+    auto empty = set.iterateRange(10, 20);
+    EXPECT_EQ(empty.begin(), empty.end());
+    auto empty2 = set.iterateRange(4, 5);
+    EXPECT_EQ(empty2.begin(), empty2.end());
+}
+
+TEST(ConcurrentSetTest, string)
+{
+    ConcurrentSet<utils::String> set;
+    set.insert("banana");
+    set.insert("apple");
+    set.insert("cherry");
+
+    EXPECT_TRUE(set.contain("apple"));
+    EXPECT_TRUE(set.remove("banana"));
+    EXPECT_EQ(*set.begin(), utils::String("apple"));
+    EXPECT_EQ(*++set.begin(), utils::String("cherry"));
+}
+
+TEST(ConcurrentSetTest, clear)
+{
+    ConcurrentSet<int> set = { 1, 2, 3, 4 };
+    set.clear();
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_EQ(set.size(), 0);
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_TRUE(set.contain(2));
+}
+
+TEST(ConcurrentSetTest, reclamation)
+{
+    {
+        ConcurrentSet<Tracked> set;
+        for (int i = 0; i < 500; i++)
+            set.insert(Tracked(i));
+        for (int i = 0; i < 500; i += 2)
+            set.remove(Tracked(i));
+        EXPECT_EQ(set.size(), 250);
+    }
+    Epoch::collect();
+    EXPECT_EQ(Tracked::s_alive, 0);
+}
+
+TEST(ConcurrentSetTest, removedElementStaysReadable)
+{
+    ConcurrentSet<Tracked> set;
+    set.insert(Tracked(1));
+    set.insert(Tracked(2));
+    {
+        ConcurrentSet<Tracked>::Iterator it = set.begin();
+        EXPECT_TRUE(set.remove(Tracked(1)));
+        Epoch::collect(); // can not delete the node, the iterator still holds a guard
+        EXPECT_EQ(it->value, 1);
+        ++it;
+        EXPECT_EQ(it->value, 2);
+    }
+    Epoch::collect();
+    EXPECT_EQ(Tracked::s_alive, 1);
+}
+
+TEST(ConcurrentSetTest, threads)
+{
+    constexpr int threadCount = 4;
+    constexpr int perThread = 2000;
+
+    ConcurrentSet<int> set;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&set, t]() {
+            for (int i = 0; i < perThread; i++)
+                EXPECT_TRUE(set.insert(i * threadCount + t));
+            for (int i = 0; i < perThread; i += 2)
+                EXPECT_TRUE(set.remove(i * threadCount + t));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(set.size(), threadCount * perThread / 2);
+    int count = 0;
+    int last = -1;
+    for (int element : set)
+    {
+        EXPECT_LT(last, element);
+        EXPECT_EQ((element / threadCount) % 2, 1);
+        last = element;
+        count++;
+    }
+    EXPECT_EQ(count, threadCount * perThread / 2);
+}
+
+TEST(ConcurrentSetTest, contendedKeys)
+{
+    constexpr int threadCount = 4;
+
+    ConcurrentSet<int> set;
+    std::atomic<int> inserted(0);
+    std::atomic<int> removed(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&]() {
+            for (int round = 0; round < 2000; round++)
+            {
+                int key = round % 64;
+                if (set.insert(key))
+                    inserted++;
+                if (set.remove(key))
+                    removed++;
+                for (int element : set.iterateRange(key, key + 8))
+                    EXPECT_GE(element, key);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    int remaining = 0;
+    for (int element : set)
+    {
+        (void)element;
+        remaining++;
+    }
+    EXPECT_EQ(inserted - removed, remaining);
+    EXPECT_EQ(set.size(), (utils::uint64)remaining);
+}
+
+}
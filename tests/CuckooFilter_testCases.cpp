@@ -0,0 +1,123 @@
+/*
+ * ---------------------------------------------------
+ * CuckooFilter_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 00:22:51
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <utility>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/CuckooFilter.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::CuckooFilter;
+
+TEST(CuckooFilterTest, insertRemove)
+{
+    CuckooFilter<int> filter(10000);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_TRUE(filter.insert(i));
+    EXPECT_EQ(filter.size(), 10000);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_TRUE(filter.mayContain(i));
+
+    for (int i = 0; i < 10000; i += 2)
+        EXPECT_TRUE(filter.remove(i));
+    EXPECT_EQ(filter.size(), 5000);
+    for (int i = 1; i < 10000; i += 2)
+        EXPECT_TRUE(filter.mayContain(i));
+    int falsePositives = 0;
+    for (int i = 0; i < 10000; i += 2)
+        falsePositives += filter.mayContain(i) ? 1 : 0;
+    EXPECT_LT(falsePositives, 50);
+}
+
+TEST(CuckooFilterTest, falsePositiveRate)
+{
+    CuckooFilter<int> filter(10000);
+    for (int i = 0; i < 10000; i++)
+        filter.insert(i);
+    int falsePositives = 0;
+    for (int i = 10000; i < 110000; i++)
+        falsePositives += filter.mayContain(i) ? 1 : 0;
+    EXPECT_LT(falsePositives, 100);
+}
+
+TEST(CuckooFilterTest, full)
+{
+    CuckooFilter<int> filter(64);
+    int inserted = 0;
+    while (filter.insert(inserted))
+        inserted++;
+    EXPECT_GE(inserted, 60);
+    EXPECT_EQ(filter.size(), (CuckooFilter<int>::Size)inserted);
+    for (int i = 0; i < inserted; i++)
+        EXPECT_TRUE(filter.mayContain(i)); // the last one kicked out is kept aside
+    EXPECT_FALSE(filter.insert(inserted + 1));
+
+    for (int i = 0; i < inserted; i++)
+        EXPECT_TRUE(filter.remove(i));
+    EXPECT_TRUE(filter.isEmpty());
+    EXPECT_TRUE(filter.insert(0));
+}
+
+TEST(CuckooFilterTest, duplicates)
+{
+    CuckooFilter<utils::String> filter(16);
+    filter.insert("key");
+    filter.insert("key");
+    EXPECT_TRUE(filter.remove("key"));
+    EXPECT_TRUE(filter.mayContain("key"));
+    EXPECT_TRUE(filter.remove("key"));
+    EXPECT_FALSE(filter.mayContain("key"));
+    EXPECT_FALSE(filter.remove("key"));
+}
+
+TEST(CuckooFilterTest, bulkBuildCopy)
+{
+    utils::Array<utils::String> keys = { "alpha", "beta", "gamma" };
+    CuckooFilter<utils::String> filter(keys);
+    for (const utils::String& key : keys)
+        EXPECT_TRUE(filter.mayContain(key));
+
+    CuckooFilter<utils::String> copy(filter);
+    copy.remove("beta");
+    EXPECT_TRUE(filter.mayContain("beta"));
+    EXPECT_FALSE(copy.mayContain("beta"));
+
+    filter = std::move(copy);
+    EXPECT_EQ(filter.size(), 2);
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain("alpha"));
+}
+
+TEST(CuckooFilterTest, movedFrom)
+{
+    CuckooFilter<int> filter(100);
+    filter.insert(1);
+    CuckooFilter<int> moved(std::move(filter));
+
+    EXPECT_EQ(filter.capacity(), 0);
+    EXPECT_EQ(filter.loadFactor(), 0.0);
+    EXPECT_TRUE(filter.isEmpty());
+    EXPECT_FALSE(filter.mayContain(1));
+    EXPECT_FALSE(filter.remove(1));
+    filter.clear();
+    CuckooFilter<int> copy(filter);
+    EXPECT_FALSE(copy.mayContain(1));
+
+    EXPECT_TRUE(filter.insert(2));
+    EXPECT_TRUE(filter.mayContain(2));
+    copy = std::move(moved);
+    EXPECT_FALSE(moved.mayContain(1));
+    EXPECT_TRUE(copy.mayContain(1));
+}
+
+}
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/String.hpp"
 
 namespace utils_tests
 {
@@ -56,4 +57,210 @@ TEST_F(DictionaryTest, access)
     EXPECT_THROW({ dic["33"]; }, KeyNoFoundError);
 }
 
-}
\ No newline at end of file
+TEST_F(DictionaryTest, heterogeneousLookup)
+{
+    Dictionary<utils::String, int> dic;
+
+    dic.insert("apple", 1);
+    dic.insert("banana", 2);
+    dic.insert("cherry", 3);
+
+    EXPECT_TRUE(dic.contain("banana"));
+    EXPECT_FALSE(dic.contain("banan"));
+    EXPECT_FALSE(dic.contain("bananas"));
+    EXPECT_EQ(dic["cherry"], 3);
+    EXPECT_EQ(dic.find("apple")->val, 1);
+    EXPECT_EQ(dic.find("durian"), dic.end());
+
+    dic.remove("apple");
+    EXPECT_FALSE(dic.contain(utils::String("apple")));
+}
+
+struct CaseInsensitive
+{
+    static char lower(char c) { return c >= 'A' && c <= 'Z' ? (char)(c - 'A' + 'a') : c; }
+
+    int operator () (const std::string& a, const std::string& b) const
+    {
+        std::string::size_type i = 0;
+        for (; i < a.size() && i < b.size(); i++)
+        {
+            if (lower(a[i]) != lower(b[i]))
+                return lower(a[i]) < lower(b[i]) ? -1 : 1;
+        }
+        return a.size() == b.size() ? 0 : (a.size() < b.size() ? -1 : 1);
+    }
+};
+
+TEST_F(DictionaryTest, customCompare)
+{
+    Dictionary<std::string, int, CaseInsensitive> dic;
+
+    dic.insert("Hello", 1);
+    EXPECT_TRUE(dic.contain(std::string("HELLO")));
+    EXPECT_EQ(dic[std::string("hello")], 1);
+    using DuplicateElementError = Dictionary<std::string, int, CaseInsensitive>::DataStructure::DuplicateElementError;
+
+    EXPECT_THROW({ dic.insert("hELLO", 2); }, DuplicateElementError);
+}
+
+TEST_F(DictionaryTest, rangeQueries)
+{
+    Dictionary<int, std::string> dic;
+    for (int i = 0; i < 10; i++)
+        dic.insert(i * 10, std::to_string(i));
+
+    std::string values;
+    for (auto& entry : dic.iterateRange(25, 60))
+        values += entry.val;
+    EXPECT_EQ(values, "345");
+
+    EXPECT_EQ(dic.lowerBound(30)->key, 30);
+    EXPECT_EQ(dic.upperBound(30)->key, 40);
+    EXPECT_EQ(dic.rbegin()->key, 90);
+}
+
+struct CopyCounter
+{
+    static int s_copies;
+
+    int value;
+
+    CopyCounter(int v) : value(v) {}
+    CopyCounter(const CopyCounter& cp) : value(cp.value) { s_copies++; }
+    CopyCounter(CopyCounter&& mv) noexcept : value(mv.value) {}
+
+    CopyCounter& operator = (const CopyCounter& cp) { value = cp.value; s_copies++; return *this; }
+    CopyCounter& operator = (CopyCounter&& mv) noexcept { value = mv.value; return *this; }
+
+    inline bool operator == (const CopyCounter& rhs) const { return value == rhs.value; }
+    inline bool operator  < (const CopyCounter& rhs) const { return value  < rhs.value; }
+};
+
+int CopyCounter::s_copies = 0;
+
+TEST_F(DictionaryTest, tryEmplace)
+{
+    Dictionary<utils::String, std::string> dic;
+
+    auto result = dic.tryEmplace("a", 3, 'x');
+    EXPECT_TRUE(result.inserted);
+    EXPECT_EQ(result.iterator->val, "xxx");
+
+    result = dic.tryEmplace("a", "other");
+    EXPECT_FALSE(result.inserted);
+    EXPECT_EQ(result.iterator->val, "xxx");
+    EXPECT_EQ(dic.size(), 1);
+}
+
+TEST_F(DictionaryTest, insertOrAssign)
+{
+    Dictionary<int, std::string> dic;
+
+    EXPECT_TRUE(dic.insertOrAssign(1, "one").inserted);
+    EXPECT_FALSE(dic.insertOrAssign(1, "uno").inserted);
+    EXPECT_EQ(dic[1], "uno");
+    EXPECT_EQ(dic.size(), 1);
+}
+
+TEST_F(DictionaryTest, getOrInsert)
+{
+    Dictionary<utils::String, int> counts;
+    const char* words[] = { "a", "b", "a", "c", "a", "b" };
+    for (const char* word : words)
+        counts.getOrInsert(word, []() { return 0; })++;
+
+    EXPECT_EQ(counts["a"], 3);
+    EXPECT_EQ(counts["b"], 2);
+    EXPECT_EQ(counts["c"], 1);
+    EXPECT_EQ(counts.size(), 3);
+}
+
+TEST_F(DictionaryTest, update)
+{
+    Dictionary<int, int> dic;
+    dic.insert(1, 10);
+
+    EXPECT_TRUE(dic.update(1, [](int& val) { val *= 2; }));
+    EXPECT_FALSE(dic.update(2, [](int& val) { val *= 2; }));
+    EXPECT_EQ(dic[1], 20);
+    EXPECT_FALSE(dic.contain(2));
+}
+
+TEST_F(DictionaryTest, upsertMovesKeys)
+{
+    Dictionary<CopyCounter, int> dic;
+    CopyCounter::s_copies = 0;
+
+    dic.tryEmplace(CopyCounter(1), 1);
+    dic.insertOrAssign(CopyCounter(2), 2);
+    dic.getOrInsert(CopyCounter(3), []() { return 3; });
+    EXPECT_EQ(CopyCounter::s_copies, 0);
+
+    CopyCounter existing(1);
+    dic.tryEmplace(existing, 10);
+    dic.insertOrAssign(existing, 10);
+    dic.getOrInsert(existing, []() { return 10; });
+    EXPECT_EQ(CopyCounter::s_copies, 0);
+    EXPECT_EQ(dic[1], 10);
+    EXPECT_EQ(dic.size(), 3);
+}
+
+TEST_F(DictionaryTest, nodeHandles)
+{
+    Dictionary<utils::String, int> hot;
+    Dictionary<utils::String, int> cold;
+    hot.insert("a", 1);
+    hot.insert("b", 2);
+
+    auto handle = hot.extract("a");
+    EXPECT_EQ(handle.value().key, utils::String("a"));
+    handle.value().val = 10;
+    cold.insert(std::move(handle));
+
+    EXPECT_FALSE(hot.contain("a"));
+    EXPECT_EQ(cold["a"], 10);
+    EXPECT_TRUE(hot.extract("missing").isEmpty());
+}
+
+TEST_F(DictionaryTest, merge)
+{
+    Dictionary<int, int> a;
+    Dictionary<int, int> b;
+    a.insert(1, 1);
+    a.insert(2, 2);
+    b.insert(2, 20);
+    b.insert(3, 30);
+
+    a.merge(b);
+
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(a[2], 2);
+    EXPECT_EQ(a[3], 30);
+    EXPECT_EQ(b.size(), 1);
+    EXPECT_EQ(b[2], 20);
+}
+
+TEST_F(DictionaryTest, findMany)
+{
+    Dictionary<utils::String, int> dictionary;
+    dictionary.insert("one", 1);
+    dictionary.insert("two", 2);
+    dictionary.insert("three", 3);
+
+    const char* keys[] = { "two", "four", "one", "three", "zero" };
+    Dictionary<utils::String, int>::Iterator found[5];
+    bool contained[5];
+    dictionary.findMany(keys, 5, found);
+    dictionary.containMany(keys, 5, contained);
+
+    EXPECT_EQ(found[0]->val, 2);
+    EXPECT_EQ(found[1], dictionary.end());
+    EXPECT_EQ(found[2]->val, 1);
+    EXPECT_EQ(found[3]->val, 3);
+    EXPECT_EQ(found[4], dictionary.end());
+    bool expected[] = { true, false, true, true, false };
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(contained[i], expected[i]);
+}
+}
@@ -0,0 +1,156 @@
+/*
+ * ---------------------------------------------------
+ * FilteredSet_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 00:31:08
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/CuckooFilter.hpp"
+#include "UtilsCPP/FilteredDictionary.hpp"
+#include "UtilsCPP/FilteredSet.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+template<typename Filter>
+void checkFilteredSet()
+{
+    utils::FilteredSet<int, Filter> set;
+    std::set<int> expected;
+    for (int i = 0; i < 5000; i++)
+    {
+        int value = random<int>(0, 2000);
+        if (random<int>(0, 2) != 0)
+        {
+            if (set.contain(value) == false)
+                set.insert(value);
+            expected.insert(value);
+        }
+        else
+        {
+            set.remove(value);
+            expected.erase(value);
+        }
+        ASSERT_EQ(set.size(), expected.size());
+    }
+    for (int i = 0; i <= 2000; i++)
+        EXPECT_EQ(set.contain(i), expected.count(i) == 1);
+}
+
+TEST(FilteredSetTest, bloomSync)
+{
+    checkFilteredSet<utils::BloomFilter<int>>();
+}
+
+TEST(FilteredSetTest, cuckooSync)
+{
+    checkFilteredSet<utils::CuckooFilter<int>>();
+}
+
+template<typename Filter>
+void checkMovedFromFilteredSet()
+{
+    utils::FilteredSet<int, Filter> set;
+    set.insert(1);
+    utils::FilteredSet<int, Filter> moved(std::move(set));
+    EXPECT_TRUE(moved.contain(1));
+
+    EXPECT_FALSE(set.contain(1));
+    EXPECT_EQ(set.find(1), set.end());
+    set.insert(2);
+    EXPECT_TRUE(set.contain(2));
+
+    set = std::move(moved);
+    EXPECT_FALSE(moved.contain(1));
+    moved.clear();
+    moved.insert(3);
+    EXPECT_TRUE(moved.contain(3));
+    EXPECT_TRUE(set.contain(1));
+}
+
+TEST(FilteredSetTest, movedFrom)
+{
+    checkMovedFromFilteredSet<utils::BloomFilter<int>>();
+    checkMovedFromFilteredSet<utils::CuckooFilter<int>>();
+}
+
+TEST(FilteredSetTest, bulkBuild)
+{
+    utils::FilteredSet<utils::String> set(utils::Array<utils::String>{ "one", "two", "three" });
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contain("two"));
+    EXPECT_FALSE(set.contain("four"));
+    EXPECT_EQ(set.find("four"), set.end());
+    EXPECT_EQ(*set.find("one"), utils::String("one"));
+}
+
+TEST(FilteredDictionaryTest, sync)
+{
+    using Dictionary = utils::FilteredDictionary<int, int, utils::CuckooFilter<int>>;
+    using KeyNoFoundError = Dictionary::Container::KeyNoFoundError;
+
+    Dictionary dictionary;
+    for (int i = 0; i < 1000; i++)
+        dictionary.insert(i, i * 2);
+    EXPECT_EQ(dictionary.size(), 1000);
+    EXPECT_EQ(dictionary[500], 1000);
+    for (int i = 0; i < 1000; i += 2)
+        dictionary.remove(i);
+    for (int i = 0; i < 1000; i++)
+        EXPECT_EQ(dictionary.contain(i), i % 2 == 1);
+    EXPECT_THROW(dictionary[0], KeyNoFoundError);
+    EXPECT_EQ(dictionary.find(2), dictionary.end());
+    EXPECT_EQ(dictionary.find(3)->val, 6);
+}
+
+template<typename Filter>
+void checkMovedFromFilteredDictionary()
+{
+    utils::FilteredDictionary<int, int, Filter> dictionary;
+    dictionary.insert(1, 10);
+    utils::FilteredDictionary<int, int, Filter> moved(std::move(dictionary));
+    EXPECT_EQ(moved[1], 10);
+
+    EXPECT_FALSE(dictionary.contain(1));
+    EXPECT_EQ(dictionary.find(1), dictionary.end());
+    dictionary.insert(2, 20);
+    EXPECT_TRUE(dictionary.contain(2));
+
+    dictionary = std::move(moved);
+    EXPECT_FALSE(moved.contain(1));
+    moved.insert(3, 30);
+    EXPECT_TRUE(moved.contain(3));
+    EXPECT_EQ(dictionary[1], 10);
+}
+
+TEST(FilteredDictionaryTest, movedFrom)
+{
+    checkMovedFromFilteredDictionary<utils::BloomFilter<int>>();
+    checkMovedFromFilteredDictionary<utils::CuckooFilter<int>>();
+}
+
+TEST(FilteredDictionaryTest, bloomBulkBuild)
+{
+    using Dictionary = utils::FilteredDictionary<utils::String, int>;
+
+    Dictionary dictionary(utils::Array<Dictionary::KeyValPair>{ { "one", 1 }, { "two", 2 } });
+    EXPECT_EQ(dictionary["two"], 2);
+    EXPECT_FALSE(dictionary.contain("three"));
+    dictionary.insert("three", 3);
+    dictionary.remove("one");
+    EXPECT_TRUE(dictionary.contain("three"));
+    EXPECT_FALSE(dictionary.contain("one"));
+    dictionary.clear();
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_FALSE(dictionary.contain("two"));
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * ---------------------------------------------------
+ * HashMap_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 17:18:02
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::HashMap;
+
+TEST(HashMapTest, insert)
+{
+    HashMap<utils::String, int> map;
+    map.insert("one", 1);
+    map.insert("two", 2);
+
+    using Map = HashMap<utils::String, int>;
+    EXPECT_THROW({ map.insert("one", 3); }, Map::DataStructure::DuplicateElementError);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_TRUE(map.contain("one"));
+    EXPECT_FALSE(map.contain("three"));
+}
+
+TEST(HashMapTest, access)
+{
+    HashMap<int, std::string> map;
+    map.insert(1, "one");
+    map[1] = "uno";
+    EXPECT_EQ(map[1], "uno");
+
+    const HashMap<int, std::string>& constMap = map;
+    EXPECT_EQ(constMap[1], "uno");
+
+    using Map = HashMap<int, std::string>;
+    EXPECT_THROW({ map[2]; }, Map::KeyNoFoundError);
+    EXPECT_THROW({ constMap[2]; }, Map::KeyNoFoundError);
+}
+
+TEST(HashMapTest, remove)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 1000; i++)
+        map.insert(i, i * 2);
+    for (int i = 0; i < 1000; i += 2)
+        EXPECT_TRUE(map.remove(i));
+    map.remove(map.find(1));
+    EXPECT_EQ(map.size(), 499);
+    EXPECT_FALSE(map.contain(1));
+    EXPECT_EQ(map[999], 1998);
+}
+
+TEST(HashMapTest, iterate)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 100; i++)
+        map.insert(i, i);
+
+    int sum = 0;
+    for (auto& pair : map)
+    {
+        EXPECT_EQ(pair.key, pair.val);
+        pair.val *= 2;
+        sum += pair.key;
+    }
+    EXPECT_EQ(sum, 4950);
+    EXPECT_EQ(map[50], 100);
+}
+
+TEST(HashMapTest, findMany)
+{
+    HashMap<utils::String, int> map;
+    map.insert("one", 1);
+    map.insert("two", 2);
+
+    const char* keys[] = { "two", "three", "one" };
+    HashMap<utils::String, int>::const_Iterator found[3];
+    bool contained[3];
+    const HashMap<utils::String, int>& constMap = map;
+    constMap.findMany(keys, 3, found);
+    constMap.containMany(keys, 3, contained);
+
+    EXPECT_EQ(found[0]->val, 2);
+    EXPECT_EQ(found[1], constMap.end());
+    EXPECT_EQ(found[2]->val, 1);
+    EXPECT_TRUE(contained[0]);
+    EXPECT_FALSE(contained[1]);
+    EXPECT_TRUE(contained[2]);
+}
+}
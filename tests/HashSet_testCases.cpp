@@ -0,0 +1,188 @@
+/*
+ * ---------------------------------------------------
+ * HashSet_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 17:05:21
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include "UtilsCPP/HashSet.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::HashSet;
+
+struct CollidingHash
+{
+    inline utils::uint64 operator () (int) const { return 42; }
+};
+
+TEST(HashSetTest, insert)
+{
+    HashSet<int> set;
+    set.insert(3);
+    set.insert(1);
+    set.insert(2);
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contain(2));
+    EXPECT_FALSE(set.contain(4));
+    EXPECT_THROW({ set.insert(2); }, HashSet<int>::DuplicateElementError);
+    EXPECT_EQ(set.size(), 3);
+}
+
+TEST(HashSetTest, emptySet)
+{
+    HashSet<int> set;
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_FALSE(set.contain(1));
+    EXPECT_FALSE(set.remove(1));
+    EXPECT_EQ(set.begin(), set.end());
+    EXPECT_EQ(set.find(1), set.end());
+}
+
+TEST(HashSetTest, grow)
+{
+    HashSet<int> set;
+    for (int i = 0; i < 10000; i++)
+        set.insert(i);
+    EXPECT_EQ(set.size(), 10000);
+    EXPECT_GE(set.capacity(), 10000);
+    for (int i = 0; i < 10000; i++)
+        EXPECT_EQ(*set.find(i), i);
+    EXPECT_FALSE(set.contain(10000));
+
+    int count = 0;
+    for (int element : set)
+    {
+        EXPECT_TRUE(element >= 0 && element < 10000);
+        count++;
+    }
+    EXPECT_EQ(count, 10000);
+}
+
+TEST(HashSetTest, reserve)
+{
+    HashSet<int> set;
+    set.reserve(1000);
+    utils::uint64 capacity = set.capacity();
+    EXPECT_GE(capacity, 1000);
+    for (int i = 0; i < 1000; i++)
+        set.insert(i);
+    EXPECT_EQ(set.capacity(), capacity);
+}
+
+TEST(HashSetTest, remove)
+{
+    HashSet<int> set = { 1, 2, 3, 4 };
+    EXPECT_TRUE(set.remove(2));
+    EXPECT_FALSE(set.remove(2));
+    set.remove(set.find(3));
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_TRUE(set.contain(1));
+    EXPECT_FALSE(set.contain(3));
+    EXPECT_TRUE(set.contain(4));
+}
+
+TEST(HashSetTest, collisions)
+{
+    HashSet<int, CollidingHash> set;
+    for (int i = 0; i < 100; i++)
+        set.insert(i);
+    for (int i = 0; i < 100; i += 2)
+        EXPECT_TRUE(set.remove(i));
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(set.contain(i), i % 2 == 1);
+}
+
+TEST(HashSetTest, tombstoneCleanup)
+{
+    HashSet<int, CollidingHash> set;
+    set.reserve(16);
+    utils::uint64 capacity = set.capacity();
+    // every element probes the same groups so removes leave deleted slots behind
+    for (int round = 0; round < 100; round++)
+    {
+        for (int i = 0; i < 10; i++)
+            set.insert(round * 10 + i);
+        for (int i = 0; i < 10; i++)
+            EXPECT_TRUE(set.remove(round * 10 + i));
+    }
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_EQ(set.capacity(), capacity);
+}
+
+TEST(HashSetTest, randomAgainstStd)
+{
+    HashSet<int> set;
+    std::set<int> reference;
+    for (int i = 0; i < 20000; i++)
+    {
+        int value = random<int>(0, 1999);
+        if (random<int>(0, 2) == 0)
+            EXPECT_EQ(set.remove(value), reference.erase(value) == 1);
+        else if (reference.insert(value).second)
+            set.insert(value);
+    }
+    EXPECT_EQ(set.size(), reference.size());
+    for (int value : reference)
+        EXPECT_TRUE(set.contain(value));
+}
+
+TEST(HashSetTest, string)
+{
+    HashSet<utils::String> set = { "apple", "banana" };
+    EXPECT_TRUE(set.contain("apple"));
+    EXPECT_TRUE(set.contain(utils::String("banana")));
+    EXPECT_FALSE(set.contain("cherry"));
+    EXPECT_TRUE(set.remove("apple"));
+    EXPECT_EQ(set.size(), 1);
+}
+
+TEST(HashSetTest, copyMove)
+{
+    HashSet<utils::String> set = { "a", "b", "c" };
+    HashSet<utils::String> copy = set;
+    EXPECT_EQ(copy, set);
+    copy.remove("a");
+    EXPECT_NE(copy, set);
+
+    HashSet<utils::String> moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 2);
+    copy = moved;
+    EXPECT_EQ(copy, moved);
+}
+
+TEST(HashSetTest, findMany)
+{
+    utils::HashSet<int> set;
+    for (int i = 0; i < 1000; i += 3)
+        set.insert(i);
+
+    int keys[100];
+    for (int i = 0; i < 100; i++)
+        keys[i] = i * 7;
+
+    utils::HashSet<int>::Iterator found[100];
+    bool contained[100];
+    set.findMany(keys, 100, found);
+    set.containMany(keys, 100, contained);
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(found[i], set.find(keys[i]));
+        EXPECT_EQ(contained[i], keys[i] % 3 == 0);
+    }
+
+    utils::HashSet<int> empty;
+    empty.containMany(keys, 20, contained);
+    for (int i = 0; i < 20; i++)
+        EXPECT_FALSE(contained[i]);
+}
+}
@@ -0,0 +1,179 @@
+/*
+ * ---------------------------------------------------
+ * Hash_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 18:02:37
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/Hash.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::Hash;
+using utils::uint64;
+
+struct Point
+{
+    int x;
+    int y;
+
+    inline bool operator == (const Point& rhs) const { return x == rhs.x && y == rhs.y; }
+};
+
+}
+
+namespace utils
+{
+
+template<>
+struct Hash<utils_tests::Point>
+{
+    inline uint64 operator () (const utils_tests::Point& point) const { return hashValues(0, point.x, point.y); }
+};
+
+}
+
+namespace utils_tests
+{
+
+static int bitCount(uint64 value)
+{
+    int count = 0;
+    for (; value != 0; value &= value - 1)
+        count++;
+    return count;
+}
+
+TEST(HashTest, integers)
+{
+    Hash<int> hash;
+    EXPECT_EQ(hash(42), hash(42));
+    EXPECT_NE(hash(42), hash(43));
+
+    std::set<uint64> hashes;
+    for (int i = 0; i < 100000; i++)
+        hashes.insert(hash(i));
+    EXPECT_EQ(hashes.size(), 100000);
+
+    // flipping one input bit flips about half of the output bits
+    double total = 0;
+    for (uint64 i = 0; i < 1000; i++)
+    {
+        for (int bit = 0; bit < 64; bit++)
+            total += bitCount(Hash<uint64>()(i) ^ Hash<uint64>()(i ^ (1UL << bit)));
+    }
+    double average = total / (1000 * 64);
+    EXPECT_GT(average, 30.0);
+    EXPECT_LT(average, 34.0);
+}
+
+TEST(HashTest, bytes)
+{
+    const char data[] = "The quick brown fox jumps over the lazy dog, again and again and again and again.";
+    std::set<uint64> hashes;
+    for (uint64 length = 0; length < sizeof(data); length++)
+    {
+        EXPECT_EQ(utils::hashBytes(data, length), utils::hashBytes(data, length));
+        hashes.insert(utils::hashBytes(data, length));
+    }
+    EXPECT_EQ(hashes.size(), sizeof(data));
+
+    char copy[sizeof(data)];
+    for (uint64 length = 1; length < sizeof(data); length++)
+    {
+        std::memcpy(copy, data, sizeof(data));
+        copy[length - 1] ^= 1;
+        EXPECT_NE(utils::hashBytes(data, length), utils::hashBytes(copy, length));
+    }
+}
+
+TEST(HashTest, wyhashReferenceVectors)
+{
+    // test vectors of the reference wyhash final version 4, the seed is the index
+    const char* messages[] = {
+        "",
+        "a",
+        "abc",
+        "message digest",
+        "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+    };
+    const uint64 expected[] = {
+        0x93228A4DE0EEC5A2ULL,
+        0xC5BAC3DB178713C4ULL,
+        0xA97F2F7B1D9B3314ULL,
+        0x786D1F1DF3801DF4ULL,
+        0xDCA5A8138AD37C87ULL,
+        0xB9E734F117CFAF70ULL,
+        0x6CC5EAB49A92D617ULL
+    };
+    for (uint64 i = 0; i < 7; i++)
+        EXPECT_EQ(utils::hashBytes(messages[i], std::strlen(messages[i]), i), expected[i]) << messages[i];
+}
+
+TEST(HashTest, seed)
+{
+    EXPECT_NE(Hash<int>(1)(42), Hash<int>(2)(42));
+    EXPECT_NE(Hash<utils::String>(1)("key"), Hash<utils::String>(2)("key"));
+    EXPECT_EQ(Hash<utils::String>(7)("key"), Hash<utils::String>(7)("key"));
+
+    utils::HashMap<utils::String, int, Hash<utils::String>> map(Hash<utils::String>(1234));
+    map.insert("key", 1);
+    EXPECT_EQ(map["key"], 1);
+}
+
+TEST(HashTest, string)
+{
+    Hash<utils::String> hash;
+    EXPECT_EQ(hash(utils::String("hello")), hash("hello"));
+    EXPECT_NE(hash("hello"), hash("hellp"));
+    EXPECT_EQ(hash(""), hash(utils::String()));
+}
+
+TEST(HashTest, array)
+{
+    utils::Array<int> a = { 1, 2, 3 };
+    utils::Array<int> b = { 1, 2, 3 };
+    utils::Array<int> c = { 3, 2, 1 };
+    Hash<utils::Array<int>> hash;
+    EXPECT_EQ(hash(a), hash(b));
+    EXPECT_NE(hash(a), hash(c));
+
+    utils::Array<utils::String> strings1 = { "ab", "c" };
+    utils::Array<utils::String> strings2 = { "a", "bc" };
+    Hash<utils::Array<utils::String>> stringsHash;
+    EXPECT_NE(stringsHash(strings1), stringsHash(strings2));
+
+    utils::HashSet<utils::Array<int>> set;
+    set.insert(a);
+    EXPECT_TRUE(set.contain(b));
+    EXPECT_FALSE(set.contain(c));
+}
+
+TEST(HashTest, combine)
+{
+    EXPECT_NE(utils::hashValues(0, 1, 2), utils::hashValues(0, 2, 1));
+    EXPECT_EQ(utils::hashValues(0, 1, 2), utils::hashCombine(utils::hashCombine(0, Hash<int>()(1)), Hash<int>()(2)));
+
+    utils::HashSet<Point> points;
+    for (int x = 0; x < 50; x++)
+    {
+        for (int y = 0; y < 50; y++)
+            points.insert(Point{x, y});
+    }
+    EXPECT_EQ(points.size(), 2500);
+    EXPECT_TRUE(points.contain(Point{10, 20}));
+    EXPECT_FALSE(points.contain(Point{50, 0}));
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+ * ---------------------------------------------------
+ * LfuCache_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 20:24:12
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "UtilsCPP/LfuCache.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::LfuCache;
+
+TEST(LfuCacheTest, evictLeastFrequentlyUsed)
+{
+    LfuCache<utils::String, int> cache(2);
+    cache.put("hot", 1);
+    cache.put("cold", 2);
+    cache.get("hot");
+    cache.get("hot");
+    EXPECT_EQ(cache.useCount("hot"), 3);
+    EXPECT_EQ(cache.useCount("cold"), 1);
+    EXPECT_EQ(cache.useCount("missing"), 0);
+
+    cache.put("new", 3);
+    EXPECT_TRUE(cache.contain("hot"));
+    EXPECT_FALSE(cache.contain("cold"));
+
+    // "new" is the only entry used once
+    cache.put("newer", 4);
+    EXPECT_TRUE(cache.contain("hot"));
+    EXPECT_FALSE(cache.contain("new"));
+    EXPECT_EQ(*cache.get("newer"), 4);
+}
+
+TEST(LfuCacheTest, tieBreakIsLeastRecentlyUsed)
+{
+    LfuCache<int, int> cache(3);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+    cache.get(2);
+    cache.get(1);
+    cache.get(3);
+
+    cache.put(4, 4);
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_FALSE(cache.contain(4)); // the only entry used once
+    cache.setCapacity(2);
+    EXPECT_FALSE(cache.contain(2));
+    EXPECT_TRUE(cache.contain(1));
+    EXPECT_TRUE(cache.contain(3));
+}
+
+TEST(LfuCacheTest, statsAndCallback)
+{
+    std::vector<int> evicted;
+    LfuCache<int, std::string> cache(2, [](const int&, const std::string& val) { return (utils::uint64)val.size(); });
+    cache.setEvictionCallback([&](const int& key, std::string&) { evicted.push_back(key); });
+
+    cache.put(1, "a");
+    cache.put(2, "b");
+    cache.get(1);
+    cache.get(3);
+    cache.put(3, "c");
+
+    EXPECT_EQ(cache.weight(), 2);
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+    EXPECT_EQ(cache.stats().evictions, 1);
+    ASSERT_EQ(evicted.size(), 1);
+    EXPECT_EQ(evicted[0], 2);
+
+    EXPECT_TRUE(cache.remove(1));
+    cache.clear();
+    EXPECT_TRUE(cache.isEmpty());
+    EXPECT_EQ(cache.weight(), 0);
+    EXPECT_EQ(evicted.size(), 1);
+}
+
+TEST(LfuCacheTest, randomAgainstModel)
+{
+    struct Entry
+    {
+        int val;
+        int count;
+        int lastUse;
+    };
+
+    const utils::uint64 capacity = 32;
+    LfuCache<int, int> cache(capacity);
+    std::map<int, Entry> model;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = random<int>(0, 100);
+        auto it = model.find(key);
+        if (random<int>(0, 1) == 0)
+        {
+            int* val = cache.get(key);
+            ASSERT_EQ(val != nullptr, it != model.end());
+            if (val != nullptr)
+            {
+                EXPECT_EQ(*val, it->second.val);
+                it->second.count++;
+                it->second.lastUse = i;
+            }
+        }
+        else
+        {
+            cache.put(key, i);
+            if (it != model.end())
+                it->second = Entry{i, it->second.count + 1, i};
+            else
+                model[key] = Entry{i, 1, i};
+            if (model.size() > capacity)
+            {
+                auto victim = model.begin();
+                for (auto candidate = model.begin(); candidate != model.end(); ++candidate)
+                {
+                    if (candidate->second.count < victim->second.count || (candidate->second.count == victim->second.count && candidate->second.lastUse < victim->second.lastUse))
+                        victim = candidate;
+                }
+                model.erase(victim);
+            }
+        }
+        ASSERT_EQ(cache.size(), model.size());
+    }
+    for (const auto& entry : model)
+        EXPECT_EQ(cache.useCount(entry.first), (utils::uint64)entry.second.count);
+}
+
+}
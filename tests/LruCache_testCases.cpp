@@ -0,0 +1,163 @@
+/*
+ * ---------------------------------------------------
+ * LruCache_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 20:10:37
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "UtilsCPP/LruCache.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::LruCache;
+
+TEST(LruCacheTest, getPut)
+{
+    LruCache<utils::String, int> cache(2);
+    EXPECT_TRUE(cache.isEmpty());
+    EXPECT_EQ(cache.get("one"), nullptr);
+
+    cache.put("one", 1);
+    cache.put("two", 2);
+    ASSERT_NE(cache.get("one"), nullptr);
+    EXPECT_EQ(*cache.get("one"), 1);
+
+    cache.put("three", 3); // "two" is the least recently used
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(cache.contain("two"));
+    EXPECT_TRUE(cache.contain("one"));
+    EXPECT_TRUE(cache.contain("three"));
+
+    cache.put("one", 10);
+    EXPECT_EQ(*cache.get("one"), 10);
+    EXPECT_EQ(cache.size(), 2);
+
+    EXPECT_TRUE(cache.remove("one"));
+    EXPECT_FALSE(cache.remove("one"));
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(LruCacheTest, containIsNotAUse)
+{
+    LruCache<int, int> cache(2);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    EXPECT_TRUE(cache.contain(1));
+    cache.put(3, 3);
+    EXPECT_FALSE(cache.contain(1));
+    EXPECT_TRUE(cache.contain(2));
+}
+
+TEST(LruCacheTest, stats)
+{
+    LruCache<int, int> cache(1);
+    cache.put(1, 1);
+    cache.get(1);
+    cache.get(2);
+    cache.put(2, 2);
+
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+    EXPECT_EQ(cache.stats().evictions, 1);
+
+    cache.resetStats();
+    EXPECT_EQ(cache.stats().hits, 0);
+    EXPECT_EQ(cache.stats().evictions, 0);
+}
+
+TEST(LruCacheTest, evictionCallback)
+{
+    std::vector<std::pair<int, std::string>> evicted;
+    LruCache<int, std::string> cache(2);
+    cache.setEvictionCallback([&](const int& key, std::string& val) { evicted.emplace_back(key, std::move(val)); });
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    cache.remove(2);
+    cache.setCapacity(0);
+
+    ASSERT_EQ(evicted.size(), 2);
+    EXPECT_EQ(evicted[0].first, 1);
+    EXPECT_EQ(evicted[0].second, "one");
+    EXPECT_EQ(evicted[1].first, 3);
+    EXPECT_TRUE(cache.isEmpty());
+}
+
+TEST(LruCacheTest, weigher)
+{
+    LruCache<int, std::string> cache(10, [](const int&, const std::string& val) { return (utils::uint64)val.size(); });
+
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    EXPECT_EQ(cache.weight(), 8);
+    cache.put(3, "cccc"); // 12 > 10, evicts 1
+    EXPECT_FALSE(cache.contain(1));
+    EXPECT_EQ(cache.weight(), 8);
+
+    cache.put(2, "b");
+    EXPECT_EQ(cache.weight(), 5);
+
+    cache.put(4, "an entry heavier than the capacity");
+    EXPECT_FALSE(cache.contain(4));
+    EXPECT_EQ(cache.weight(), 5);
+}
+
+TEST(LruCacheTest, pointerStability)
+{
+    LruCache<int, int> cache(1000);
+    cache.put(0, 0);
+    int* first = cache.get(0);
+    for (int i = 1; i < 1000; i++)
+        cache.put(i, i);
+    EXPECT_EQ(cache.get(0), first);
+}
+
+TEST(LruCacheTest, randomAgainstModel)
+{
+    const utils::uint64 capacity = 64;
+    LruCache<int, int> cache(capacity);
+    std::list<std::pair<int, int>> model; // most recently used first
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = random<int>(0, 200);
+        auto it = std::find_if(model.begin(), model.end(), [&](const std::pair<int, int>& entry) { return entry.first == key; });
+        if (random<int>(0, 1) == 0)
+        {
+            int* val = cache.get(key);
+            ASSERT_EQ(val != nullptr, it != model.end());
+            if (val != nullptr)
+            {
+                EXPECT_EQ(*val, it->second);
+                model.splice(model.begin(), model, it);
+            }
+        }
+        else
+        {
+            cache.put(key, i);
+            if (it != model.end())
+                model.erase(it);
+            model.emplace_front(key, i);
+            if (model.size() > capacity)
+                model.pop_back();
+        }
+        ASSERT_EQ(cache.size(), model.size());
+    }
+    for (const auto& entry : model)
+        EXPECT_TRUE(cache.contain(entry.first));
+}
+
+}
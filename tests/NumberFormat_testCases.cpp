@@ -0,0 +1,150 @@
+/*
+ * ---------------------------------------------------
+ * NumberFormat_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 03:47:26
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+static std::string formatted(utils::uint64 (*format)(char*, double), double value)
+{
+    char buffer[utils::maxNumberLength];
+    return std::string(buffer, format(buffer, value));
+}
+
+static std::string formattedFloat(float value)
+{
+    char buffer[utils::maxNumberLength];
+    return std::string(buffer, utils::formatFloat(buffer, value));
+}
+
+TEST(NumberFormatTest, integers)
+{
+    char buffer[utils::maxNumberLength];
+    EXPECT_EQ(std::string(buffer, utils::formatInt(buffer, 0)), "0");
+    EXPECT_EQ(std::string(buffer, utils::formatInt(buffer, -7)), "-7");
+    EXPECT_EQ(std::string(buffer, utils::formatInt(buffer, LLONG_MIN)), "-9223372036854775808");
+    EXPECT_EQ(std::string(buffer, utils::formatInt(buffer, LLONG_MAX)), "9223372036854775807");
+    EXPECT_EQ(std::string(buffer, utils::formatUInt(buffer, ULLONG_MAX)), "18446744073709551615");
+
+    for (int i = 0; i < 10000; i++)
+    {
+        long long value = random<long long>(LLONG_MIN, LLONG_MAX) >> random<int>(0, 63);
+        ASSERT_EQ(std::string(buffer, utils::formatInt(buffer, value)), std::to_string(value));
+    }
+}
+
+TEST(NumberFormatTest, hexBinary)
+{
+    char buffer[utils::maxNumberLength];
+    EXPECT_EQ(std::string(buffer, utils::formatHex(buffer, 0)), "0");
+    EXPECT_EQ(std::string(buffer, utils::formatHex(buffer, 0xDEADBEEF)), "deadbeef");
+    EXPECT_EQ(std::string(buffer, utils::formatHex(buffer, 0xAB, 4)), "00ab");
+    EXPECT_EQ(std::string(buffer, utils::formatHex(buffer, ULLONG_MAX, 100)), "ffffffffffffffff");
+    EXPECT_EQ(std::string(buffer, utils::formatBinary(buffer, 0)), "0");
+    EXPECT_EQ(std::string(buffer, utils::formatBinary(buffer, 10)), "1010");
+    EXPECT_EQ(std::string(buffer, utils::formatBinary(buffer, 5, 8)), "00000101");
+    EXPECT_EQ(std::string(buffer, utils::formatBinary(buffer, ULLONG_MAX)), std::string(64, '1'));
+}
+
+TEST(NumberFormatTest, doubles)
+{
+    EXPECT_EQ(formatted(utils::formatDouble, 0.0), "0");
+    EXPECT_EQ(formatted(utils::formatDouble, -0.0), "-0");
+    EXPECT_EQ(formatted(utils::formatDouble, 1.0), "1");
+    EXPECT_EQ(formatted(utils::formatDouble, 0.1), "0.1");
+    EXPECT_EQ(formatted(utils::formatDouble, 0.1 + 0.2), "0.30000000000000004");
+    EXPECT_EQ(formatted(utils::formatDouble, -123.456), "-123.456");
+    EXPECT_EQ(formatted(utils::formatDouble, 1e20), "100000000000000000000");
+    EXPECT_EQ(formatted(utils::formatDouble, 1e21), "1e+21");
+    EXPECT_EQ(formatted(utils::formatDouble, 0.000001), "0.000001");
+    EXPECT_EQ(formatted(utils::formatDouble, 1.5e-7), "1.5e-7");
+    EXPECT_EQ(formatted(utils::formatDouble, 9007199254740993.0), "9007199254740992");
+    EXPECT_EQ(formatted(utils::formatDouble, DBL_MAX), "1.7976931348623157e+308");
+    EXPECT_EQ(formatted(utils::formatDouble, DBL_MIN), "2.2250738585072014e-308");
+    EXPECT_EQ(formatted(utils::formatDouble, 5e-324), "5e-324");
+    EXPECT_EQ(formatted(utils::formatDouble, std::numeric_limits<double>::infinity()), "inf");
+    EXPECT_EQ(formatted(utils::formatDouble, -std::numeric_limits<double>::infinity()), "-inf");
+    EXPECT_EQ(formatted(utils::formatDouble, std::numeric_limits<double>::quiet_NaN()), "nan");
+}
+
+TEST(NumberFormatTest, doublesRoundTrip)
+{
+    for (int i = 0; i < 100000; i++)
+    {
+        unsigned long long bits = random<unsigned long long>(0, ULLONG_MAX);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value) == false)
+            continue;
+        std::string text = formatted(utils::formatDouble, value);
+        ASSERT_EQ(std::strtod(text.c_str(), nullptr), value) << text;
+
+        // no shorter representation reads back to the value
+        std::string digits = text.substr(0, text.find('e'));
+        digits.erase(std::remove(digits.begin(), digits.end(), '-'), digits.end());
+        digits.erase(std::remove(digits.begin(), digits.end(), '.'), digits.end());
+        digits.erase(0, digits.find_first_not_of('0'));
+        digits.erase(digits.find_last_not_of('0') + 1);
+        char shorter[64];
+        std::snprintf(shorter, sizeof(shorter), "%.*e", (int)digits.size() - 2, value);
+        if (digits.size() > 1)
+        {
+            ASSERT_NE(std::strtod(shorter, nullptr), value) << text;
+        }
+    }
+}
+
+TEST(NumberFormatTest, floats)
+{
+    EXPECT_EQ(formattedFloat(0.1f), "0.1");
+    EXPECT_EQ(formattedFloat(1.0f / 3.0f), "0.33333334");
+    EXPECT_EQ(formattedFloat(16777216.0f), "16777216");
+    EXPECT_EQ(formattedFloat(FLT_MAX), "3.4028235e+38");
+    EXPECT_EQ(formattedFloat(1e-45f), "1e-45");
+    EXPECT_EQ(formattedFloat(-2.5f), "-2.5");
+
+    for (int i = 0; i < 100000; i++)
+    {
+        unsigned int bits = random<unsigned int>(0, UINT_MAX);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value) == false)
+            continue;
+        std::string text = formattedFloat(value);
+        ASSERT_EQ(std::strtof(text.c_str(), nullptr), value) << text;
+    }
+}
+
+TEST(NumberFormatTest, stringBuilder)
+{
+    utils::StringBuilder builder;
+    builder.append(0.5).append(' ').append(2.5f).append(' ').appendHex(255, 4).append(' ').appendBinary(6);
+    EXPECT_EQ(builder.build(), utils::String("0.5 2.5 00ff 110"));
+
+    EXPECT_EQ(utils::String::fromInt(-42), utils::String("-42"));
+    EXPECT_EQ(utils::String::fromUInt(10000000000ULL), utils::String("10000000000"));
+    EXPECT_EQ(utils::String::fromDouble(1.25), utils::String("1.25"));
+}
+
+}
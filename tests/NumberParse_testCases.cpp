@@ -0,0 +1,184 @@
+/*
+ * ---------------------------------------------------
+ * NumberParse_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 04:48:02
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/NumberFormat.hpp"
+#include "UtilsCPP/NumberParse.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::ParseError;
+
+TEST(NumberParseTest, integers)
+{
+    long long value = 0;
+    utils::ParseResult result = utils::parseInt("12345", value);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(result.length, 5);
+    EXPECT_EQ(value, 12345);
+
+    EXPECT_TRUE(utils::parseInt("-9223372036854775808", value));
+    EXPECT_EQ(value, LLONG_MIN);
+    EXPECT_TRUE(utils::parseInt("9223372036854775807", value));
+    EXPECT_EQ(value, LLONG_MAX);
+    EXPECT_TRUE(utils::parseInt("00000000000000000000000042", value));
+    EXPECT_EQ(value, 42);
+
+    result = utils::parseInt("123456789012345678;next", value);
+    EXPECT_EQ(result.length, 18);
+    EXPECT_EQ(value, 123456789012345678);
+
+    value = 7;
+    EXPECT_EQ(utils::parseInt("9223372036854775808", value).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseInt("-9223372036854775809", value).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseInt("", value).error, ParseError::invalid);
+    EXPECT_EQ(utils::parseInt("-", value).error, ParseError::invalid);
+    EXPECT_EQ(utils::parseInt(" 1", value).error, ParseError::invalid);
+    EXPECT_EQ(utils::parseInt("+1", value).error, ParseError::invalid);
+    EXPECT_EQ(value, 7);
+
+    unsigned long long unsignedValue = 0;
+    EXPECT_TRUE(utils::parseUInt("18446744073709551615", unsignedValue));
+    EXPECT_EQ(unsignedValue, ULLONG_MAX);
+    EXPECT_EQ(utils::parseUInt("18446744073709551616", unsignedValue).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseUInt("99999999999999999999", unsignedValue).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseUInt("100000000000000000000", unsignedValue).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseUInt("-1", unsignedValue).error, ParseError::invalid);
+
+    char buffer[utils::maxNumberLength];
+    for (int i = 0; i < 10000; i++)
+    {
+        long long expected = random<long long>(LLONG_MIN, LLONG_MAX) >> random<int>(0, 63);
+        utils::uint64 length = utils::formatInt(buffer, expected);
+        ASSERT_TRUE(utils::parseInt(utils::StringView(buffer, length), value));
+        ASSERT_EQ(value, expected);
+    }
+}
+
+TEST(NumberParseTest, doubles)
+{
+    double value = 0;
+    utils::ParseResult result = utils::parseDouble("-12.5e3", value);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(result.length, 7);
+    EXPECT_EQ(value, -12500.0);
+
+    EXPECT_TRUE(utils::parseDouble("0.1", value));
+    EXPECT_EQ(value, 0.1);
+    EXPECT_TRUE(utils::parseDouble(".5", value));
+    EXPECT_EQ(value, 0.5);
+    EXPECT_TRUE(utils::parseDouble("5.", value));
+    EXPECT_EQ(value, 5.0);
+    EXPECT_TRUE(utils::parseDouble("-0", value));
+    EXPECT_TRUE(std::signbit(value));
+    EXPECT_TRUE(utils::parseDouble("1.7976931348623157e308", value));
+    EXPECT_EQ(value, std::numeric_limits<double>::max());
+    EXPECT_TRUE(utils::parseDouble("4.9406564584124654e-324", value));
+    EXPECT_EQ(value, std::numeric_limits<double>::denorm_min());
+    EXPECT_TRUE(utils::parseDouble("1e-400", value));
+    EXPECT_EQ(value, 0.0);
+    EXPECT_TRUE(utils::parseDouble("9007199254740993", value)); // halfway, rounds to even
+    EXPECT_EQ(value, 9007199254740992.0);
+    EXPECT_TRUE(utils::parseDouble("9007199254740993.00000000000000000001", value)); // above halfway
+    EXPECT_EQ(value, 9007199254740994.0);
+
+    result = utils::parseDouble("2e", value);
+    EXPECT_EQ(result.length, 1); // the 'e' has no exponent
+    EXPECT_EQ(value, 2.0);
+
+    EXPECT_TRUE(utils::parseDouble("-Infinity", value));
+    EXPECT_EQ(value, -std::numeric_limits<double>::infinity());
+    result = utils::parseDouble("inf,", value);
+    EXPECT_EQ(result.length, 3);
+    EXPECT_TRUE(utils::parseDouble("NaN", value));
+    EXPECT_TRUE(std::isnan(value));
+
+    value = 3.0;
+    EXPECT_EQ(utils::parseDouble("1e309", value).error, ParseError::outOfRange);
+    EXPECT_EQ(utils::parseDouble(".", value).error, ParseError::invalid);
+    EXPECT_EQ(utils::parseDouble("e5", value).error, ParseError::invalid);
+    EXPECT_EQ(utils::parseDouble("-x", value).error, ParseError::invalid);
+    EXPECT_EQ(value, 3.0);
+
+    float floatValue = 0;
+    EXPECT_TRUE(utils::parseFloat("3.4028235e38", floatValue));
+    EXPECT_EQ(floatValue, std::numeric_limits<float>::max());
+    EXPECT_TRUE(utils::parseFloat("0.1", floatValue));
+    EXPECT_EQ(floatValue, 0.1f);
+    EXPECT_EQ(utils::parseFloat("3.5e38", floatValue).error, ParseError::outOfRange);
+}
+
+TEST(NumberParseTest, doublesRoundTrip)
+{
+    char buffer[utils::maxNumberLength + 1];
+    for (int i = 0; i < 100000; i++)
+    {
+        unsigned long long bits = random<unsigned long long>(0, ULLONG_MAX);
+        double expected;
+        std::memcpy(&expected, &bits, sizeof(expected));
+        if (std::isfinite(expected) == false)
+            continue;
+
+        utils::uint64 length = utils::formatDouble(buffer, expected);
+        double value;
+        ASSERT_TRUE(utils::parseDouble(utils::StringView(buffer, length), value));
+        ASSERT_EQ(std::memcmp(&value, &expected, sizeof(value)), 0) << std::string(buffer, length);
+
+        // long representations, the truncated path, against strtod
+        std::snprintf(buffer, sizeof(buffer), "%.40e", expected);
+        ASSERT_TRUE(utils::parseDouble(buffer, value));
+        ASSERT_EQ(value, std::strtod(buffer, nullptr)) << buffer;
+    }
+}
+
+TEST(NumberParseTest, delimited)
+{
+    utils::Array<long long> integers;
+    utils::ParseResult result = utils::parseDelimited("1, -2,3 ,  40\n", ',', integers);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(result.length, 14);
+    ASSERT_EQ(integers.length(), 4);
+    EXPECT_EQ(integers[1], -2);
+    EXPECT_EQ(integers[3], 40);
+
+    utils::Array<double> doubles;
+    result = utils::parseDelimited(utils::String("0.5\t1e3\t-inf"), '\t', doubles);
+    EXPECT_TRUE(result);
+    ASSERT_EQ(doubles.length(), 3);
+    EXPECT_EQ(doubles[1], 1000.0);
+
+    utils::Array<unsigned long long> values;
+    result = utils::parseDelimited("1;2;x;4", ';', values);
+    EXPECT_EQ(result.error, ParseError::invalid);
+    EXPECT_EQ(result.length, 4);
+    EXPECT_EQ(values.length(), 2);
+
+    result = utils::parseDelimited("1;2 3", ';', values);
+    EXPECT_EQ(result.error, ParseError::invalid);
+    EXPECT_EQ(result.length, 4);
+
+    utils::Array<float> floats;
+    EXPECT_TRUE(utils::parseDelimited("  ", ',', floats));
+    EXPECT_EQ(floats.length(), 0);
+    EXPECT_EQ(utils::parseDelimited("1,,2", ',', floats).error, ParseError::invalid);
+}
+
+}
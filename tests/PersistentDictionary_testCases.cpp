@@ -0,0 +1,55 @@
+/*
+ * ---------------------------------------------------
+ * PersistentDictionary_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 12:06:44
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "UtilsCPP/PersistentDictionary.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::PersistentDictionary;
+
+TEST(PersistentDictionaryTest, insert)
+{
+    PersistentDictionary<utils::String, int> dic;
+    dic.insert("a", 1);
+    dic.insert("b", 2);
+
+    EXPECT_EQ(dic.size(), 2);
+    EXPECT_EQ(dic["a"], 1);
+    EXPECT_EQ(dic["b"], 2);
+
+    using KeyNoFoundError = PersistentDictionary<utils::String, int>::KeyNoFoundError;
+
+    EXPECT_THROW({ dic["c"]; }, KeyNoFoundError);
+}
+
+TEST(PersistentDictionaryTest, functionalUpdates)
+{
+    PersistentDictionary<std::string, std::string> v1;
+    v1.insert("route/a", "host1");
+    v1.insert("route/b", "host2");
+
+    PersistentDictionary<std::string, std::string> v2 = v1.with("route/a", "host3");
+    PersistentDictionary<std::string, std::string> v3 = v2.with("route/c", "host4").without("route/b");
+
+    EXPECT_EQ(v1["route/a"], "host1");
+    EXPECT_EQ(v2["route/a"], "host3");
+    EXPECT_EQ(v2.size(), 2);
+
+    EXPECT_EQ(v3.size(), 2);
+    EXPECT_FALSE(v3.contain("route/b"));
+    EXPECT_EQ(v3["route/c"], "host4");
+    EXPECT_TRUE(v1.contain("route/b"));
+}
+
+}
@@ -0,0 +1,157 @@
+/*
+ * ---------------------------------------------------
+ * PersistentSet_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 11:55:03
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "UtilsCPP/Array.hpp"
+#include "UtilsCPP/PersistentSet.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+using utils::PersistentSet;
+
+struct Counted
+{
+    static int s_alive;
+
+    int value;
+
+    Counted(int v) : value(v) { s_alive++; }
+    Counted(const Counted& cp) : value(cp.value) { s_alive++; }
+    ~Counted() { s_alive--; }
+
+    inline bool operator == (const Counted& rhs) const { return value == rhs.value; }
+    inline bool operator  < (const Counted& rhs) const { return value  < rhs.value; }
+};
+
+int Counted::s_alive = 0;
+
+TEST(PersistentSetTest, insert)
+{
+    PersistentSet<int> set;
+    set.insert(3);
+    set.insert(1);
+    set.insert(2);
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contain(2));
+    EXPECT_FALSE(set.contain(4));
+    EXPECT_THROW({ set.insert(2); }, PersistentSet<int>::DuplicateElementError);
+    EXPECT_EQ(set.size(), 3);
+
+    int expected = 1;
+    for (int element : set)
+        EXPECT_EQ(element, expected++);
+    EXPECT_EQ(expected, 4);
+}
+
+TEST(PersistentSetTest, snapshots)
+{
+    PersistentSet<int> v1 = { 1, 2, 3 };
+    PersistentSet<int> v2 = v1 + 4;
+    PersistentSet<int> v3 = v2 - 1;
+
+    EXPECT_EQ(v1, PersistentSet<int>({ 1, 2, 3 }));
+    EXPECT_EQ(v2, PersistentSet<int>({ 1, 2, 3, 4 }));
+    EXPECT_EQ(v3, PersistentSet<int>({ 2, 3, 4 }));
+
+    PersistentSet<int> v4 = v3 - 10;
+    EXPECT_EQ(v4, v3);
+    EXPECT_FALSE(v4.remove(10));
+}
+
+TEST(PersistentSetTest, remove)
+{
+    PersistentSet<int> set;
+    for (int i = 0; i < 1000; i++)
+        set.insert(i);
+
+    PersistentSet<int> before = set;
+    for (int i = 0; i < 1000; i += 2)
+        EXPECT_TRUE(set.remove(i));
+
+    EXPECT_EQ(set.size(), 500);
+    EXPECT_EQ(before.size(), 1000);
+
+    int expected = 1;
+    for (int element : set)
+    {
+        ASSERT_EQ(element, expected);
+        expected += 2;
+    }
+    expected = 0;
+    for (int element : before)
+        ASSERT_EQ(element, expected++);
+}
+
+TEST(PersistentSetTest, find)
+{
+    PersistentSet<int> set;
+    for (int i = 0; i < 100; i++)
+        set.insert(i * 2);
+
+    PersistentSet<int>::Iterator it = set.find(40);
+    ASSERT_NE(it, set.end());
+    EXPECT_EQ(*it, 40);
+    EXPECT_EQ(*++it, 42);
+    EXPECT_EQ(set.find(41), set.end());
+    EXPECT_EQ(++set.find(198), set.end());
+}
+
+TEST(PersistentSetTest, balanced)
+{
+    PersistentSet<int> set;
+    for (int i = 0; i < 100000; i++)
+        set.insert(i);
+
+    int expected = 0;
+    for (int element : set)
+        ASSERT_EQ(element, expected++);
+    EXPECT_EQ(expected, 100000);
+}
+
+TEST(PersistentSetTest, sharedNodesRelease)
+{
+    {
+        PersistentSet<Counted> v1;
+        for (int i = 0; i < 100; i++)
+            v1.insert(Counted(i));
+        PersistentSet<Counted> v2 = v1 + Counted(1000);
+        PersistentSet<Counted> v3 = v2 - Counted(50);
+        v3.insertOrReplace(Counted(10));
+
+        EXPECT_EQ(v1.size(), 100);
+        EXPECT_EQ(v2.size(), 101);
+        EXPECT_EQ(v3.size(), 100);
+        EXPECT_LT(Counted::s_alive, 200);
+    }
+    EXPECT_EQ(Counted::s_alive, 0);
+}
+
+TEST(PersistentSetTest, releaseFromOtherThread)
+{
+    PersistentSet<utils::String> writer;
+    utils::Array<std::thread> readers;
+    for (int i = 0; i < 8; i++)
+    {
+        writer.insert(utils::String::fromUInt(i));
+        PersistentSet<utils::String> snapshot = writer;
+        readers.append(std::thread([snapshot, i]() {
+            EXPECT_EQ(snapshot.size(), (PersistentSet<utils::String>::Size)i + 1);
+            EXPECT_TRUE(snapshot.contain(utils::String::fromUInt(i)));
+        }));
+    }
+    for (auto& reader : readers)
+        reader.join();
+}
+
+}
@@ -0,0 +1,339 @@
+/*
+ * ---------------------------------------------------
+ * RadixTree_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 22:41:26
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "UtilsCPP/RadixTree.hpp"
+#include "UtilsCPP/String.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::RadixTree;
+
+namespace
+{
+
+std::vector<std::string> keysOf(const RadixTree<int>& tree)
+{
+    std::vector<std::string> keys;
+    tree.forEach([&](const RadixTree<int>::KeyValPair& pair) { keys.emplace_back((const char*)pair.key); });
+    return keys;
+}
+
+std::vector<std::string> keysWithPrefix(const RadixTree<int>& tree, const char* prefix)
+{
+    std::vector<std::string> keys;
+    tree.forEachWithPrefix(prefix, [&](const RadixTree<int>::KeyValPair& pair) { keys.emplace_back((const char*)pair.key); });
+    return keys;
+}
+
+// random key over a small alphabet so keys share long prefixes
+std::string randomKey()
+{
+    std::string key;
+    int length = random<int>(0, 24);
+    for (int i = 0; i < length; i++)
+        key += (char)('a' + random<int>(0, 2));
+    return key;
+}
+
+}
+
+TEST(RadixTreeTest, insertFind)
+{
+    RadixTree<int> tree;
+    EXPECT_TRUE(tree.isEmpty());
+    tree.insert("romane", 1);
+    tree.insert("romanus", 2);
+    tree.insert("romulus", 3);
+    tree.insert("rubens", 4);
+    tree.insert("ruber", 5);
+    tree.insert("rubicon", 6);
+    tree.insert("rubicundus", 7);
+    tree.insert("rom", 8);
+    tree.insert("", 9);
+
+    EXPECT_EQ(tree.size(), 9);
+    EXPECT_EQ(tree["romanus"], 2);
+    EXPECT_EQ(tree["rom"], 8);
+    EXPECT_EQ(tree[""], 9);
+    EXPECT_EQ(tree[utils::String("rubicon")], 6);
+    EXPECT_EQ(tree.find("roman"), nullptr);
+    EXPECT_EQ(tree.find("romanes"), nullptr);
+    EXPECT_FALSE(tree.contain("r"));
+
+    using Tree = RadixTree<int>;
+    EXPECT_THROW({ tree.insert("ruber", 50); }, Tree::DuplicateElementError);
+    EXPECT_THROW({ tree["rubi"]; }, Tree::KeyNoFoundError);
+
+    tree.insertOrAssign("ruber", 50);
+    tree.insertOrAssign("rubeus", 10);
+    EXPECT_EQ(tree["ruber"], 50);
+    EXPECT_EQ(tree["rubeus"], 10);
+    EXPECT_EQ(tree.size(), 10);
+}
+
+TEST(RadixTreeTest, longPrefixes)
+{
+    // prefixes longer than the bytes stored in the nodes
+    RadixTree<int> tree;
+    std::string base(40, 'x');
+    tree.insert((base + "1").c_str(), 1);
+    tree.insert((base + "2").c_str(), 2);
+    tree.insert((base.substr(0, 20) + "y").c_str(), 3);
+    tree.insert(base.substr(0, 30).c_str(), 4);
+
+    EXPECT_EQ(tree[(base + "1").c_str()], 1);
+    EXPECT_EQ(tree[(base + "2").c_str()], 2);
+    EXPECT_EQ(tree[(base.substr(0, 20) + "y").c_str()], 3);
+    EXPECT_EQ(tree[base.substr(0, 30).c_str()], 4);
+    EXPECT_FALSE(tree.contain((base.substr(0, 15) + "z" + base.substr(0, 24) + "1").c_str()));
+
+    EXPECT_EQ(keysWithPrefix(tree, base.substr(0, 25).c_str()).size(), 3);
+    EXPECT_EQ(keysWithPrefix(tree, (base.substr(0, 25) + "y").c_str()).size(), 0);
+
+    EXPECT_TRUE(tree.remove(base.substr(0, 30).c_str()));
+    EXPECT_TRUE(tree.remove((base.substr(0, 20) + "y").c_str()));
+    EXPECT_EQ(tree[(base + "1").c_str()], 1);
+    EXPECT_EQ(tree[(base + "2").c_str()], 2);
+}
+
+TEST(RadixTreeTest, sortedIteration)
+{
+    RadixTree<int> tree;
+    for (const char* key : { "b", "abc", "a", "ab", "abd", "ba", "" })
+        tree.insert(key, 0);
+    std::vector<std::string> expected = { "", "a", "ab", "abc", "abd", "b", "ba" };
+    EXPECT_EQ(keysOf(tree), expected);
+
+    expected = { "ab", "abc", "abd" };
+    EXPECT_EQ(keysWithPrefix(tree, "ab"), expected);
+    EXPECT_EQ(keysWithPrefix(tree, "abc"), std::vector<std::string>{ "abc" });
+    EXPECT_TRUE(keysWithPrefix(tree, "abcd").empty());
+    EXPECT_TRUE(keysWithPrefix(tree, "c").empty());
+    EXPECT_EQ(keysWithPrefix(tree, "").size(), 7);
+}
+
+TEST(RadixTreeTest, iterators)
+{
+    RadixTree<int> tree;
+    EXPECT_TRUE(tree.begin() == tree.end());
+    EXPECT_TRUE(tree.withPrefix("a").isEmpty());
+
+    // keys nested deeper than the frames stored in the iterator
+    std::vector<std::string> expected;
+    std::string key;
+    for (int i = 0; i < 40; i++)
+    {
+        key += (char)('a' + i % 2);
+        tree.insert(key.c_str(), i);
+        tree.insert((key + "z").c_str(), -i);
+        expected.push_back(key);
+        expected.push_back(key + "z");
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<std::string> keys;
+    for (RadixTree<int>::KeyValPair& pair : tree)
+    {
+        keys.emplace_back((const char*)pair.key);
+        pair.val++;
+    }
+    EXPECT_EQ(keys, expected);
+    EXPECT_EQ(tree["a"], 1);
+
+    // a copy resumes from the same position, independently of the original
+    const RadixTree<int>& constTree = tree;
+    RadixTree<int>::const_Iterator it = constTree.begin();
+    for (int i = 0; i < 30; i++)
+        ++it;
+    RadixTree<int>::const_Iterator copy = it;
+    EXPECT_EQ(std::string((const char*)it->key), expected[30]);
+    for (int i = 30; i < 50; i++)
+        ++it;
+    EXPECT_EQ(std::string((const char*)copy->key), expected[30]);
+    EXPECT_EQ(std::string((const char*)(*it).key), expected[50]);
+    copy = std::move(it);
+    EXPECT_EQ(std::string((const char*)copy->key), expected[50]);
+
+    // stopping early in a prefix range
+    keys.clear();
+    for (const RadixTree<int>::KeyValPair& pair : constTree.withPrefix("abab"))
+    {
+        if (keys.size() == 3)
+            break;
+        keys.emplace_back((const char*)pair.key);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{ "abab", "ababa", "ababab" }));
+
+    RadixTree<int>::Range<RadixTree<int>::Iterator> range = tree.withPrefix("ababababz");
+    EXPECT_FALSE(range.isEmpty());
+    EXPECT_EQ(std::string((const char*)range.begin()->key), "ababababz");
+    EXPECT_TRUE(++range.begin() == range.end());
+    EXPECT_TRUE(tree.withPrefix("b").isEmpty());
+}
+
+TEST(RadixTreeTest, longestPrefixMatch)
+{
+    RadixTree<int> routes;
+    routes.insert("/", 0);
+    routes.insert("/api", 1);
+    routes.insert("/api/users", 2);
+    routes.insert("/api/users/admin", 3);
+    routes.insert("/static", 4);
+
+    EXPECT_EQ(routes.longestPrefixMatch("/api/users/42")->val, 2);
+    EXPECT_EQ(routes.longestPrefixMatch("/api/users")->val, 2);
+    EXPECT_EQ(routes.longestPrefixMatch("/api/user")->val, 1);
+    EXPECT_EQ(routes.longestPrefixMatch("/api/users/admin/x")->val, 3);
+    EXPECT_EQ(routes.longestPrefixMatch("/index.html")->val, 0);
+    EXPECT_EQ(routes.longestPrefixMatch("/api/users/admin")->key, utils::String("/api/users/admin"));
+    EXPECT_EQ(routes.longestPrefixMatch("api"), nullptr);
+
+    routes.remove("/");
+    EXPECT_EQ(routes.longestPrefixMatch("/index.html"), nullptr);
+}
+
+TEST(RadixTreeTest, nodeGrowthAndShrink)
+{
+    RadixTree<int> tree;
+    utils::uint64 emptyMemory = tree.memoryUsage();
+    for (int c = 1; c < 256; c++)
+    {
+        char key[3] = { 'k', (char)c, '\0' };
+        tree.insert(key, c);
+    }
+    EXPECT_EQ(tree.size(), 255);
+    for (int c = 1; c < 256; c++)
+    {
+        char key[3] = { 'k', (char)c, '\0' };
+        ASSERT_NE(tree.find(key), nullptr);
+        EXPECT_EQ(*tree.find(key), c);
+    }
+    utils::uint64 fullMemory = tree.memoryUsage();
+    EXPECT_GT(fullMemory, emptyMemory);
+
+    for (int c = 1; c < 256; c++)
+    {
+        char key[3] = { 'k', (char)c, '\0' };
+        if (c % 17 != 0)
+        {
+            EXPECT_TRUE(tree.remove(key));
+        }
+    }
+    EXPECT_EQ(tree.size(), 15);
+    EXPECT_LT(tree.memoryUsage(), fullMemory);
+    for (int c = 17; c < 256; c += 17)
+    {
+        char key[3] = { 'k', (char)c, '\0' };
+        EXPECT_EQ(tree[key], c);
+    }
+
+    tree.clear();
+    EXPECT_EQ(tree.memoryUsage(), 0);
+    EXPECT_TRUE(tree.isEmpty());
+}
+
+TEST(RadixTreeTest, copyMove)
+{
+    RadixTree<int> tree;
+    tree.insert("one", 1);
+    tree.insert("two", 2);
+
+    RadixTree<int> copy(tree);
+    copy.insertOrAssign("one", 10);
+    EXPECT_EQ(tree["one"], 1);
+    EXPECT_EQ(copy["one"], 10);
+    EXPECT_EQ(copy.memoryUsage(), tree.memoryUsage());
+
+    RadixTree<int> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(copy.isEmpty());
+
+    tree = moved;
+    EXPECT_EQ(tree["one"], 10);
+}
+
+TEST(RadixTreeTest, randomAgainstModel)
+{
+    RadixTree<int> tree;
+    std::map<std::string, int> model;
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string key = randomKey();
+        switch (random<int>(0, 3))
+        {
+        case 0:
+        case 1:
+            tree.insertOrAssign(key.c_str(), i);
+            model[key] = i;
+            break;
+        case 2:
+            EXPECT_EQ(tree.remove(key.c_str()), model.erase(key) == 1);
+            break;
+        case 3:
+        {
+            const int* val = tree.find(key.c_str());
+            auto it = model.find(key);
+            ASSERT_EQ(val != nullptr, it != model.end());
+            if (val != nullptr)
+            {
+                EXPECT_EQ(*val, it->second);
+            }
+            break;
+        }
+        }
+        ASSERT_EQ(tree.size(), model.size());
+    }
+
+    std::vector<std::string> expected;
+    for (const auto& entry : model)
+        expected.push_back(entry.first);
+    EXPECT_EQ(keysOf(tree), expected);
+
+    for (int i = 0; i < 200; i++)
+    {
+        std::string prefix = randomKey().substr(0, (std::size_t)random<int>(0, 6));
+        expected.clear();
+        for (auto it = model.lower_bound(prefix); it != model.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+            expected.push_back(it->first);
+        EXPECT_EQ(keysWithPrefix(tree, prefix.c_str()), expected);
+
+        std::string query = randomKey();
+        const RadixTree<int>::KeyValPair* match = tree.longestPrefixMatch(query.c_str());
+        std::string best;
+        bool found = false;
+        for (std::size_t length = 0; length <= query.size(); length++)
+        {
+            if (model.count(query.substr(0, length)) != 0)
+            {
+                best = query.substr(0, length);
+                found = true;
+            }
+        }
+        ASSERT_EQ(match != nullptr, found);
+        if (found)
+        {
+            EXPECT_EQ(std::string((const char*)match->key), best);
+        }
+    }
+
+    for (const auto& entry : model)
+        EXPECT_TRUE(tree.remove(entry.first.c_str()));
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.memoryUsage(), 0);
+}
+
+}
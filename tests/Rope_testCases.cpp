@@ -0,0 +1,118 @@
+/*
+ * ---------------------------------------------------
+ * Rope_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 03:01:44
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+#include "UtilsCPP/Rope.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::Rope;
+
+static std::string ropeContent(const Rope& rope)
+{
+    utils::String string = rope.toString();
+    return std::string((const char*)string, string.length());
+}
+
+TEST(RopeTest, insertRemove)
+{
+    Rope rope;
+    EXPECT_TRUE(rope.isEmpty());
+
+    rope.append("hello world");
+    rope.insert(5, ",");
+    rope.insert(0, ">> ");
+    rope.insert(100, "!");
+    EXPECT_EQ(ropeContent(rope), ">> hello, world!");
+    EXPECT_EQ(rope.length(), 16);
+    EXPECT_EQ(rope[3], 'h');
+
+    rope.remove(0, 3);
+    rope.remove(5, 1);
+    rope.remove(11, 100);
+    EXPECT_EQ(ropeContent(rope), "hello world");
+    EXPECT_EQ(rope.substr(6, 5), utils::String("world"));
+}
+
+TEST(RopeTest, largeText)
+{
+    std::string text;
+    for (int i = 0; i < 5000; i++)
+        text += "line " + std::to_string(i) + "\n";
+    Rope rope(utils::StringView(text.c_str(), text.size()));
+    EXPECT_EQ(rope.length(), text.size());
+
+    utils::String::Size chunks = 0;
+    utils::String::Size total = 0;
+    rope.forEachChunk([&](utils::StringView chunk) { chunks++; total += chunk.length(); });
+    EXPECT_GT(chunks, 1);
+    EXPECT_EQ(total, text.size());
+
+    rope.insert(text.size() / 2, "inserted");
+    text.insert(text.size() / 2, "inserted");
+    EXPECT_EQ(ropeContent(rope), text);
+    for (std::size_t i = 0; i < text.size(); i += 97)
+        ASSERT_EQ(rope[i], text[i]);
+}
+
+TEST(RopeTest, randomEdits)
+{
+    Rope rope;
+    std::string expected;
+    for (int i = 0; i < 3000; i++)
+    {
+        std::size_t pos = (std::size_t)random<int>(0, (int)expected.size());
+        if (random<int>(0, 2) != 0 || expected.empty())
+        {
+            std::string text((std::size_t)random<int>(1, random<int>(0, 9) == 0 ? 3000 : 20), (char)random<int>('a', 'z'));
+            rope.insert(pos, utils::StringView(text.c_str(), text.size()));
+            expected.insert(pos, text);
+        }
+        else
+        {
+            std::size_t length = (std::size_t)random<int>(0, 200);
+            rope.remove(pos, length);
+            expected.erase(pos, length);
+        }
+        ASSERT_EQ(rope.length(), expected.size());
+    }
+    EXPECT_EQ(ropeContent(rope), expected);
+
+    std::size_t pos = expected.size() / 3;
+    utils::String slice = rope.substr(pos, 1500);
+    EXPECT_EQ(std::string((const char*)slice, slice.length()), expected.substr(pos, 1500));
+}
+
+TEST(RopeTest, copyMove)
+{
+    Rope rope("some text");
+    Rope copy(rope);
+    copy.insert(4, " more");
+    EXPECT_EQ(ropeContent(rope), "some text");
+    EXPECT_EQ(ropeContent(copy), "some more text");
+
+    Rope moved(std::move(copy));
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(ropeContent(moved), "some more text");
+
+    rope = moved;
+    EXPECT_EQ(ropeContent(rope), "some more text");
+    rope.clear();
+    EXPECT_TRUE(rope.isEmpty());
+    EXPECT_EQ(ropeContent(rope), "");
+}
+
+}
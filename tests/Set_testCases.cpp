@@ -47,6 +47,88 @@ TEST(SetTest, initializerListConstructor)
     }
 }
 
+TEST(SetTest, rangeConstructor)
+{
+    {
+        utils::Array<int> arr = { 5, 3, 9, 1, 7 };
+        utils::Set<int> set(arr.begin(), arr.end());
+        EXPECT_EQ(set, utils::Set<int>({ 1, 3, 5, 7, 9 }));
+    }
+    {
+        utils::Array<int> arr;
+        utils::Set<int> set(arr.begin(), arr.end());
+        EXPECT_EQ(set.size(), 0);
+    }
+    {
+        utils::Array<int> arr = { 5, 3, 5 };
+        EXPECT_THROW({ utils::Set<int> set(arr.begin(), arr.end()); }, utils::Set<int>::DuplicateElementError);
+    }
+}
+
+TEST(SetTest, fromSorted)
+{
+    {
+        utils::Array<int> arr = { 1, 2, 3, 4, 5, 6, 7 };
+        utils::Set<int> set = utils::Set<int>::fromSorted(arr.begin(), arr.end());
+        EXPECT_EQ(set, utils::Set<int>({ 1, 2, 3, 4, 5, 6, 7 }));
+        EXPECT_EQ(set.size(), 7);
+    }
+    {
+        utils::Array<int> arr;
+        for (int i = 0; i < 100000; i++)
+            arr.append(i);
+        utils::Set<int> set = utils::Set<int>::fromSorted(arr.begin(), arr.end());
+        int expected = 0;
+        for (int element : set)
+            ASSERT_EQ(element, expected++);
+        EXPECT_EQ(expected, 100000);
+        EXPECT_EQ(*set.find(54321), 54321);
+    }
+    {
+        utils::Array<int> arr = { 1, 2, 2, 3 };
+        EXPECT_THROW({ utils::Set<int>::fromSorted(arr.begin(), arr.end()); }, utils::Set<int>::DuplicateElementError);
+    }
+    {
+        utils::Array<int> arr = { 1, 3, 2 };
+        EXPECT_THROW({ utils::Set<int>::fromSorted(arr.begin(), arr.end()); }, utils::Set<int>::UnsortedInputError);
+    }
+}
+
+TEST(SetTest, setAlgebra)
+{
+    const utils::Set<int> a = { 1, 2, 3, 4, 5 };
+    const utils::Set<int> b = { 4, 5, 6, 7 };
+    const utils::Set<int> empty;
+
+    EXPECT_EQ(a.unionWith(b),           utils::Set<int>({ 1, 2, 3, 4, 5, 6, 7 }));
+    EXPECT_EQ(a.intersect(b),           utils::Set<int>({ 4, 5 }));
+    EXPECT_EQ(a.difference(b),          utils::Set<int>({ 1, 2, 3 }));
+    EXPECT_EQ(b.difference(a),          utils::Set<int>({ 6, 7 }));
+    EXPECT_EQ(a.symmetricDifference(b), utils::Set<int>({ 1, 2, 3, 6, 7 }));
+
+    EXPECT_EQ(a.unionWith(empty), a);
+    EXPECT_EQ(a.intersect(empty), empty);
+    EXPECT_EQ(empty.difference(a), empty);
+
+    EXPECT_TRUE(a.contain(utils::Set<int>({ 2, 4 })));
+    EXPECT_TRUE(a.contain(empty));
+    EXPECT_FALSE(a.contain(b));
+}
+
+TEST(SetTest, plusOperator)
+{
+    {
+        utils::Set<int> set = { 1, 3 };
+        set += utils::Set<int>({ 2, 4 });
+        EXPECT_EQ(set, utils::Set<int>({ 1, 2, 3, 4 }));
+    }
+    {
+        utils::Set<int> set = { 1, 3 };
+        EXPECT_THROW({ set += utils::Set<int>({ 3, 4 }); }, utils::Set<int>::DuplicateElementError);
+        EXPECT_EQ(set, utils::Set<int>({ 1, 3 }));
+    }
+}
+
 TYPED_TEST(SetTest, insert)
 {
     {
@@ -194,6 +276,84 @@ TEST(SetTest, iterator)
     ASSERT_EQ(set4It, set4.end());
 }
 
+TEST(SetTest, bidirectionalIterator)
+{
+    {
+        utils::Set<int> set = { 20, 10, 30, 5, 25, 35, 4, 6, 33, 36, 34 };
+        utils::Array<int> expected = { 36, 35, 34, 33, 30, 25, 20, 10, 6, 5, 4 };
+        utils::Array<int>::Index i = 0;
+        for (utils::Set<int>::ReverseIterator it = set.rbegin(); it != set.rend(); ++it)
+            ASSERT_EQ(*it, expected[i++]);
+        EXPECT_EQ(i, expected.length());
+    }
+    {
+        const utils::Set<int> set = { 3, 1, 2 };
+        utils::Set<int>::const_Iterator it = set.end();
+        EXPECT_EQ(*--it, 3);
+        EXPECT_EQ(*--it, 2);
+        EXPECT_EQ(*--it, 1);
+        EXPECT_EQ(--it, set.end());
+        EXPECT_EQ(*set.rbegin(), 3);
+    }
+    {
+        utils::Set<int> set;
+        EXPECT_EQ(set.rbegin(), set.rend());
+    }
+    {
+        // iterators to elements follow the nodes to the moved to set, end() must be taken from it
+        utils::Set<int> a = { 1, 2, 3 };
+        utils::Set<int>::Iterator it = a.find(2);
+        utils::Set<int> b = std::move(a);
+        EXPECT_EQ(*it, 2);
+        EXPECT_EQ(*--it, 1);
+        EXPECT_EQ(*--b.end(), 3);
+        EXPECT_EQ(++(++it), --b.end());
+    }
+}
+
+TEST(SetTest, bounds)
+{
+    const utils::Set<int> set = { 10, 20, 30, 40 };
+
+    EXPECT_EQ(*set.lowerBound(20), 20);
+    EXPECT_EQ(*set.lowerBound(21), 30);
+    EXPECT_EQ(*set.lowerBound(0),  10);
+    EXPECT_EQ( set.lowerBound(41), set.end());
+
+    EXPECT_EQ(*set.upperBound(20), 30);
+    EXPECT_EQ(*set.upperBound(19), 20);
+    EXPECT_EQ( set.upperBound(40), set.end());
+
+    auto found = set.equalRange(30);
+    EXPECT_EQ(*found.begin(), 30);
+    EXPECT_EQ(*++found.begin(), 40);
+
+    auto missing = set.equalRange(35);
+    EXPECT_TRUE(missing.isEmpty());
+    EXPECT_EQ(*missing.begin(), 40);
+}
+
+TEST(SetTest, iterateRange)
+{
+    utils::Set<int> set;
+    for (int i = 0; i < 100; i += 5)
+        set.insert(i);
+
+    utils::Array<int> elements;
+    for (int element : set.iterateRange(12, 31))
+        elements.append(element);
+    EXPECT_EQ(elements, utils::Array<int>({ 15, 20, 25, 30 }));
+
+    elements.clear();
+    for (int element : set.iterateRange(15, 30))
+        elements.append(element);
+    EXPECT_EQ(elements, utils::Array<int>({ 15, 20, 25 }));
+
+    EXPECT_TRUE(set.iterateRange(16, 19).isEmpty());
+    EXPECT_TRUE(set.iterateRange(30, 10).isEmpty());
+    EXPECT_TRUE(set.iterateRange(200, 300).isEmpty());
+}
+
 TEST(SetTest, remove)
 {
     {
@@ -330,6 +490,51 @@ TEST(SetTest, remove)
     }
 }
 
+struct Descending
+{
+    inline int operator () (int a, int b) const { return a == b ? 0 : (a < b ? 1 : -1); }
+};
+
+struct CountingCompare
+{
+    int* count;
+    inline int operator () (int a, int b) const { (*count)++; return a == b ? 0 : (a < b ? -1 : 1); }
+};
+
+TEST(SetTest, customCompare)
+{
+    {
+        utils::Set<int, Descending> set = { 3, 1, 4, 2 };
+        utils::Array<int> expected = { 4, 3, 2, 1 };
+        utils::Array<int>::Index i = 0;
+        for (int element : set)
+            ASSERT_EQ(element, expected[i++]);
+        EXPECT_EQ(i, 4);
+        EXPECT_EQ(*set.find(2), 2);
+        using DuplicateElementError = utils::Set<int, Descending>::DuplicateElementError;
+        EXPECT_THROW({ set.insert(3); }, DuplicateElementError);
+    }
+    {
+        utils::Array<int> arr = { 1, 5, 3 };
+        utils::Set<int, Descending> set(arr.begin(), arr.end());
+        EXPECT_EQ(*set.begin(), 5);
+        EXPECT_EQ(set.intersect(utils::Set<int, Descending>({ 3, 4, 5 })), (utils::Set<int, Descending>({ 5, 3 })));
+    }
+    {
+        int count = 0;
+        utils::Array<int> arr;
+        for (int i = 0; i < 1023; i++)
+            arr.append(i);
+        auto set = utils::Set<int, CountingCompare>::fromSorted(arr.begin(), arr.end(), CountingCompare{&count});
+        count = 0;
+        EXPECT_EQ(*set.find(0), 0);
+        EXPECT_LE(count, 10);
+        count = 0;
+        EXPECT_EQ(set.find(2000), set.end());
+        EXPECT_LE(count, 10);
+    }
+}
+
 TEST(SetTest, userDefinedType)
 {
     {
@@ -358,4 +563,131 @@ TEST(SetTest, userDefinedType)
     }
 }
 
-}
\ No newline at end of file
+TEST(SetTest, findOrInsert)
+{
+    utils::Set<int> set = { 2, 4 };
+    int calls = 0;
+    bool inserted = false;
+
+    auto it = set.findOrInsert(3, [&]() { calls++; return 3; }, &inserted);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(*it, 3);
+
+    it = set.findOrInsert(3, [&]() { calls++; return 3; }, &inserted);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(calls, 1);
+
+    int expected[] = { 2, 3, 4 };
+    int i = 0;
+    for (int element : set)
+        EXPECT_EQ(element, expected[i++]);
+    EXPECT_EQ(i, 3);
+}
+
+TEST(SetTest, extractInsertNode)
+{
+    utils::Set<utils::String> a = { "a", "b", "c" };
+    utils::Set<utils::String> b = { "x" };
+
+    auto handle = a.extract(a.find("b"));
+    EXPECT_FALSE(handle.isEmpty());
+    EXPECT_EQ(handle.value(), utils::String("b"));
+    const char* characters = (const char*)handle.value();
+    EXPECT_EQ(a.size(), 2);
+    EXPECT_FALSE(a.contain("b"));
+
+    auto it = b.insert(std::move(handle));
+    EXPECT_EQ(*it, utils::String("b"));
+    EXPECT_EQ((const char*)*it, characters); // same node, nothing was copied
+    EXPECT_EQ(b.size(), 2);
+
+    EXPECT_TRUE(a.extract(a.end()).isEmpty());
+
+    auto duplicate = a.extract(a.find("a"));
+    b.insert("a");
+    using DuplicateElementError = utils::Set<utils::String>::DuplicateElementError;
+    EXPECT_THROW({ b.insert(std::move(duplicate)); }, DuplicateElementError);
+    EXPECT_FALSE(duplicate.isEmpty());
+}
+
+TEST(SetTest, extractInnerNodes)
+{
+    utils::Set<int> set = { 50, 30, 70, 20, 40, 60, 80, 35, 45 };
+    utils::Set<int> other;
+
+    for (int value : { 30, 50, 70, 35 })
+        other.insert(set.extract(set.find(value)));
+
+    int expectedSet[] = { 20, 40, 45, 60, 80 };
+    int i = 0;
+    for (int element : set)
+        EXPECT_EQ(element, expectedSet[i++]);
+    EXPECT_EQ(i, 5);
+
+    int expectedOther[] = { 30, 35, 50, 70 };
+    i = 0;
+    for (int element : other)
+        EXPECT_EQ(element, expectedOther[i++]);
+    EXPECT_EQ(i, 4);
+}
+
+TEST(SetTest, merge)
+{
+    utils::Set<int> a = { 1, 3, 5 };
+    utils::Set<int> b = { 2, 3, 4, 5, 6 };
+
+    a.merge(b);
+
+    int expectedA[] = { 1, 2, 3, 4, 5, 6 };
+    int i = 0;
+    for (int element : a)
+        EXPECT_EQ(element, expectedA[i++]);
+    EXPECT_EQ(i, 6);
+
+    int expectedB[] = { 3, 5 };
+    i = 0;
+    for (int element : b)
+        EXPECT_EQ(element, expectedB[i++]);
+    EXPECT_EQ(i, 2);
+
+    a.merge(a);
+    EXPECT_EQ(a.size(), 6);
+}
+
+TEST(SetTest, findMany)
+{
+    utils::Set<int> set;
+    for (int i = 0; i < 1000; i++)
+    {
+        int value = random<int>(0, 5000);
+        if (set.contain(value) == false)
+            set.insert(value);
+    }
+
+    int keys[300];
+    for (int& key : keys)
+        key = random<int>(-100, 5100);
+
+    utils::Set<int>::Iterator found[300];
+    bool contained[300];
+    set.findMany(keys, 300, found);
+    set.containMany(keys, 300, contained);
+    for (int i = 0; i < 300; i++)
+    {
+        EXPECT_EQ(found[i], set.find(keys[i]));
+        EXPECT_EQ(contained[i], set.contain(keys[i]));
+    }
+
+    const utils::Set<int>& constSet = set;
+    utils::Set<int>::const_Iterator constFound[3];
+    constSet.findMany(keys, 3, constFound);
+    for (int i = 0; i < 3; i++)
+        EXPECT_EQ(constFound[i], constSet.find(keys[i]));
+
+    utils::Set<int> empty;
+    empty.containMany(keys, 10, contained);
+    for (int i = 0; i < 10; i++)
+        EXPECT_FALSE(contained[i]);
+}
+}
@@ -0,0 +1,110 @@
+/*
+ * ---------------------------------------------------
+ * StaticDictionary_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/19 21:31:09
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+#include "UtilsCPP/StaticDictionary.hpp"
+#include "UtilsCPP/String.hpp"
+
+namespace utils_tests
+{
+
+enum class Command { get, set, remove, list, quit };
+
+constexpr auto commands = utils::makeStaticDictionary<Command>({
+    { "get",    Command::get    },
+    { "set",    Command::set    },
+    { "remove", Command::remove },
+    { "list",   Command::list   },
+    { "quit",   Command::quit   },
+});
+
+static_assert(commands.size() == 5, "");
+static_assert(commands["remove"] == Command::remove, "");
+static_assert(commands.contain("quit"), "");
+static_assert(commands.contain("exit") == false, "");
+static_assert(commands.contain("") == false, "");
+
+constexpr utils::StaticEntry<int> keywordEntries[] = {
+    { "alignas", 0 }, { "alignof", 1 }, { "and", 2 }, { "asm", 3 }, { "auto", 4 }, { "bitand", 5 },
+    { "bitor", 6 }, { "bool", 7 }, { "break", 8 }, { "case", 9 }, { "catch", 10 }, { "char", 11 },
+    { "class", 12 }, { "compl", 13 }, { "const", 14 }, { "constexpr", 15 }, { "const_cast", 16 },
+    { "continue", 17 }, { "decltype", 18 }, { "default", 19 }, { "delete", 20 }, { "do", 21 },
+    { "double", 22 }, { "dynamic_cast", 23 }, { "else", 24 }, { "enum", 25 }, { "explicit", 26 },
+    { "export", 27 }, { "extern", 28 }, { "false", 29 }, { "float", 30 }, { "for", 31 }, { "friend", 32 },
+    { "goto", 33 }, { "if", 34 }, { "inline", 35 }, { "int", 36 }, { "long", 37 }, { "mutable", 38 },
+    { "namespace", 39 }, { "new", 40 }, { "noexcept", 41 }, { "not", 42 }, { "nullptr", 43 },
+    { "operator", 44 }, { "or", 45 }, { "private", 46 }, { "protected", 47 }, { "public", 48 },
+    { "register", 49 }, { "reinterpret_cast", 50 }, { "return", 51 }, { "short", 52 }, { "signed", 53 },
+    { "sizeof", 54 }, { "static", 55 }, { "static_assert", 56 }, { "static_cast", 57 }, { "struct", 58 },
+    { "switch", 59 }, { "template", 60 }, { "this", 61 }, { "thread_local", 62 }, { "throw", 63 },
+    { "true", 64 }, { "try", 65 }, { "typedef", 66 }, { "typeid", 67 }, { "typename", 68 }, { "union", 69 },
+    { "unsigned", 70 }, { "using", 71 }, { "virtual", 72 }, { "void", 73 }, { "volatile", 74 },
+    { "wchar_t", 75 }, { "while", 76 }, { "xor", 77 },
+};
+
+constexpr utils::StaticDictionary<int, 78> keywords(keywordEntries);
+
+static_assert(keywords["thread_local"] == 62, "");
+
+TEST(StaticDictionaryTest, lookup)
+{
+    EXPECT_EQ(commands["get"], Command::get);
+    EXPECT_EQ(*commands.find("list"), Command::list);
+    EXPECT_EQ(commands.find("li"), nullptr);
+    EXPECT_EQ(commands.find("lists"), nullptr);
+    EXPECT_EQ(commands.find("set", 2), nullptr);
+    EXPECT_EQ(*commands.find("settings", 3), Command::set);
+
+    using Commands = utils::StaticDictionary<Command, 5>;
+    EXPECT_THROW({ commands["exit"]; }, Commands::KeyNoFoundError);
+}
+
+TEST(StaticDictionaryTest, stringKeys)
+{
+    utils::String key("quit");
+    EXPECT_TRUE(commands.contain(key));
+    EXPECT_EQ(commands[key], Command::quit);
+    EXPECT_FALSE(commands.contain(utils::String("qui")));
+}
+
+TEST(StaticDictionaryTest, everyKeyIsFound)
+{
+    for (const auto& entry : keywordEntries)
+    {
+        const int* val = keywords.find(entry.key);
+        ASSERT_NE(val, nullptr) << entry.key;
+        EXPECT_EQ(*val, entry.val);
+        EXPECT_FALSE(keywords.contain(std::string(entry.key).append("_").c_str()));
+    }
+
+    std::set<int> values;
+    for (const auto& pair : keywords)
+    {
+        EXPECT_EQ(keywords[pair.key], pair.val);
+        values.insert(pair.val);
+    }
+    EXPECT_EQ(values.size(), 78);
+}
+
+TEST(StaticDictionaryTest, runtimeBuild)
+{
+    const char* names[] = { "a", "b", "c" };
+    utils::StaticEntry<int> entries[] = { { names[0], 1 }, { names[1], 2 }, { names[2], 3 } };
+    utils::StaticDictionary<int, 3> dictionary(entries);
+    EXPECT_EQ(dictionary["b"], 2);
+
+    utils::StaticEntry<int> duplicated[] = { { "x", 1 }, { "y", 2 }, { "x", 3 } };
+    using Dictionary = utils::StaticDictionary<int, 3>;
+    EXPECT_THROW({ Dictionary invalid(duplicated); }, Dictionary::DuplicateKeyError);
+}
+
+}
@@ -0,0 +1,102 @@
+/*
+ * ---------------------------------------------------
+ * StringBuilder_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 02:52:10
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <climits>
+#include <string>
+
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringBuilder.hpp"
+#include "UtilsCPP/StringView.hpp"
+
+namespace utils_tests
+{
+
+using utils::StringBuilder;
+
+TEST(StringBuilderTest, append)
+{
+    StringBuilder builder;
+    EXPECT_TRUE(builder.isEmpty());
+
+    utils::String world("world");
+    builder.append("hello").append(' ').append(world).append(utils::StringView("!!!", 1));
+    EXPECT_EQ(builder.view(), "hello world!");
+    builder.append('-', 3);
+    EXPECT_EQ(builder.length(), 15);
+
+    utils::String result = builder.build();
+    EXPECT_EQ(result, utils::String("hello world!---"));
+    EXPECT_TRUE(builder.isEmpty());
+}
+
+TEST(StringBuilderTest, numbers)
+{
+    StringBuilder builder;
+    builder.append(0).append(',').append(-42).append(',').append(123456789U).append(',');
+    builder.append(LLONG_MIN).append(',').append(ULLONG_MAX).append(',').append(10L).append(',').append(99UL);
+    EXPECT_EQ(builder.build(), utils::String("0,-42,123456789,-9223372036854775808,18446744073709551615,10,99"));
+
+    for (unsigned int i = 0; i < 100000; i += 7)
+    {
+        StringBuilder number;
+        number.append(i);
+        EXPECT_EQ(number.build(), utils::String(std::to_string(i).c_str()));
+    }
+}
+
+TEST(StringBuilderTest, capacity)
+{
+    StringBuilder builder(1000);
+    EXPECT_GE(builder.capacity(), 1000);
+    const char* buffer = builder.view().data();
+    for (int i = 0; i < 100; i++)
+        builder.append("0123456789");
+    EXPECT_EQ(builder.view().data(), buffer); // no reallocation
+
+    utils::String result = builder.build();
+    EXPECT_EQ((const char*)result, buffer); // moved, not copied
+    EXPECT_EQ(result.length(), 1000);
+
+    builder.append("again");
+    builder.clear();
+    EXPECT_TRUE(builder.isEmpty());
+    builder.append("x");
+    EXPECT_EQ(builder.build(), utils::String("x"));
+}
+
+TEST(StringBuilderTest, growth)
+{
+    StringBuilder builder;
+    std::string expected;
+    for (int i = 0; i < 1000; i++)
+    {
+        builder.append(i).append(' ');
+        expected += std::to_string(i) + " ";
+    }
+    EXPECT_EQ(builder.view(), utils::StringView(expected.c_str()));
+}
+
+TEST(StringBuilderTest, concatenation)
+{
+    utils::String a("a string longer than the inline buffer, ");
+    utils::String b("b, ");
+    utils::String c("c");
+    EXPECT_EQ(a + b + c, utils::String("a string longer than the inline buffer, b, c"));
+    EXPECT_EQ(utils::String("x") + "y" + "z", utils::String("xyz"));
+
+    utils::String self("abc");
+    self.append(self);
+    EXPECT_EQ(self, utils::String("abcabc"));
+    utils::String longSelf("0123456789012345678901234");
+    longSelf.append(utils::StringView(longSelf).substr(20));
+    EXPECT_EQ(longSelf, utils::String("012345678901234567890123401234"));
+}
+
+}
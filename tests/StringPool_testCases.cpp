@@ -0,0 +1,165 @@
+/*
+ * ---------------------------------------------------
+ * StringPool_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 06:02:51
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringPool.hpp"
+#include "UtilsCPP/StringView.hpp"
+
+namespace utils_tests
+{
+
+using utils::InternedString;
+using utils::StringPool;
+
+TEST(StringPoolTest, intern)
+{
+    StringPool pool;
+    InternedString cpu = pool.intern("cpu.usage");
+    InternedString memory = pool.intern(utils::String("memory.usage"));
+    EXPECT_EQ(pool.size(), 2);
+
+    EXPECT_EQ(cpu.view(), "cpu.usage");
+    EXPECT_EQ(cpu.length(), 9);
+    EXPECT_STREQ(memory.data(), "memory.usage");
+    EXPECT_NE(cpu, memory);
+
+    std::string copy("cpu.usage");
+    InternedString again = pool.intern(utils::StringView(copy.data(), copy.size()));
+    EXPECT_EQ(again, cpu);
+    EXPECT_EQ(again.data(), cpu.data());
+    EXPECT_EQ(pool.size(), 2);
+
+    EXPECT_EQ(cpu.id(), 1);
+    EXPECT_EQ(memory.id(), 2);
+    EXPECT_TRUE(cpu < memory);
+    EXPECT_EQ(cpu.hash(), utils::Hash<utils::StringView>()("cpu.usage"));
+    EXPECT_NE(utils::Hash<InternedString>(1)(cpu), utils::Hash<InternedString>(2)(cpu));
+
+    EXPECT_EQ(pool.find("memory.usage"), memory);
+    EXPECT_TRUE(pool.find("disk.usage").isEmpty());
+    EXPECT_EQ(pool.size(), 2);
+
+    InternedString empty = pool.intern("");
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty, InternedString());
+    EXPECT_STREQ(empty.data(), "");
+    EXPECT_EQ(empty.id(), 0);
+    EXPECT_EQ(empty.hash(), utils::Hash<utils::StringView>()(""));
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(StringPoolTest, manyStrings)
+{
+    for (bool threadCache : {false, true})
+    {
+        StringPool pool(threadCache);
+        std::vector<InternedString> handles;
+        for (int i = 0; i < 100000; i++)
+            handles.push_back(pool.intern(("tag.name." + std::to_string(i)).c_str()));
+        std::string large(100000, 'x'); // larger than the arena blocks
+        InternedString largeHandle = pool.intern(large.c_str());
+
+        EXPECT_EQ(pool.size(), 100001);
+        EXPECT_GT(pool.memoryUsage(), large.size());
+        for (int i = 0; i < 100000; i++)
+        {
+            std::string name = "tag.name." + std::to_string(i);
+            ASSERT_EQ(pool.intern(name.c_str()), handles[(std::size_t)i]);
+            ASSERT_EQ(handles[(std::size_t)i].view(), name.c_str());
+            ASSERT_EQ(handles[(std::size_t)i].id(), (utils::uint32)i + 1);
+        }
+        EXPECT_EQ(pool.find(large.c_str()), largeHandle);
+        EXPECT_EQ(largeHandle.length(), large.size());
+        EXPECT_EQ(pool.size(), 100001);
+    }
+}
+
+TEST(StringPoolTest, threadCache)
+{
+    // the cache of a thread is shared by the pools, a handle must never come from another pool
+    StringPool first(true);
+    InternedString a = first.intern("host");
+    {
+        StringPool second(true);
+        InternedString b = second.intern("host");
+        EXPECT_NE(a, b);
+        EXPECT_EQ(second.intern("host"), b);
+    }
+    StringPool third(true);
+    InternedString c = third.intern("host");
+    EXPECT_EQ(c.id(), 1);
+    EXPECT_EQ(first.intern("host"), a);
+    EXPECT_EQ(third.intern("host"), c);
+}
+
+TEST(StringPoolTest, concurrentIntern)
+{
+    constexpr int THREAD_COUNT = 8;
+    constexpr int NAME_COUNT = 20000;
+    StringPool pool(true);
+
+    std::vector<std::vector<InternedString>> results((std::size_t)THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back([&pool, &results, t]() {
+            std::vector<InternedString>& handles = results[(std::size_t)t];
+            for (int i = 0; i < NAME_COUNT; i++)
+            {
+                int name = (i * 7 + t * 1000) % NAME_COUNT;
+                handles.push_back(pool.intern(("metric." + std::to_string(name)).c_str()));
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(pool.size(), NAME_COUNT);
+    for (int t = 0; t < THREAD_COUNT; t++)
+    {
+        for (int i = 0; i < NAME_COUNT; i++)
+        {
+            int name = (i * 7 + t * 1000) % NAME_COUNT;
+            InternedString handle = results[(std::size_t)t][(std::size_t)i];
+            ASSERT_EQ(handle, pool.find(("metric." + std::to_string(name)).c_str()));
+            ASSERT_EQ(handle.view(), ("metric." + std::to_string(name)).c_str());
+        }
+    }
+}
+
+TEST(StringPoolTest, containerKeys)
+{
+    StringPool pool;
+    utils::HashMap<InternedString, int> counts;
+    utils::Dictionary<InternedString, int> ordered;
+    const char* tags[] = { "host", "region", "host", "service", "region", "host" };
+    for (const char* tag : tags)
+    {
+        InternedString key = pool.intern(tag);
+        if (counts.contain(key))
+            counts[key]++;
+        else
+            counts.insert(key, 1);
+        ordered.insertOrAssign(key, (int)key.length());
+    }
+    EXPECT_EQ(counts.size(), 3);
+    EXPECT_EQ(counts[pool.intern("host")], 3);
+    EXPECT_EQ(counts[pool.find("region")], 2);
+    EXPECT_EQ(ordered.size(), 3);
+    EXPECT_EQ(ordered.begin()->key.view(), "host"); // first interned
+}
+
+}
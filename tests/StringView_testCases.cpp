@@ -0,0 +1,302 @@
+/*
+ * ---------------------------------------------------
+ * StringView_testCases.cpp
+ *
+ * Author: Thomas Choquet <thomas.publique@icloud.com>
+ * Date: 2026/10/20 01:52:37
+ * ---------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "UtilsCPP/Dictionary.hpp"
+#include "UtilsCPP/HashMap.hpp"
+#include "UtilsCPP/RadixTree.hpp"
+#include "UtilsCPP/String.hpp"
+#include "UtilsCPP/StringView.hpp"
+#include "random.hpp"
+
+namespace utils_tests
+{
+
+using utils::StringSplit;
+using utils::StringView;
+
+TEST(StringViewTest, construction)
+{
+    StringView empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty, StringView(""));
+
+    const char* cString = "hello world";
+    StringView view = cString;
+    EXPECT_EQ(view.data(), cString);
+    EXPECT_EQ(view.length(), 11);
+
+    utils::String string("a string longer than the inline buffer");
+    StringView fromString = string;
+    EXPECT_EQ(fromString.data(), (const char*)string);
+    EXPECT_EQ(fromString.length(), string.length());
+    EXPECT_EQ(utils::String(fromString.substr(2, 6)), utils::String("string"));
+
+    StringView slice("hello world", 5);
+    EXPECT_EQ(slice, "hello");
+}
+
+TEST(StringViewTest, substr)
+{
+    StringView view("hello world");
+    EXPECT_EQ(view.substr(6), "world");
+    EXPECT_EQ(view.substr(0, 5), "hello");
+    EXPECT_EQ(view.substr(6, 100), "world");
+    EXPECT_TRUE(view.substr(20).isEmpty());
+    EXPECT_EQ(view.substr(6).data(), view.data() + 6);
+}
+
+TEST(StringViewTest, find)
+{
+    StringView view("abcabcabd");
+    EXPECT_EQ(view.indexOf('c'), 2);
+    EXPECT_EQ(view.indexOf('c', 3), 5);
+    EXPECT_EQ(view.indexOf('z'), StringView::Size(StringView::npos));
+    EXPECT_EQ(view.indexOf("abd"), 6);
+    EXPECT_EQ(view.indexOf("abc", 1), 3);
+    EXPECT_EQ(view.indexOf("abe"), StringView::Size(StringView::npos));
+    EXPECT_EQ(view.indexOf(""), 0);
+    EXPECT_EQ(view.lastIndexOf('a'), 6);
+    EXPECT_EQ(view.lastIndexOf("abc"), 3);
+    EXPECT_EQ(view.lastIndexOf('z'), StringView::Size(StringView::npos));
+    EXPECT_TRUE(view.contain("cab"));
+    EXPECT_FALSE(view.contain("cc"));
+    EXPECT_EQ(StringView("ab").indexOf("abc"), StringView::Size(StringView::npos));
+}
+
+TEST(StringViewTest, search)
+{
+    StringView log("GET /index.html 200\nGET /missing 404\nPOST /form 200\n");
+    EXPECT_EQ(log.count('\n'), 3);
+    EXPECT_EQ(log.count("200"), 2);
+    EXPECT_EQ(StringView("aaaa").count("aa"), 2);
+    EXPECT_EQ(log.count(""), 0);
+    EXPECT_EQ(log.indexOf("404"), 33);
+    EXPECT_EQ(log.lastIndexOf("GET"), 20);
+    EXPECT_EQ(log.lastIndexOf('\n'), log.length() - 1);
+    EXPECT_EQ(log.findAnyOf(" \n"), 3);
+    EXPECT_EQ(log.findAnyOf(" \n", 4), 15);
+    EXPECT_EQ(log.findAnyOf("0123456789#"), 16);
+    EXPECT_EQ(log.findAnyOf("qz"), StringView::Size(StringView::npos));
+    EXPECT_EQ(log.findAnyOf(""), StringView::Size(StringView::npos));
+    EXPECT_EQ(log.indexOf("200", log.length()), StringView::Size(StringView::npos));
+    EXPECT_EQ(StringView().lastIndexOf('a'), StringView::Size(StringView::npos));
+
+    utils::String string("key: value; other: value");
+    EXPECT_EQ(string.indexOf(':'), 3);
+    EXPECT_EQ(string.indexOf("value", 6), 19);
+    EXPECT_EQ(string.lastIndexOf("value"), 19);
+    EXPECT_EQ(string.count("value"), 2);
+    EXPECT_EQ(string.findAnyOf(";:"), 3);
+    EXPECT_TRUE(string.contain("other"));
+
+    // against std::string on small alphabets, where the candidates often fail and the search
+    // switches to Two-Way, and with patterns longer than the SIMD blocks
+    for (int i = 0; i < 3000; i++)
+    {
+        char alphabetSize = (char)random<int>(1, 4);
+        std::string text((std::size_t)random<int>(0, 300), 'a');
+        for (char& c : text)
+            c = (char)('a' + random<int>(0, alphabetSize - 1));
+        std::string pattern;
+        if (text.empty() == false && random<int>(0, 1) == 0)
+        {
+            std::size_t start = (std::size_t)random<int>(0, (int)text.size() - 1);
+            pattern = text.substr(start, (std::size_t)random<int>(1, 40));
+        }
+        else
+        {
+            pattern.assign((std::size_t)random<int>(1, 40), 'a');
+            for (char& c : pattern)
+                c = (char)('a' + random<int>(0, alphabetSize - 1));
+        }
+        StringView view(text.data(), text.size());
+        StringView patternView(pattern.data(), pattern.size());
+
+        std::size_t from = (std::size_t)random<int>(0, (int)text.size());
+        std::size_t expected = text.find(pattern, from);
+        ASSERT_EQ(view.indexOf(patternView, from), expected == std::string::npos ? StringView::npos : expected) << text << " " << pattern;
+        expected = text.rfind(pattern);
+        ASSERT_EQ(view.lastIndexOf(patternView), expected == std::string::npos ? StringView::npos : expected) << text << " " << pattern;
+        expected = text.rfind(pattern[0]);
+        ASSERT_EQ(view.lastIndexOf(pattern[0]), expected == std::string::npos ? StringView::npos : expected);
+        expected = text.find_first_of(pattern, from);
+        ASSERT_EQ(view.findAnyOf(patternView, from), expected == std::string::npos ? StringView::npos : expected);
+
+        StringView::Size count = 0;
+        for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+            count++;
+        ASSERT_EQ(view.count(patternView), count) << text << " " << pattern;
+        ASSERT_EQ(view.count(pattern[0]), (StringView::Size)std::count(text.begin(), text.end(), pattern[0]));
+    }
+
+    // worst case of the first / last character filter
+    std::string text(100000, 'a');
+    std::string pattern = std::string(500, 'a') + "b" + std::string(500, 'a');
+    EXPECT_EQ(StringView(text.data(), text.size()).indexOf(StringView(pattern.data(), pattern.size())), StringView::Size(StringView::npos));
+    text.replace(90000, pattern.size(), pattern);
+    EXPECT_EQ(StringView(text.data(), text.size()).indexOf(StringView(pattern.data(), pattern.size())), 90000);
+}
+
+namespace
+{
+
+template<typename Range>
+std::vector<std::string> fields(const Range& range)
+{
+    std::vector<std::string> output;
+    for (StringView field : range)
+        output.emplace_back(field.data(), field.length());
+    return output;
+}
+
+}
+
+TEST(StringViewTest, split)
+{
+    using Fields = std::vector<std::string>;
+
+    EXPECT_EQ(fields(StringView("a,b,,c").split(',')), Fields({"a", "b", "", "c"}));
+    EXPECT_EQ(fields(StringView(",a,").split(',')), Fields({"", "a", ""}));
+    EXPECT_EQ(fields(StringView("").split(',')), Fields({""}));
+    EXPECT_EQ(fields(StringView("a::b:c::").split("::")), Fields({"a", "b:c", ""}));
+    EXPECT_EQ(fields(StringView("a::b").split("")), Fields({"a::b"}));
+    EXPECT_EQ(fields(StringView("k=v;k2:v2").splitAny("=;:")), Fields({"k", "v", "k2", "v2"}));
+    EXPECT_EQ(fields(StringView("one\r\ntwo\n\nthree\n").lines()), Fields({"one", "two", "", "three"}));
+    EXPECT_EQ(fields(StringView("one\ntwo").lines()), Fields({"one", "two"}));
+    EXPECT_TRUE(fields(StringView("").lines()).empty());
+    EXPECT_EQ(fields(StringView("  GET\t/index.html  HTTP/1.1 \r\n").tokens()), Fields({"GET", "/index.html", "HTTP/1.1"}));
+    EXPECT_EQ(fields(StringView("a--b-c").tokens("-")), Fields({"a", "b", "c"}));
+    EXPECT_TRUE(fields(StringView(" \t ").tokens()).empty());
+
+    const char* text = "key=value";
+    StringSplit<utils::split::Character> range = StringView(text).split('=');
+    StringSplit<utils::split::Character>::Iterator it = range.begin();
+    EXPECT_EQ(it->data(), text);
+    EXPECT_EQ((++it)->data(), text + 4);
+    EXPECT_TRUE(it != range.end());
+    EXPECT_TRUE(++it == range.end());
+    EXPECT_TRUE(range.begin() == range.begin());
+
+    utils::String line("measurement,host=a,region=eu value=1.5 1700000000");
+    EXPECT_EQ(fields(line.tokens()), Fields({"measurement,host=a,region=eu", "value=1.5", "1700000000"}));
+    EXPECT_EQ(fields(line.split(',')).size(), 3);
+
+    utils::Array<StringView> reused;
+    line.splitInto(',', reused);
+    ASSERT_EQ(reused.length(), 3);
+    EXPECT_EQ(reused[1], "host=a");
+    utils::Array<StringView>::Size capacity = reused.capacity();
+    StringView("x y").splitInto(" ", reused);
+    ASSERT_EQ(reused.length(), 2);
+    EXPECT_EQ(reused[1], "y");
+    EXPECT_EQ(reused.capacity(), capacity);
+
+    // against a reference split on random texts
+    for (int i = 0; i < 1000; i++)
+    {
+        std::string text((std::size_t)random<int>(0, 100), 'a');
+        for (char& c : text)
+            c = "ab,; \n"[random<int>(0, 5)];
+        StringView view(text.data(), text.size());
+
+        Fields expected;
+        std::size_t start = 0;
+        for (std::size_t pos = text.find(','); pos != std::string::npos; start = pos + 1, pos = text.find(',', start))
+            expected.push_back(text.substr(start, pos - start));
+        expected.push_back(text.substr(start));
+        ASSERT_EQ(fields(view.split(',')), expected) << text;
+
+        Fields expectedTokens;
+        for (const std::string& field : fields(view.splitAny(" \n")))
+        {
+            if (field.empty() == false)
+                expectedTokens.push_back(field);
+        }
+        ASSERT_EQ(fields(view.tokens()), expectedTokens) << text;
+    }
+}
+
+TEST(StringViewTest, startsEndsWith)
+{
+    StringView view("file.txt");
+    EXPECT_TRUE(view.startsWith("file"));
+    EXPECT_TRUE(view.startsWith(""));
+    EXPECT_FALSE(view.startsWith("file.txt.bak"));
+    EXPECT_TRUE(view.endsWith(".txt"));
+    EXPECT_FALSE(view.endsWith(".md"));
+}
+
+TEST(StringViewTest, trim)
+{
+    EXPECT_EQ(StringView("  \t value \r\n").trim(), "value");
+    EXPECT_EQ(StringView("  value ").trimStart(), "value ");
+    EXPECT_EQ(StringView("  value ").trimEnd(), "  value");
+    EXPECT_TRUE(StringView(" \n ").trim().isEmpty());
+}
+
+TEST(StringViewTest, compare)
+{
+    EXPECT_EQ(StringView("abc").compare("abc"), 0);
+    EXPECT_LT(StringView("abc").compare("abd"), 0);
+    EXPECT_LT(StringView("ab").compare("abc"), 0);
+    EXPECT_GT(StringView("b").compare("abc"), 0);
+    EXPECT_TRUE(StringView("ab") < StringView("abc"));
+    EXPECT_TRUE(StringView("abc") >= "abc");
+    EXPECT_TRUE(StringView("abc") != "abd");
+
+    utils::String string("abc");
+    EXPECT_TRUE(string == StringView("abc"));
+    EXPECT_TRUE(StringView("abcd", 3) == string);
+    EXPECT_EQ(string.compare(StringView("abd")), -1);
+}
+
+TEST(StringViewTest, stringApis)
+{
+    utils::String path("path/to/file.txt");
+    StringView name = path.substr(path.lastIndexOf('/') + 1, 100);
+    EXPECT_EQ(name, "file.txt");
+    EXPECT_EQ(name.data(), (const char*)path + 8);
+    EXPECT_EQ(utils::String("no slash").lastIndexOf('/'), utils::String::Size(StringView::npos));
+
+    utils::String owned = utils::String("a temporary string longer than the inline buffer").substr(2, 9);
+    EXPECT_EQ(owned, utils::String("temporary"));
+}
+
+TEST(StringViewTest, heterogeneousLookup)
+{
+    const char* line = "key=value";
+    StringView key = StringView(line).substr(0, 3);
+
+    utils::Dictionary<utils::String, int> dictionary;
+    dictionary.insert("key", 1);
+    ASSERT_NE(dictionary.find(key), dictionary.end());
+    EXPECT_EQ(dictionary[key], 1);
+    EXPECT_FALSE(dictionary.contain(StringView(line).substr(0, 2)));
+
+    utils::HashMap<utils::String, int> hashMap;
+    hashMap.insert("key", 2);
+    EXPECT_TRUE(hashMap.contain(key));
+    EXPECT_EQ(hashMap[key], 2);
+
+    utils::RadixTree<int> tree;
+    tree.insert(key, 3);
+    EXPECT_EQ(tree["key"], 3);
+    EXPECT_EQ(tree[key], 3);
+
+    utils::HashMap<StringView, int> views;
+    views.insert(key, 4);
+    EXPECT_TRUE(views.contain("key"));
+}
+
+}
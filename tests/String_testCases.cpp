@@ -11,7 +11,12 @@
 
 #include "UtilsCPP/String.hpp"
 #include "./random.hpp"
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
 
 namespace utils_tests
 {
@@ -25,21 +30,21 @@ public:
                editableConstString(*reinterpret_cast<utils::String*>(cosntStringBytes)),
                constString(*reinterpret_cast<utils::String*>(cosntStringBytes))
     {
-        string.m_characters.m_length = GetParam().size();
-        string.m_characters.m_capacity = random<utils::String::Size>(GetParam().size(), GetParam().size() * 3);
-        string.m_characters.m_buffer = (char*)::operator new (string.m_characters.m_capacity);
-        std::strncpy(string.m_characters.m_buffer, GetParam().c_str(), string.m_characters.m_length);
-
-        editableConstString.m_characters.m_length = GetParam().size();
-        editableConstString.m_characters.m_capacity = string.m_characters.m_capacity;
-        editableConstString.m_characters.m_buffer = (char*)::operator new (editableConstString.m_characters.m_capacity);
-        std::strncpy(editableConstString.m_characters.m_buffer, GetParam().c_str(), editableConstString.m_characters.m_length);
+        string.m_length = GetParam().size();
+        string.m_capacity = random<utils::String::Size>(GetParam().size() + 1, GetParam().size() * 3 + 1);
+        string.m_data = (char*)::operator new (string.m_capacity);
+        std::memcpy(string.m_data, GetParam().c_str(), string.m_length + 1);
+
+        editableConstString.m_length = GetParam().size();
+        editableConstString.m_capacity = string.m_capacity;
+        editableConstString.m_data = (char*)::operator new (editableConstString.m_capacity);
+        std::memcpy(editableConstString.m_data, GetParam().c_str(), editableConstString.m_length + 1);
     }
 
     ~String()
     {
-        ::operator delete (string.m_characters.m_buffer);
-        ::operator delete (editableConstString.m_characters.m_buffer);
+        ::operator delete (string.m_data);
+        ::operator delete (editableConstString.m_data);
     }
 
 private:
@@ -65,12 +70,11 @@ TEST_P(String, defaultConstructor)
 
     new (&string) String();
 
-    EXPECT_EQ(string.m_characters.m_length,       1);
-    EXPECT_TRUE(string.m_characters.m_capacity >= 1);
-    EXPECT_NE(string.m_characters.m_buffer,       nullptr);
-    EXPECT_EQ(string.m_characters[0],             '\0');
+    EXPECT_EQ(string.m_length, 0);
+    EXPECT_EQ(string.m_data,   string.m_inline);
+    EXPECT_EQ(string.m_data[0], '\0');
 
-    ::operator delete (string.m_characters.m_buffer);
+    string.~String();
 }
 
 TEST_P(String, literalConstructor)
@@ -83,15 +87,138 @@ TEST_P(String, literalConstructor)
 
     new (&string) String(GetParam().c_str());
 
-    EXPECT_EQ(string.m_characters.m_length, GetParam().size() + 1);
-    EXPECT_TRUE(string.m_characters.m_capacity >= GetParam().size() + 1);
-    EXPECT_NE(string.m_characters.m_buffer, nullptr);
-    EXPECT_EQ(string.m_characters[string.m_characters.m_length - 1], '\0');
+    EXPECT_EQ(string.m_length, GetParam().size());
+    EXPECT_TRUE(string.capacity() >= GetParam().size() + 1);
+    EXPECT_NE(string.m_data, nullptr);
+    EXPECT_NE(string.m_data, GetParam().c_str());
+    EXPECT_EQ(string.m_data[string.m_length], '\0');
+
+    for (Index i = 0; i < string.m_length; i++)
+        EXPECT_EQ(string.m_data[i], GetParam()[i]);
+
+    string.~String();
+}
+
+TEST(StringTest, inlineStorage)
+{
+    utils::String empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ((const char*)empty, empty.m_inline);
+
+    utils::String shortString("exactly twenty-three ch");
+    EXPECT_EQ(shortString.length(), 23);
+    EXPECT_EQ((const char*)shortString, shortString.m_inline);
+
+    utils::String longString("twenty-four characters!!");
+    EXPECT_EQ(longString.length(), 24);
+    EXPECT_NE((const char*)longString, longString.m_inline);
+    EXPECT_EQ(longString, utils::String("twenty-four characters!!"));
+
+    utils::String moved(std::move(shortString));
+    EXPECT_EQ(moved, utils::String("exactly twenty-three ch"));
+    EXPECT_EQ((const char*)moved, moved.m_inline);
+    EXPECT_TRUE(shortString.isEmpty());
+
+    utils::String movedLong(std::move(longString));
+    EXPECT_EQ(movedLong.length(), 24);
+    EXPECT_TRUE(longString.isEmpty());
+
+    moved = movedLong;
+    EXPECT_EQ(moved, movedLong);
+    movedLong = utils::String("short");
+    EXPECT_EQ(movedLong, utils::String("short"));
+}
+
+TEST(StringTest, subscriptBounds)
+{
+    utils::String str("abc");
+    const utils::String& constStr = str;
+
+    EXPECT_EQ(str[2], 'c');
+    EXPECT_EQ(str[3], '\0');
+    EXPECT_EQ(constStr[3], '\0');
+    EXPECT_THROW(str[4], utils::String::OutOfBoundError);
+    EXPECT_THROW(constStr[4], utils::String::OutOfBoundError);
+    EXPECT_THROW(utils::String()[1], utils::Array<char>::OutOfBoundError);
+
+    utils::String literal = utils::String::literal("abc");
+    EXPECT_THROW(literal[4], utils::String::OutOfBoundError);
+    EXPECT_TRUE(literal.isLiteral());
+}
+
+TEST(StringTest, append)
+{
+    utils::String string;
+    std::string expected;
+    for (int i = 0; i < 100; i++)
+    {
+        string.append((char)('a' + i % 26));
+        expected += (char)('a' + i % 26);
+        ASSERT_EQ(string.length(), expected.size());
+        ASSERT_STREQ((const char*)string, expected.c_str());
+    }
+}
+
+TEST(StringTest, literal)
+{
+    using namespace utils::literals;
+
+    static const char* text = "a string literal longer than the inline buffer";
+
+    utils::String literal = utils::String::literal(text);
+    EXPECT_TRUE(literal.isLiteral());
+    EXPECT_EQ((const char*)static_cast<const utils::String&>(literal), text);
+    EXPECT_EQ(literal, utils::String(text));
+    EXPECT_EQ(literal.length(), std::strlen(text));
+
+    utils::String copy = literal;
+    EXPECT_TRUE(copy.isLiteral());
+    EXPECT_EQ((const char*)static_cast<const utils::String&>(copy), text);
 
-    for (Index i = 0; i < string.m_characters.m_length - 1; i++)
-        EXPECT_EQ(string.m_characters.m_buffer[i], GetParam()[i]);
+    copy.append('!'); // copied before the modification
+    EXPECT_FALSE(copy.isLiteral());
+    EXPECT_EQ(copy, utils::String("a string literal longer than the inline buffer!"));
+    EXPECT_EQ(literal, utils::String(text));
 
-    ::operator delete (string.m_characters.m_buffer);
+    utils::String suffix = "short"_s;
+    EXPECT_TRUE(suffix.isLiteral());
+    suffix[0] = 'S';
+    EXPECT_FALSE(suffix.isLiteral());
+    EXPECT_EQ(suffix, utils::String("Short"));
+    EXPECT_EQ("short"_s, utils::String("short"));
+    EXPECT_TRUE(""_s.isEmpty());
+}
+
+TEST(StringTest, readOnlyAccessKeepsLiteral)
+{
+    static const char* text = "a string literal longer than the inline buffer";
+
+    utils::String literal = utils::String::literal(text);
+    EXPECT_EQ(std::strlen(literal), std::strlen(text));
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%s", (const char*)literal);
+    EXPECT_STREQ(buffer, text);
+    utils::String::Size count = 0;
+    for (char c : literal)
+        count += c == ' ' ? 1 : 0;
+    EXPECT_EQ(count, 7);
+    EXPECT_EQ(literal.begin(), text);
+    EXPECT_TRUE(literal.isLiteral());
+    EXPECT_EQ((const char*)literal, text);
+
+    for (char* it = literal.mutableBegin(); it != literal.mutableEnd(); ++it)
+        *it = *it == ' ' ? '_' : *it;
+    EXPECT_FALSE(literal.isLiteral());
+    EXPECT_EQ(literal, utils::String("a_string_literal_longer_than_the_inline_buffer"));
+    EXPECT_STREQ(text, "a string literal longer than the inline buffer");
+}
+
+TEST(StringTest, substrLastIndexOf)
+{
+    utils::String string("path/to/file.txt");
+    EXPECT_EQ(string.lastIndexOf('/'), 7);
+    EXPECT_EQ(string.substr(8, 4), utils::String("file"));
+    EXPECT_EQ(utils::String("abcdefghijklmnopqrstuvwxyz0123456789").substr(20, 16), utils::String("uvwxyz0123456789"));
 }
 
 TEST(StringTest, plusOperator)
@@ -111,4 +238,163 @@ TEST(StringTest, fromUInt)
     EXPECT_EQ(utils::String::fromUInt(0), utils::String("0"));
 }
 
-}
\ No newline at end of file
+TEST(StringTest, contentOf)
+{
+    std::string content;
+    for (int i = 0; i < 200000; i++)
+        content += (char)random<int>(-128, 127); // with '\0' and 0xFF bytes
+    std::istringstream stream(content);
+    utils::String string = utils::String::contentOf(stream);
+    ASSERT_EQ(string.length(), content.size());
+    EXPECT_EQ(std::memcmp((const char*)string, content.data(), content.size()), 0);
+    EXPECT_TRUE(stream.eof());
+
+    std::istringstream partial("header\nbody of the stream");
+    std::string header;
+    std::getline(partial, header);
+    EXPECT_EQ(utils::String::contentOf(partial), utils::String("body of the stream"));
+
+    std::istringstream empty("");
+    EXPECT_EQ(utils::String::contentOf(empty), utils::String(""));
+}
+
+TEST(StringTest, contentOfFile)
+{
+    const char* path = "UtilsCPP_test_contentOfFile.txt";
+    std::string content;
+    for (int i = 0; i < 100000; i++)
+        content += "line " + std::to_string(i) + "\n";
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    utils::String string = utils::String::contentOfFile(path);
+    EXPECT_EQ(string.length(), content.size());
+    EXPECT_EQ(string.capacity(), content.size() + 1); // allocated once for the file size
+    EXPECT_EQ(std::string((const char*)string), content);
+
+    utils::String output("previous content");
+    utils::String::contentOfFile(path, output);
+    EXPECT_EQ(output, string);
+    const char* buffer = output;
+    utils::String::contentOfFile(path, output);
+    EXPECT_EQ((const char*)output, buffer); // buffer reused
+    EXPECT_EQ(output, string);
+
+    std::remove(path);
+    EXPECT_EQ(utils::String::contentOfFile(path), utils::String(""));
+    utils::String::contentOfFile(path, output);
+    EXPECT_TRUE(output.isEmpty());
+}
+
+TEST(StringTest, compare)
+{
+    EXPECT_EQ(utils::String("abc").compare(utils::String("abc")), 0);
+    EXPECT_LT(utils::String("abc").compare(utils::String("abd")), 0);
+    EXPECT_GT(utils::String("abd").compare(utils::String("abc")), 0);
+    EXPECT_LT(utils::String("ab").compare(utils::String("abc")), 0);
+    EXPECT_GT(utils::String("abc").compare(utils::String("ab")), 0);
+    EXPECT_LT(utils::String("").compare(utils::String("a")), 0);
+
+    EXPECT_EQ(utils::String("abc").compare("abc"), 0);
+    EXPECT_LT(utils::String("ab").compare("abc"), 0);
+    EXPECT_GT(utils::String("abc").compare("ab"), 0);
+    EXPECT_GT(utils::String("b").compare("abc"), 0);
+    EXPECT_EQ(utils::String("").compare(""), 0);
+
+    EXPECT_TRUE(utils::String("ab") < utils::String("abc"));
+    EXPECT_FALSE(utils::String("abc") < utils::String("abc"));
+}
+
+TEST(StringTest, cachedHash)
+{
+    const char* text = "a string longer than the inline capacity";
+    utils::String str(text);
+    const utils::String& constStr = str;
+
+    EXPECT_EQ(str.hash(), utils::Hash<utils::StringView>()(text));
+    EXPECT_EQ(utils::Hash<utils::String>()(str), str.hash());
+    EXPECT_EQ(utils::Hash<utils::String>(42)(str), utils::Hash<utils::StringView>(42)(text));
+
+    utils::String copy(str);
+    EXPECT_EQ(copy.hash(), str.hash());
+    EXPECT_TRUE(copy == str);
+
+    str.append('!');
+    EXPECT_EQ(str.hash(), utils::Hash<utils::StringView>()("a string longer than the inline capacity!"));
+    EXPECT_FALSE(copy == str);
+
+    str[0] = 'A';
+    EXPECT_EQ(constStr.hash(), utils::Hash<utils::StringView>()("A string longer than the inline capacity!"));
+    str.mutableData()[1] = '_';
+    EXPECT_EQ(constStr.hash(), utils::Hash<utils::StringView>()("A_string longer than the inline capacity!"));
+
+    copy = str;
+    EXPECT_EQ(copy.hash(), str.hash());
+    utils::String moved(std::move(copy));
+    EXPECT_EQ(moved.hash(), str.hash());
+    EXPECT_EQ(copy.hash(), utils::Hash<utils::StringView>()(""));
+    copy = utils::String("short");
+    EXPECT_EQ(copy.hash(), utils::Hash<utils::StringView>()("short"));
+
+    utils::String other("A_string longer than the inline capacity?");
+    EXPECT_NE(other.hash(), str.hash());
+    EXPECT_FALSE(other == str);
+    other[other.length() - 1] = '!';
+    EXPECT_TRUE(other == str);
+    EXPECT_EQ(other.hash(), str.hash());
+    EXPECT_TRUE(other == str);
+
+    utils::String literal = utils::String::literal("abc");
+    EXPECT_EQ(literal.hash(), utils::Hash<utils::StringView>()("abc"));
+    literal[0] = 'x';
+    EXPECT_EQ(literal.hash(), utils::Hash<utils::StringView>()("xbc"));
+}
+
+TEST(StringTest, readOnlyAccessKeepsHash)
+{
+    utils::String key("a key longer than the inline capacity");
+    utils::uint64 hash = key.hash();
+    EXPECT_EQ(std::strlen(key), key.length());
+    for (char c : key)
+        EXPECT_NE(c, '\0');
+    EXPECT_EQ(key.hash(), hash);
+#ifdef UTILSCPP_STRING_HASH_CACHE
+    EXPECT_EQ(key.m_hash.load(), hash);
+    EXPECT_EQ(sizeof(utils::String), 48);
+#else
+    EXPECT_EQ(sizeof(utils::String), 40);
+#endif
+
+    key.mutableData()[0] = 'A';
+    EXPECT_EQ(key.hash(), utils::Hash<utils::StringView>()("A key longer than the inline capacity"));
+}
+
+TEST(StringTest, equalityIgnoresStaleHash)
+{
+    utils::String a("hello");
+    char* p = a.mutableData();
+    EXPECT_EQ(a.hash(), utils::Hash<utils::StringView>()("hello"));
+    p[0] = 'H';
+
+    utils::String c("Hello");
+    c.hash();
+    EXPECT_EQ(std::strcmp(a, c), 0);
+    EXPECT_TRUE(a == c);
+    EXPECT_FALSE(a != c);
+    EXPECT_TRUE(utils::Equal<utils::String>()(a, c));
+}
+
+TEST(StringTest, relationalOperators)
+{
+    EXPECT_TRUE(utils::String("abc") <= utils::String("abc"));
+    EXPECT_TRUE(utils::String("abc") <= utils::String("abd"));
+    EXPECT_FALSE(utils::String("abd") <= utils::String("abc"));
+    EXPECT_TRUE(utils::String("abd") > utils::String("abc"));
+    EXPECT_FALSE(utils::String("abc") > utils::String("abc"));
+    EXPECT_TRUE(utils::String("abc") >= utils::String("ab"));
+    EXPECT_FALSE(utils::String("ab") >= utils::String("abc"));
+}
+
+}